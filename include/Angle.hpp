@@ -0,0 +1,88 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Angle.hpp
+ *  @brief  Numeric View of Rotation Angles
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+
+namespace qcore {
+
+// tolerance used when comparing angles
+static constexpr fp ANGLE_TOLERANCE = static_cast<fp>(1e-9);
+
+/** @brief Evaluating an angle of rotation given as string
+ *
+ * @details Accepts constant arithmetic expressions over decimal numbers and pi
+ *          (e.g. "pi/4", "-pi / 2", "3*pi/4", "0.25", "2*(pi-0.5)", "1e-3").
+ *
+ *  @param angle The angle of rotation
+ *  @return fp The value of the angle in radian
+ *  @throws QcoreException if the angle is not a constant expression
+ */
+fp angleValue(const angle_t &angle);
+
+/** @brief Evaluating an angle of rotation without throwing
+ *
+ *
+ *  @param angle The angle of rotation
+ *  @param value The value of the angle in radian (set on success)
+ *  @return true if the angle is a constant expression
+ */
+bool tryAngleValue(const angle_t &angle, fp &value);
+
+/** @brief Formatting an angle of rotation as string readable by the QASM parser
+ *
+ * @details Multiples of pi/2^k are written symbolically (e.g. "pi", "pi/4"), other
+ *          values as fixed point decimals. The angle is normalized to [0, 2pi) first.
+ *
+ *  @param value The angle in radian
+ *  @return angle_t The formatted angle
+ */
+angle_t angleString(fp value);
+
+/** @brief Mapping an angle into [0, period)
+ *
+ *
+ *  @param value The angle in radian
+ *  @param period The period (Default 2pi)
+ *  @return fp The normalized angle, values within tolerance of the period map to 0
+ */
+fp normalizeAngle(fp value, fp period = 2 * PI);
+
+/** @brief Checking whether an angle is an integer multiple of a given unit
+ *
+ *
+ *  @param value The angle in radian
+ *  @param unit The unit angle
+ *  @param multiple The multiple, reduced modulo 2pi/unit (set on success)
+ *  @return true if the angle is a multiple of the unit
+ */
+bool isAngleMultiple(fp value, fp unit, std::int64_t &multiple);
+
+}  // namespace qcore
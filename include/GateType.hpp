@@ -336,7 +336,7 @@ inline std::string toString(const gate_t& gateType) {
  * @param gateType The gateType identifier for the given quantum gate type  
  * @return gate_t The inverse quantum gate type
  */
-inline gate_t inverseGateType(const gate_t& gateType) {
+constexpr gate_t inverseGateType(const gate_t& gateType) {
     switch (gateType) {
         case GateType::SRCCX:
             return GateType::SRCCXDG;
@@ -484,7 +484,7 @@ inline gate_t gateTypeFromString(const std::string& gateType) {
         return GateType::LCCX;
     }
     if (gateType == "lccxdg" || gateType == "15") {
-        return GateType::lccxdg;
+        return GateType::LCCXDG;
     }
     if (gateType == "rc3x" || gateType == "16") {
         return GateType::RC3X;
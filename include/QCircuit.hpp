@@ -106,6 +106,13 @@ class QCircuit {
      */
     void addQCircuit(QCircuit& qc);
 
+    /** @brief Merging a temporary quantum circuit (e.g. a decomposition)
+     *
+     *
+     *  @param qc The quantum circuit whose gates are moved
+     */
+    void addQCircuit(QCircuit&& qc);
+
     /** @brief Merging two quantum circuits
      *
      *
@@ -120,7 +127,7 @@ class QCircuit {
      *
      *  @return The inverse quantum circuit
      */
-    QCircuit& inverse();
+    QCircuit inverse();
 
     Cbit addCbit(Cbit& cbit);
 
@@ -163,6 +170,12 @@ class QCircuit {
         return this->properties;
     }
 
+    /** @brief Recomputing the gate summary, per-qubit depth and maximum gate size
+     *         from the current gate list (e.g. after a transformation pass)
+     *
+     */
+    void updateProperties();
+
     /*
     void readReal(std::istream& is);
     void addQGate(QGate&);
@@ -193,7 +206,7 @@ class QCircuit {
  *  @param qbit_sets the set of qubit sets
  *  @return the set of qubits
  */
-QubitSet &mergeQubits(const std::vector<QubitSet> &qbit_sets);
+QubitSet mergeQubits(const std::vector<QubitSet> &qbit_sets);
 
 /** @brief moving qubits from sources to destination eliminating duplicates.
  *
@@ -211,4 +224,12 @@ void moveQubits(QubitSet &dest, QubitSet &src);
  */
 void moveQGates(QGateSet &dest, QGateSet &src);
 
+/** @brief removing the released (null) entries from a set of quantum gates, preserving order.
+ *
+ *
+ *  @param gates the set of quantum gates
+ *  @return the number of removed entries
+ */
+gcount_t removeEmptyQGates(QGateSet &gates);
+
 }  // namespace qcore
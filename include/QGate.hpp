@@ -28,6 +28,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "Definition.hpp"
 #include "GateType.hpp"
 
@@ -55,7 +57,7 @@ struct QGateCompare {
  */
 class QGate {
    private:
-    static std::uint64_t gate_count;
+    static std::atomic<std::uint64_t> gate_count;
     gateid_t gate_id;
     gate_t gate_type;
     gsize_t gate_size;
@@ -63,7 +65,7 @@ class QGate {
     TargetSet targets{};
     RotationMap angles{};
     CbitSet cbits{};
-    is_classical flag;
+    is_classical flag = false;
     expression_t expression{};
 
    public:
@@ -122,7 +124,7 @@ class QGate {
      *
      *  @return The inverse quantum gate
      */
-    QGate& inverse();
+    QGate inverse();
 
     std::string toOpenQASM();
 
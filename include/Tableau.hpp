@@ -0,0 +1,150 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   Tableau.hpp
+ *  @brief  Stabilizer Tableau Representation of Clifford Circuits
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QGate.hpp"
+
+namespace qcore {
+
+/**
+ * @brief Aaronson-Gottesman tableau of an n-qubit Clifford operation
+ *
+ * @details Row i < n is the image C X_i C^dagger (destabilizer), row n + i the image
+ *          C Z_i C^dagger (stabilizer), each a Pauli string with a sign bit. The bits
+ *          are stored per qubit column, packed over the 2n rows into 64-bit words, so
+ *          a gate updates all rows with a few word operations on its columns; the
+ *          loops are plain enough for the compiler to vectorize them.
+ */
+class CliffordTableau {
+   private:
+    std::size_t qubits;
+    std::size_t words;
+    std::vector<std::uint64_t> x_bits;
+    std::vector<std::uint64_t> z_bits;
+    std::vector<std::uint64_t> r_bits;
+
+    inline std::uint64_t *xColumn(std::size_t q) { return this->x_bits.data() + q * this->words; }
+
+    inline std::uint64_t *zColumn(std::size_t q) { return this->z_bits.data() + q * this->words; }
+
+   public:
+    /**
+     * @brief Construct the tableau of the identity
+     *
+     * @param qubits The number of qubits
+     */
+    explicit CliffordTableau(std::size_t qubits = 0);
+
+    inline std::size_t size() const { return this->qubits; }
+
+    // X part of the Pauli string in row (0 <= row < 2n) on qubit q
+    inline bool xBit(std::size_t row, std::size_t q) const {
+        return ((this->x_bits[q * this->words + (row >> 6)] >> (row & 63)) & 1) != 0;
+    }
+
+    // Z part of the Pauli string in row (0 <= row < 2n) on qubit q
+    inline bool zBit(std::size_t row, std::size_t q) const {
+        return ((this->z_bits[q * this->words + (row >> 6)] >> (row & 63)) & 1) != 0;
+    }
+
+    // true if the Pauli string in row carries a minus sign
+    inline bool sign(std::size_t row) const { return ((this->r_bits[row >> 6] >> (row & 63)) & 1) != 0; }
+
+    // appending the named gate, i.e. conjugating every row by it
+    void h(std::size_t q);
+
+    void s(std::size_t q);
+
+    void sdg(std::size_t q);
+
+    void x(std::size_t q);
+
+    void y(std::size_t q);
+
+    void z(std::size_t q);
+
+    void cx(std::size_t control, std::size_t target);
+
+    void cz(std::size_t a, std::size_t b);
+
+    void cy(std::size_t control, std::size_t target);
+
+    void swap(std::size_t a, std::size_t b);
+
+    /**
+     * @brief Append a gate to the Clifford operation
+     *
+     * @param gate The quantum gate, on qubits below size()
+     * @return true if the gate is one of H, S, SDG, X, Y, Z, CX, CZ, SWAP and was applied
+     */
+    bool apply(QGate &gate);
+
+    /**
+     * @brief Check whether measuring a qubit of the state C|0...0> has a fixed outcome
+     *
+     * @param q The qubit
+     * @return true if no stabilizer has an X or Y on the qubit
+     */
+    bool isDeterministic(std::size_t q) const;
+
+    /**
+     * @brief Measure a qubit of the state C|0...0> in the computational basis
+     *
+     * @details A random outcome replaces the anticommuting stabilizer p by Z_q and
+     *          multiplies it into every other row with an X part on q; the phases of all
+     *          these rows are accumulated at once as bit-sliced counters modulo 4, one
+     *          column after the other. A fixed outcome is the sign of the product of the
+     *          stabilizers paired with the destabilizers having an X part on q, which is
+     *          summed per column from prefix parities and popcounts, without building
+     *          the product row.
+     *
+     *  @param q The qubit
+     *  @param coin The outcome taken if it is random
+     *  @return true if the outcome is 1
+     */
+    bool measure(std::size_t q, bool coin);
+
+    bool operator==(const CliffordTableau &other) const;
+};
+
+/** @brief Checking whether a gate can be tracked by a Clifford tableau
+ *
+ *
+ *  @param gate The quantum gate
+ *  @return true for unconditioned H, S, SDG, X, Y, Z, CX, CZ and SWAP gates
+ */
+bool isTableauGate(QGate &gate);
+
+}  // namespace qcore
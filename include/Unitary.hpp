@@ -0,0 +1,326 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Unitary.hpp
+ *  @brief  Matrix Representation of Quantum Gates
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <array>
+#include <complex>
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QGate.hpp"
+
+namespace qcore {
+
+using Complex = std::complex<fp>;
+
+// row-major 2x2 matrix {m00, m01, m10, m11}
+using Matrix2 = std::array<Complex, 4>;
+
+// row-major 4x4 matrix, qubit order |q1 q0> with q0 the least significant bit
+using Matrix4 = std::array<Complex, 16>;
+
+// 1/sqrt(2)
+static constexpr fp SQRT1_2 = static_cast<fp>(0.707106781186547524400844362104849039284835937688474036588L);
+
+// tolerance used when comparing matrix entries
+static constexpr fp MATRIX_TOLERANCE = static_cast<fp>(1e-9);
+
+static constexpr Matrix2 IDENTITY2{Complex{1, 0}, Complex{0, 0}, Complex{0, 0}, Complex{1, 0}};
+
+/** @brief Checking whether a gate type acts on its target(s) through a fixed 2x2 matrix
+ *
+ * @details True for unparameterized single-qubit gates and for controlled gates whose
+ *          target operation is unparameterized (e.g. CX, CCX, MCX act through X).
+ *
+ *  @param gateType The gate type
+ *  @return true if fixedMatrix(gateType) is defined
+ */
+constexpr bool hasFixedMatrix(const gate_t &gateType) {
+    switch (gateType) {
+        case GateType::I:
+        case GateType::X:
+        case GateType::CX:
+        case GateType::CCX:
+        case GateType::MCX:
+        case GateType::Y:
+        case GateType::CY:
+        case GateType::Z:
+        case GateType::CZ:
+        case GateType::H:
+        case GateType::CH:
+        case GateType::S:
+        case GateType::CS:
+        case GateType::SDG:
+        case GateType::CSDG:
+        case GateType::T:
+        case GateType::CT:
+        case GateType::TDG:
+        case GateType::CTDG:
+        case GateType::SX:
+        case GateType::CSX:
+        case GateType::V:
+        case GateType::CV:
+        case GateType::SXDG:
+        case GateType::CSXDG:
+        case GateType::VDG:
+        case GateType::CVDG:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** @brief Obtaining the 2x2 matrix applied to the target of an unparameterized gate type
+ *
+ *
+ *  @param gateType The gate type (see hasFixedMatrix)
+ *  @return Matrix2 The target matrix, the identity for types without a fixed matrix
+ */
+constexpr Matrix2 fixedMatrix(const gate_t &gateType) {
+    switch (gateType) {
+        case GateType::X:
+        case GateType::CX:
+        case GateType::CCX:
+        case GateType::MCX:
+            return {Complex{0, 0}, Complex{1, 0}, Complex{1, 0}, Complex{0, 0}};
+        case GateType::Y:
+        case GateType::CY:
+            return {Complex{0, 0}, Complex{0, -1}, Complex{0, 1}, Complex{0, 0}};
+        case GateType::Z:
+        case GateType::CZ:
+            return {Complex{1, 0}, Complex{0, 0}, Complex{0, 0}, Complex{-1, 0}};
+        case GateType::H:
+        case GateType::CH:
+            return {Complex{SQRT1_2, 0}, Complex{SQRT1_2, 0}, Complex{SQRT1_2, 0}, Complex{-SQRT1_2, 0}};
+        case GateType::S:
+        case GateType::CS:
+            return {Complex{1, 0}, Complex{0, 0}, Complex{0, 0}, Complex{0, 1}};
+        case GateType::SDG:
+        case GateType::CSDG:
+            return {Complex{1, 0}, Complex{0, 0}, Complex{0, 0}, Complex{0, -1}};
+        case GateType::T:
+        case GateType::CT:
+            return {Complex{1, 0}, Complex{0, 0}, Complex{0, 0}, Complex{SQRT1_2, SQRT1_2}};
+        case GateType::TDG:
+        case GateType::CTDG:
+            return {Complex{1, 0}, Complex{0, 0}, Complex{0, 0}, Complex{SQRT1_2, -SQRT1_2}};
+        case GateType::SX:
+        case GateType::CSX:
+        case GateType::V:
+        case GateType::CV:
+            return {Complex{0.5, 0.5}, Complex{0.5, -0.5}, Complex{0.5, -0.5}, Complex{0.5, 0.5}};
+        case GateType::SXDG:
+        case GateType::CSXDG:
+        case GateType::VDG:
+        case GateType::CVDG:
+            return {Complex{0.5, -0.5}, Complex{0.5, 0.5}, Complex{0.5, 0.5}, Complex{0.5, -0.5}};
+        default:
+            return IDENTITY2;
+    }
+}
+
+/** @brief Checking whether a gate type acts on its target through a parameterized 2x2 matrix
+ *
+ *
+ *  @param gateType The gate type
+ *  @return true for RX, RY, RZ, P, U1, U2, U3, U and their controlled forms
+ */
+bool hasRotationMatrix(const gate_t &gateType);
+
+/** @brief Obtaining the 2x2 matrix of a parameterized gate type
+ *
+ * @details The angles are taken in RotationType order, independent of the keys the
+ *          parser used (e.g. U1 stores LAMBDA while CU1 stores THETA). The optional
+ *          fourth angle of CU is the global phase of the target operation.
+ *
+ *  @param gateType The gate type (see hasRotationMatrix)
+ *  @param angles The angles of rotation
+ *  @return Matrix2 The target matrix
+ *  @throws QcoreException if an angle is missing or not a constant expression
+ */
+Matrix2 rotationMatrix(const gate_t &gateType, const RotationMap &angles);
+
+/** @brief Obtaining the 2x2 matrix a gate applies to its (single) target
+ *
+ *
+ *  @param gate The quantum gate
+ *  @param matrix The target matrix (set on success)
+ *  @return true if the gate acts on a single target through a known 2x2 matrix
+ */
+bool tryTargetMatrix(QGate &gate, Matrix2 &matrix);
+
+/** @brief Checking whether a gate is an unconditioned single-qubit unitary with known matrix
+ *
+ *
+ *  @param gate The quantum gate
+ *  @param matrix The gate matrix (set on success)
+ *  @return true if the gate can be treated as a plain 2x2 unitary
+ */
+bool trySingleQubitMatrix(QGate &gate, Matrix2 &matrix);
+
+/** @brief Multiplying two 2x2 matrices
+ *
+ *
+ *  @param lhs The left operand (applied last)
+ *  @param rhs The right operand (applied first)
+ *  @return Matrix2 The product lhs * rhs
+ */
+Matrix2 multiply(const Matrix2 &lhs, const Matrix2 &rhs);
+
+/** @brief Multiplying two 4x4 matrices
+ *
+ *
+ *  @param lhs The left operand (applied last)
+ *  @param rhs The right operand (applied first)
+ *  @return Matrix4 The product lhs * rhs
+ */
+Matrix4 multiply(const Matrix4 &lhs, const Matrix4 &rhs);
+
+/** @brief Obtaining the adjoint (conjugate transpose) of a 2x2 matrix
+ *
+ *
+ *  @param matrix The matrix
+ *  @return Matrix2 The adjoint
+ */
+Matrix2 adjoint(const Matrix2 &matrix);
+
+/** @brief Obtaining the adjoint (conjugate transpose) of a 4x4 matrix
+ *
+ *
+ *  @param matrix The matrix
+ *  @return Matrix4 The adjoint
+ */
+Matrix4 adjoint(const Matrix4 &matrix);
+
+/** @brief Obtaining the 4x4 matrix of two single-qubit operations applied in parallel
+ *
+ *
+ *  @param high The operation on the more significant qubit
+ *  @param low The operation on the less significant qubit
+ *  @return Matrix4 The Kronecker product high (x) low
+ */
+Matrix4 kron(const Matrix2 &high, const Matrix2 &low);
+
+/** @brief Obtaining the 4x4 matrix a gate applies to the qubit pair (low, high)
+ *
+ * @details Supported are single-qubit gates on either qubit, singly controlled gates
+ *          with a known target matrix, SWAP, ISWAP, RXX and RZZ.
+ *
+ *  @param gate The quantum gate
+ *  @param low The qubit mapped to the least significant bit
+ *  @param high The qubit mapped to the most significant bit
+ *  @param matrix The gate matrix (set on success)
+ *  @return true if the gate acts only on low and/or high through a known unitary
+ */
+bool tryTwoQubitMatrix(QGate &gate, const Qubit &low, const Qubit &high, Matrix4 &matrix);
+
+/** @brief Checking whether a 2x2 unitary is the identity up to a global phase
+ *
+ *
+ *  @param matrix The unitary
+ *  @param tolerance The comparison tolerance (Default MATRIX_TOLERANCE)
+ *  @return true if matrix = e^(i a) I for some a
+ */
+bool isIdentityUpToPhase(const Matrix2 &matrix, fp tolerance = MATRIX_TOLERANCE);
+
+/**
+ * @brief Euler angles of a single-qubit unitary
+ *
+ * @details U = e^(i phase) U3(theta, phi, lambda)
+ */
+struct EulerAngles {
+    fp theta = 0;
+    fp phi = 0;
+    fp lambda = 0;
+    fp phase = 0;
+};
+
+/** @brief Decomposing a 2x2 unitary into U3 Euler angles (ZYZ decomposition)
+ *
+ * @details The unitary is first scaled into SU(2). theta is obtained from atan2 of the
+ *          magnitudes of both columns, which stays accurate close to 0 and pi where acos
+ *          or asin based formulas lose precision. Degenerate phases are fixed to zero.
+ *
+ *  @param matrix The unitary
+ *  @return EulerAngles The angles with U = e^(i phase) U3(theta, phi, lambda)
+ */
+EulerAngles zyzDecomposition(const Matrix2 &matrix);
+
+/**
+ * @brief Cartan (KAK) decomposition of a two-qubit unitary
+ *
+ * @details U = e^(i phase) (after_high (x) after_low) Can(a, b, c) (before_high (x) before_low)
+ *          with Can(a, b, c) = exp(i (a XX + b YY + c ZZ)) and all local factors in SU(2).
+ */
+struct KAKDecomposition {
+    Matrix2 before_low = IDENTITY2;
+    Matrix2 before_high = IDENTITY2;
+    Matrix2 after_low = IDENTITY2;
+    Matrix2 after_high = IDENTITY2;
+    fp a = 0;
+    fp b = 0;
+    fp c = 0;
+    fp phase = 0;
+};
+
+/** @brief Decomposing a 4x4 unitary into local operations and a canonical interaction
+ *
+ * @details The unitary is scaled into SU(4) and transformed into the magic basis, where
+ *          local operations become real orthogonal matrices. U^T U is diagonalized by a
+ *          real orthogonal matrix (Jacobi iteration on a generic real combination of its
+ *          commuting real and imaginary parts); the square roots of its eigenvalues give
+ *          the canonical coordinates. The coordinates are not reduced to the Weyl chamber.
+ *
+ *  @param matrix The unitary, qubit order |high low>
+ *  @return KAKDecomposition The decomposition
+ *  @throws QcoreException if the matrix is not unitary within tolerance
+ */
+KAKDecomposition kakDecomposition(const Matrix4 &matrix);
+
+/** @brief Obtaining the matrix of the canonical two-qubit interaction
+ *
+ *
+ *  @param a The XX coefficient
+ *  @param b The YY coefficient
+ *  @param c The ZZ coefficient
+ *  @return Matrix4 exp(i (a XX + b YY + c ZZ))
+ */
+Matrix4 canonicalMatrix(fp a, fp b, fp c);
+
+/** @brief Obtaining the matrix of U3(theta, phi, lambda)
+ *
+ *
+ *  @param theta The polar angle
+ *  @param phi The first phase angle
+ *  @param lambda The second phase angle
+ *  @return Matrix2 The unitary
+ */
+Matrix2 u3Matrix(fp theta, fp phi, fp lambda);
+
+}  // namespace qcore
@@ -0,0 +1,126 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Batch.hpp
+ *  @brief  Specification of Concurrent Multi-File Circuit Analysis
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+
+namespace qcore {
+
+/**
+ * @brief Properties of a single analyzed circuit file
+ *
+ * @details The fields mirror the summary returned by circuitProperties in pyqcore.
+ *          A file that cannot be read or parsed has valid = false and carries the
+ *          reason in error, all other fields are zero in that case.
+ */
+struct CircuitSummary {
+    std::string file{};
+    bool valid = false;
+    std::string error{};
+    regsize_t qreg = 0;
+    regsize_t creg = 0;
+    depth_t depth = 0;
+    gcount_t gates = 0;
+    PropertiesMap properties{};
+};
+
+using BatchSummary = std::vector<CircuitSummary>;
+
+/** @brief Summarizing the properties of a quantum circuit
+ *
+ *
+ *  @param qc The quantum circuit
+ *  @return CircuitSummary The register sizes, depth and gate counts of the circuit
+ */
+CircuitSummary summarizeQCircuit(QCircuit &qc);
+
+/** @brief Collecting all QASM files below a directory
+ *
+ *
+ *  @param directory The input directory, searched recursively
+ *  @return The sorted list of paths with a .qasm extension
+ */
+std::vector<std::string> listQASMFiles(const std::string &directory);
+
+/** @brief Reading and analyzing a set of circuit files concurrently
+ *
+ * @details Files are parsed on a work-stealing thread pool. Every worker holds at
+ *          most one parsed circuit at a time and the number of queued files is
+ *          bounded, so memory does not grow with the number of input files beyond
+ *          the compact per-file summaries. Failures are recorded per file.
+ *
+ *  @param files The paths of the circuit files
+ *  @param threads The number of worker threads (Default 0 = hardware concurrency)
+ *  @return BatchSummary One summary per input file, in input order
+ */
+BatchSummary analyzeQCircuits(const std::vector<std::string> &files, std::size_t threads = 0);
+
+/** @brief Reading and analyzing every QASM file below a directory concurrently
+ *
+ *
+ *  @param directory The input directory, searched recursively
+ *  @param threads The number of worker threads (Default 0 = hardware concurrency)
+ *  @return BatchSummary One summary per QASM file, sorted by path
+ */
+BatchSummary analyzeQCircuitDirectory(const std::string &directory, std::size_t threads = 0);
+
+/** @brief Converting a circuit summary to JSON
+ *
+ *
+ *  @param summary The circuit summary
+ *  @return The JSON object {QuantumRegSize, ClassicalRegSize, GateSummary, CircuitDepth, ...}
+ */
+nlohmann::json toJSON(const CircuitSummary &summary);
+
+/** @brief Converting a batch summary to a JSON array with one object per file
+ *
+ *
+ *  @param summaries The batch summary
+ *  @return The JSON array
+ */
+nlohmann::json toJSON(const BatchSummary &summaries);
+
+/** @brief Converting a batch summary to a columnar JSON object
+ *
+ * @details Every property becomes an array with one entry per file. Gate counts
+ *          are stored per gate type under GateSummary, with zero for files that
+ *          do not contain the type. Error holds null for files parsed successfully.
+ *
+ *  @param summaries The batch summary
+ *  @return The JSON object of columns
+ */
+nlohmann::json toColumnarJSON(const BatchSummary &summaries);
+
+}  // namespace qcore
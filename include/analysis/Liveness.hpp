@@ -0,0 +1,107 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Liveness.hpp
+ *  @brief  Specification of Qubit Liveness Analysis
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+
+namespace qcore {
+
+/**
+ * @brief Positions at which every qubit of a circuit is touched
+ *
+ * @details Positions are gate indices of the analyzed gate list. Barriers do not
+ *          touch their qubits. Qubits start in |0> and a reset returns a qubit to
+ *          |0>, so a qubit is clean before its first use and after a reset until it
+ *          is used again; any qubit not touched by a gate can lend itself to that
+ *          gate as a dirty ancilla, preferably one that is idle around it.
+ */
+class QubitLiveness {
+   private:
+    std::vector<std::vector<std::size_t>> uses;  // per qubit, ascending
+    std::vector<std::vector<bool>> resets;       // per qubit use: whether it is a reset
+    std::size_t gates = 0;
+
+   public:
+    // position reported when there is no use
+    static constexpr std::size_t NO_USE = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * @brief Analyze a circuit
+     *
+     * @param qc The quantum circuit, the register grows to cover every gate operand
+     */
+    explicit QubitLiveness(QCircuit &qc);
+
+    inline regsize_t width() const { return this->uses.size(); }
+
+    /**
+     * @brief Obtaining the last use of a qubit before a position
+     *
+     * @param q The qubit
+     * @param position The gate index
+     * @return std::size_t The gate index of the use, NO_USE if there is none
+     */
+    std::size_t previousUse(Qubit q, std::size_t position) const;
+
+    /**
+     * @brief Obtaining the first use of a qubit after a position
+     *
+     * @param q The qubit
+     * @param position The gate index
+     * @return std::size_t The gate index of the use, NO_USE if there is none
+     */
+    std::size_t nextUse(Qubit q, std::size_t position) const;
+
+    /** @brief Checking whether a qubit is touched by the gate at a position */
+    bool isUsedAt(Qubit q, std::size_t position) const;
+
+    /** @brief Checking whether a qubit is known to be |0> right before the gate at a position */
+    bool isClean(Qubit q, std::size_t position) const;
+
+    /**
+     * @brief Selecting the ancillas a gate may use
+     *
+     * @details Clean ancillas are the qubits known |0> before the gate. Every other qubit
+     *          not touched by the gate is a dirty ancilla; those idle for longest around
+     *          the gate, i.e. with the widest gap between their previous and next use,
+     *          come first.
+     *
+     *  @param position The gate index
+     *  @param dirty The dirty ancillas, overwritten
+     *  @param clean The clean ancillas, overwritten
+     */
+    void ancillasAt(std::size_t position, QubitSet &dirty, QubitSet &clean) const;
+};
+
+}  // namespace qcore
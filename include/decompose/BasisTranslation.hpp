@@ -0,0 +1,187 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   BasisTranslation.hpp
+ *  @brief  Specification of the Basis Translator to Native Gate Sets
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+#include "decompose/Decompose.hpp"
+
+namespace qcore {
+
+// largest number of operands and angles of a fixed arity gate
+static constexpr std::size_t MAX_OPERANDS = 4;
+static constexpr std::size_t MAX_ANGLES = 4;
+
+/**
+ * @brief Angle of an equivalence step as an affine form of the source gate angles
+ *
+ * @details value = offset + sum_i scale[i] * angle_i, with the source angles taken in
+ *          RotationType order. Every equivalence of the library is affine in the
+ *          angles, so substituting one form into another stays a form.
+ */
+struct AngleForm {
+    fp offset = 0;
+    std::array<fp, MAX_ANGLES> scale{};
+};
+
+/**
+ * @brief Gate of an equivalence acting on relative operand slots
+ *
+ * @details Slots index the operands of the source gate in QASM order, i.e. controls
+ *          followed by targets.
+ */
+struct EquivalenceStep {
+    gate_t type = GateType::NONE;
+    std::array<std::uint8_t, MAX_OPERANDS> slots{};
+    std::array<AngleForm, MAX_ANGLES> angles{};
+};
+
+/**
+ * @brief Equivalence of a gate type to a sequence of gates, up to a global phase
+ */
+struct EquivalenceRule {
+    gate_t source = GateType::NONE;
+    std::vector<EquivalenceStep> steps{};
+};
+
+/** @brief Obtaining the number of qubits a gate type acts on
+ *
+ *
+ *  @param gateType The gate type
+ *  @return std::size_t The number of operands, 0 for MCX, BARRIER and IF, whose arity varies
+ */
+std::size_t operandCount(const gate_t &gateType);
+
+/** @brief Obtaining the number of angles of a gate type
+ *
+ *
+ *  @param gateType The gate type
+ *  @return std::size_t The number of angles, counting the optional global phase of CU
+ */
+std::size_t angleCount(const gate_t &gateType);
+
+/** @brief Checking whether a gate type belongs to a basis
+ *
+ * @details RZ counts as part of the Clifford+T basis, its angles being lowered to
+ *          powers of T when a circuit is translated.
+ *
+ *  @param gateType The gate type
+ *  @param basis The basis
+ *  @return true if the gate type is native to the basis
+ */
+bool inBasis(const gate_t &gateType, const DecompositionBasis &basis);
+
+/** @brief Obtaining the equivalence library
+ *
+ * @details qelib1 definitions and textbook identities between the gate types, e.g.
+ *          CU3 over U1, U3 and CX, RXX over H, RZ and CX, U3 over RZ and SX, SX over
+ *          H and S, and the Clifford+T templates of the Toffoli family.
+ *
+ *  @return The rules, several per source gate type
+ */
+const std::vector<EquivalenceRule> &equivalenceLibrary();
+
+/**
+ * @brief Gate templates of every gate type in one basis
+ *
+ * @details Built once from the equivalence library: the cost of a gate type is 1 inside
+ *          the basis and otherwise the least total cost over its rules (a fixed point),
+ *          and the rule reaching it is expanded recursively into a flat template of
+ *          basis gates. Translating a circuit then is a single linear pass that
+ *          instantiates one cached template per gate.
+ */
+class BasisTranslator {
+   private:
+    DecompositionBasis basis;
+    std::array<std::vector<EquivalenceStep>, GateType::TYPECOUNT> templates{};
+    std::array<bool, GateType::TYPECOUNT> resolved{};
+
+   public:
+    /**
+     * @brief Resolve the templates of a basis
+     *
+     * @param basis The target basis
+     */
+    explicit BasisTranslator(const DecompositionBasis &basis);
+
+    inline const DecompositionBasis &getBasis() const { return this->basis; }
+
+    inline bool supports(const gate_t &gateType) const { return this->resolved[gateType]; }
+
+    /**
+     * @brief Obtaining the template of a gate type
+     *
+     * @param gateType The gate type
+     * @return The basis gates over the operand slots of the gate type
+     * @throws QcoreException if the gate type cannot be expressed in the basis
+     */
+    const std::vector<EquivalenceStep> &templateOf(const gate_t &gateType) const;
+
+    /**
+     * @brief Translate a circuit into the basis
+     *
+     * @details Gates are replaced by their templates with the angles evaluated, the
+     *          classical condition of a gate being copied to every replacement gate.
+     *          Identity rotations are dropped. MCX gates are first decomposed with
+     *          ancillas found by qubit liveness. Resets, measurements and barriers are
+     *          kept. With a positive epsilon, Clifford+T angles that are no multiple of
+     *          pi/4 are approximated by synthesizeRotations with the default cache.
+     *
+     *  @param qc The quantum circuit to be translated in place
+     *  @param epsilon The operator norm error per approximated rotation (Default 0 = exact)
+     *  @return gcount_t The number of gates replaced
+     *  @throws QcoreException if an angle is symbolic or, for exact Clifford+T, not a multiple of pi/4
+     */
+    gcount_t translate(QCircuit &qc, fp epsilon = 0) const;
+};
+
+/** @brief Obtaining the translator of a basis, resolved on first use
+ *
+ *
+ *  @param basis The target basis
+ *  @return The shared translator
+ */
+const BasisTranslator &basisTranslator(const DecompositionBasis &basis);
+
+/** @brief Translating a circuit into a basis
+ *
+ *
+ *  @param qc The quantum circuit to be translated in place
+ *  @param basis The target basis
+ *  @param epsilon The operator norm error per approximated Clifford+T rotation (Default 0 = exact)
+ *  @return gcount_t The number of gates replaced
+ */
+gcount_t translate(QCircuit &qc, const DecompositionBasis &basis, fp epsilon = 0);
+
+}  // namespace qcore
@@ -28,12 +28,231 @@
 //need to check
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
 #include "Definition.hpp"
 #include "GateType.hpp"
 #include "QCircuit.hpp"
+#include "analysis/Liveness.hpp"
 
 namespace qcore {
 
+// operand slot of a single-qubit step, which has no control
+static constexpr std::uint8_t NO_SLOT = std::numeric_limits<std::uint8_t>::max();
+
+/**
+ * @brief Gate of a decomposition template acting on relative operand slots
+ *
+ * @details Slots index the operands of the decomposed gate in parameter order, e.g.
+ *          (c1, c2, t) for a Toffoli gate.
+ */
+struct DecompositionStep {
+    gate_t type;
+    std::uint8_t control;
+    std::uint8_t target;
+};
+
+template <std::size_t N>
+using DecompositionTable = std::array<DecompositionStep, N>;
+
+/** @brief Inverting a decomposition template at compile time
+ *
+ *
+ *  @param table The decomposition template
+ *  @return DecompositionTable<N> The steps in reverse order with inverse gate types
+ */
+template <std::size_t N>
+constexpr DecompositionTable<N> inverseTable(const DecompositionTable<N> &table) {
+    DecompositionTable<N> inverse{};
+    for (std::size_t i = 0; i < N; ++i) {
+        const DecompositionStep &step = table[N - 1 - i];
+        inverse[i] = DecompositionStep{inverseGateType(step.type), step.control, step.target};
+    }
+    return inverse;
+}
+
+/** @brief Counting the steps of a decomposition template with a given gate type
+ *
+ *
+ *  @param table The decomposition template
+ *  @param gateType The gate type
+ *  @return std::size_t The number of steps
+ */
+template <std::size_t N>
+constexpr std::size_t countSteps(const DecompositionTable<N> &table, const gate_t &gateType) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        count += (table[i].type == gateType) ? 1 : 0;
+    }
+    return count;
+}
+
+// Toffoli (c1, c2, t), Amy et al. Fig. 7(a)
+static constexpr DecompositionTable<15> CCX_CLIFFORD_T{{{GateType::H, NO_SLOT, 2},
+                                                        {GateType::TDG, NO_SLOT, 0},
+                                                        {GateType::TDG, NO_SLOT, 1},
+                                                        {GateType::CX, 2, 0},
+                                                        {GateType::T, NO_SLOT, 0},
+                                                        {GateType::CX, 1, 2},
+                                                        {GateType::T, NO_SLOT, 2},
+                                                        {GateType::CX, 1, 0},
+                                                        {GateType::TDG, NO_SLOT, 0},
+                                                        {GateType::CX, 1, 2},
+                                                        {GateType::CX, 2, 0},
+                                                        {GateType::T, NO_SLOT, 0},
+                                                        {GateType::TDG, NO_SLOT, 2},
+                                                        {GateType::CX, 1, 0},
+                                                        {GateType::H, NO_SLOT, 2}}};
+
+// relative phase Toffoli (c1, c2, t), Maslov Fig. 3
+static constexpr DecompositionTable<9> RCCX_CLIFFORD_T{{{GateType::H, NO_SLOT, 2},
+                                                        {GateType::T, NO_SLOT, 2},
+                                                        {GateType::CX, 1, 2},
+                                                        {GateType::TDG, NO_SLOT, 2},
+                                                        {GateType::CX, 0, 2},
+                                                        {GateType::T, NO_SLOT, 2},
+                                                        {GateType::CX, 1, 2},
+                                                        {GateType::TDG, NO_SLOT, 2},
+                                                        {GateType::H, NO_SLOT, 2}}};
+
+// relative phase Toffoli followed by V(c2, t), Maslov Fig. 3, gates 2-6
+static constexpr DecompositionTable<5> SRCCX_CLIFFORD_T{{{GateType::H, NO_SLOT, 2},
+                                                         {GateType::T, NO_SLOT, 2},
+                                                         {GateType::CX, 1, 2},
+                                                         {GateType::TDG, NO_SLOT, 2},
+                                                         {GateType::CX, 0, 2}}};
+
+// special form relative phase Toffoli followed by V(c1, t), Maslov Eq. 3
+static constexpr DecompositionTable<9> SSRCCX_CLIFFORD_T{{{GateType::H, NO_SLOT, 2},
+                                                          {GateType::CX, 2, 1},
+                                                          {GateType::TDG, NO_SLOT, 1},
+                                                          {GateType::CX, 0, 1},
+                                                          {GateType::T, NO_SLOT, 1},
+                                                          {GateType::CX, 2, 1},
+                                                          {GateType::TDG, NO_SLOT, 1},
+                                                          {GateType::CX, 0, 1},
+                                                          {GateType::T, NO_SLOT, 1}}};
+
+// 3-control relative phase Toffoli (c1, c2, c3, t), Maslov Fig. 4
+static constexpr DecompositionTable<18> RC3X_CLIFFORD_T{{{GateType::H, NO_SLOT, 3},
+                                                         {GateType::T, NO_SLOT, 3},
+                                                         {GateType::CX, 2, 3},
+                                                         {GateType::TDG, NO_SLOT, 3},
+                                                         {GateType::H, NO_SLOT, 3},
+                                                         {GateType::CX, 0, 3},
+                                                         {GateType::T, NO_SLOT, 3},
+                                                         {GateType::CX, 1, 3},
+                                                         {GateType::TDG, NO_SLOT, 3},
+                                                         {GateType::CX, 0, 3},
+                                                         {GateType::T, NO_SLOT, 3},
+                                                         {GateType::CX, 1, 3},
+                                                         {GateType::TDG, NO_SLOT, 3},
+                                                         {GateType::H, NO_SLOT, 3},
+                                                         {GateType::T, NO_SLOT, 3},
+                                                         {GateType::CX, 2, 3},
+                                                         {GateType::TDG, NO_SLOT, 3},
+                                                         {GateType::H, NO_SLOT, 3}}};
+
+// 3-control relative phase Toffoli followed by V(c2, c3, t), Maslov Fig. 4, dashed
+static constexpr DecompositionTable<10> SRC3X_CLIFFORD_T{{{GateType::H, NO_SLOT, 3},
+                                                          {GateType::T, NO_SLOT, 3},
+                                                          {GateType::CX, 2, 3},
+                                                          {GateType::TDG, NO_SLOT, 3},
+                                                          {GateType::H, NO_SLOT, 3},
+                                                          {GateType::CX, 0, 3},
+                                                          {GateType::T, NO_SLOT, 3},
+                                                          {GateType::CX, 1, 3},
+                                                          {GateType::TDG, NO_SLOT, 3},
+                                                          {GateType::CX, 0, 3}}};
+
+static constexpr auto CCXDG_CLIFFORD_T = inverseTable(CCX_CLIFFORD_T);
+static constexpr auto SRCCXDG_CLIFFORD_T = inverseTable(SRCCX_CLIFFORD_T);
+static constexpr auto SSRCCXDG_CLIFFORD_T = inverseTable(SSRCCX_CLIFFORD_T);
+static constexpr auto RC3XDG_CLIFFORD_T = inverseTable(RC3X_CLIFFORD_T);
+static constexpr auto SRC3XDG_CLIFFORD_T = inverseTable(SRC3X_CLIFFORD_T);
+
+/** @brief Instantiating a decomposition template on circuit qubits
+ *
+ * @details The destination is grown once by the template size and every step is
+ *          relabelled from slots to qubits and constructed in place in a single loop,
+ *          without intermediate gates or circuits.
+ *
+ *  @param steps The first step of the template
+ *  @param count The number of steps
+ *  @param qubits The circuit qubit of every slot
+ *  @param gates The destination gate list, appended to
+ */
+void instantiate(const DecompositionStep *steps, std::size_t count, const Qubit *qubits, QGateSet &gates);
+
+template <std::size_t N>
+inline void instantiate(const DecompositionTable<N> &table, const Qubit *qubits, QGateSet &gates) {
+    instantiate(table.data(), N, qubits, gates);
+}
+
+/** @brief Emitting a decomposition template into an output iterator
+ *
+ * @details Every step is relabelled from slots to qubits and written to the output as a
+ *          std::unique_ptr<QGate>. Mirrored emission walks the steps backwards with
+ *          inverse gate types, which realizes the inverse template without a table.
+ *
+ *  @param steps The first step of the template
+ *  @param count The number of steps
+ *  @param qubits The circuit qubit of every slot
+ *  @param out The output iterator
+ *  @param inverse The flag for emitting the mirrored (inverse) template (Default False)
+ *  @return OutputIt The output iterator past the last emitted gate
+ */
+template <typename OutputIt>
+OutputIt instantiate(const DecompositionStep *steps, std::size_t count, const Qubit *qubits, OutputIt out, bool inverse = false) {
+    for (std::size_t i = 0; i < count; ++i) {
+        const DecompositionStep &step = inverse ? steps[count - 1 - i] : steps[i];
+        const gate_t type = inverse ? inverseGateType(step.type) : step.type;
+        if (step.control == NO_SLOT) {
+            *out = std::make_unique<QGate>(type, 1, TargetSet{qubits[step.target]});
+        } else {
+            *out = std::make_unique<QGate>(type, 2, ControlSet{qubits[step.control]}, TargetSet{qubits[step.target]});
+        }
+        ++out;
+    }
+    return out;
+}
+
+template <std::size_t N, typename OutputIt>
+inline OutputIt instantiate(const DecompositionTable<N> &table, const Qubit *qubits, OutputIt out, bool inverse = false) {
+    return instantiate(table.data(), N, qubits, out, inverse);
+}
+
+/**
+ * @brief Decomposition template referenced by its first step
+ */
+struct DecompositionTemplate {
+    const DecompositionStep *steps = nullptr;
+    std::size_t count = 0;
+};
+
+/** @brief Obtaining the fixed Clifford+T template of a Toffoli-like gate type
+ *
+ *
+ *  @param gateType The gate type
+ *  @return DecompositionTemplate The template of CCX, RCCX, SRCCX(DG), SSRCCX(DG), RC3X and
+ *          SRC3X(DG), no steps for every other gate type
+ */
+DecompositionTemplate cliffordTTemplate(const gate_t &gateType);
+
+/** @brief Checking whether a gate is lowered by the Clifford+T decomposition
+ *
+ * @details Gates with a fixed template and the expected operands, and MCX gates with a
+ *          single target; classically controlled gates are never lowered.
+ *
+ *  @param gate The gate
+ *  @return true if decompose replaces the gate
+ */
+bool isLoweredToCliffordT(QGate &gate);
+
 /** @brief Decomposing a 2-control Toffoli gate using a set of Clifford+T gates
  *
  *
@@ -45,10 +264,17 @@ namespace qcore {
  *  @param c2 The 2nd control qubit
  *  @param t The target qubit
  *  @param inverse The inverse flag for performing inverse decompositon (Default False)
- *  @return Qcircuit& The decomposed 3-qubit quantum circuit realizing Toffoli operation using Clifford+T gates
+ *  @return QCircuit The decomposed 3-qubit quantum circuit realizing Toffoli operation using Clifford+T gates
  */
 
-QCircuit &decompose_CCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t, bool inverse = false);
+QCircuit decompose_CCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t, bool inverse = false);
+
+// the same decomposition emitted into an output iterator, without an intermediate circuit
+template <typename OutputIt>
+inline OutputIt decompose_CCX_Clifford_T(Qubit c1, Qubit c2, Qubit t, OutputIt out, bool inverse = false) {
+    const Qubit qubits[] = {c1, c2, t};
+    return instantiate(CCX_CLIFFORD_T, qubits, out, inverse);
+}
 
 /** @brief Decomposing a 2-control relative phase Toffoli gate using a set of Clifford+T gates
  *
@@ -58,9 +284,15 @@ QCircuit &decompose_CCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t, bool inverse
  *  @param c1 The 1st control qubit
  *  @param c2 The 2nd control qubit
  *  @param t The target qubit
- *  @return Qcircuit& The decomposed 3-qubit quantum circuit realizing relative phase Toffoli operation using Clifford+T gates
+ *  @return QCircuit The decomposed 3-qubit quantum circuit realizing relative phase Toffoli operation using Clifford+T gates
  */
-QCircuit &decompose_RCCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t);  // self inverse
+QCircuit decompose_RCCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t);  // self inverse
+
+template <typename OutputIt>
+inline OutputIt decompose_RCCX_Clifford_T(Qubit c1, Qubit c2, Qubit t, OutputIt out) {
+    const Qubit qubits[] = {c1, c2, t};
+    return instantiate(RCCX_CLIFFORD_T, qubits, out);
+}
 
 /** @brief Decomposing a 2-control relative phase Toffoli gate followed by a V (square root of NOT) gate using a set of Clifford+T gates
  *
@@ -71,9 +303,15 @@ QCircuit &decompose_RCCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t);  // self in
  *  @param c2 The 2nd control qubit
  *  @param t The target qubit [V(c2,t)]
  *  @param inverse The inverse flag for performing inverse decompositon (Default False)
- *  @return Qcircuit& The decomposed 3-qubit quantum circuit realizing relative phase Toffoli operation using Clifford+T gates
+ *  @return QCircuit The decomposed 3-qubit quantum circuit realizing relative phase Toffoli operation using Clifford+T gates
  */
-QCircuit &decompose_SRCCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t, bool inverse = false);
+QCircuit decompose_SRCCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t, bool inverse = false);
+
+template <typename OutputIt>
+inline OutputIt decompose_SRCCX_Clifford_T(Qubit c1, Qubit c2, Qubit t, OutputIt out, bool inverse = false) {
+    const Qubit qubits[] = {c1, c2, t};
+    return instantiate(SRCCX_CLIFFORD_T, qubits, out, inverse);
+}
 
 /** @brief Decomposing a 2-control special form relative phase Toffoli gate followed by a V (square root of NOT) gate using a set of Clifford+T gates
  *
@@ -84,22 +322,36 @@ QCircuit &decompose_SRCCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t, bool invers
  *  @param c2 The 2nd control qubit
  *  @param t The target qubit [V(c1,t)]
  *  @param inverse The inverse flag for performing inverse decompositon (Default False)
- *  @return Qcircuit& The decomposed 3-qubit quantum circuit realizing relative phase Toffoli operation using Clifford+T gates
+ *  @return QCircuit The decomposed 3-qubit quantum circuit realizing relative phase Toffoli operation using Clifford+T gates
  */
-QCircuit &decompose_SSRCCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t, bool inverse = false);
+QCircuit decompose_SSRCCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t, bool inverse = false);
+
+template <typename OutputIt>
+inline OutputIt decompose_SSRCCX_Clifford_T(Qubit c1, Qubit c2, Qubit t, OutputIt out, bool inverse = false) {
+    const Qubit qubits[] = {c1, c2, t};
+    return instantiate(SSRCCX_CLIFFORD_T, qubits, out, inverse);
+}
 
 /** @brief Decomposing a 3-control relative phase Toffoli gate using a set of Clifford+T gates
  *
  * @details Dmitri, Maslov. "On the advantages of using relative phase Toffolis with an application to
- *          multiple control Toffoli optimization." Phys. Rev. A 93 (2015). Fig. 4 (Identical Inverse)
+ *          multiple control Toffoli optimization." Phys. Rev. A 93 (2015). Fig. 4. The relative phases
+ *          are +-i, so unlike RCCX the gate is not its own inverse.
  * 
  *  @param c1 The 1st control qubit
  *  @param c2 The 2nd control qubit
  *  @param c3 The 3rd control qubit
  *  @param t The target qubit
- *  @return Qcircuit& The decomposed 4-qubit quantum circuit realizing a 3-control relative phase Toffoli operation using Clifford+T gates
+ *  @param inverse The inverse flag for performing inverse decompositon (Default False)
+ *  @return QCircuit The decomposed 4-qubit quantum circuit realizing a 3-control relative phase Toffoli operation using Clifford+T gates
  */
-QCircuit &decompose_RC3X_Clifford_T(Qubit &c1, Qubit &c2, Qubit &c3, Qubit &t);  // self inverse
+QCircuit decompose_RC3X_Clifford_T(Qubit &c1, Qubit &c2, Qubit &c3, Qubit &t, bool inverse = false);
+
+template <typename OutputIt>
+inline OutputIt decompose_RC3X_Clifford_T(Qubit c1, Qubit c2, Qubit c3, Qubit t, OutputIt out, bool inverse = false) {
+    const Qubit qubits[] = {c1, c2, c3, t};
+    return instantiate(RC3X_CLIFFORD_T, qubits, out, inverse);
+}
 
 /** @brief Decomposing a 3-control relative phase Toffoli gate followed by a V gate using a set of Clifford+T gates
  *
@@ -111,22 +363,154 @@ QCircuit &decompose_RC3X_Clifford_T(Qubit &c1, Qubit &c2, Qubit &c3, Qubit &t);
  *  @param c3 The 3rd control qubit
  *  @param t The target qubit [V(c2, c3, t)]
  *  @param inverse The inverse flag for performing inverse decompositon (Default False)
- *  @return Qcircuit& The decomposed 4-qubit quantum circuit realizing a 3-control relative phase Toffoli operation using Clifford+T gates
+ *  @return QCircuit The decomposed 4-qubit quantum circuit realizing a 3-control relative phase Toffoli operation using Clifford+T gates
  */
-QCircuit &decompose_SRC3X_Clifford_T(Qubit &c1, Qubit &c2, Qubit &c3, Qubit &t, bool inverse = false);
+QCircuit decompose_SRC3X_Clifford_T(Qubit &c1, Qubit &c2, Qubit &c3, Qubit &t, bool inverse = false);
+
+template <typename OutputIt>
+inline OutputIt decompose_SRC3X_Clifford_T(Qubit c1, Qubit c2, Qubit c3, Qubit t, OutputIt out, bool inverse = false) {
+    const Qubit qubits[] = {c1, c2, c3, t};
+    return instantiate(SRC3X_CLIFFORD_T, qubits, out, inverse);
+}
 
 /** @brief Decomposing a multi-control Toffoli gate using a set of Clifford+T gates
  *
  * @details Dmitri, Maslov. "On the advantages of using relative phase Toffolis with an application to
- *          multiple control Toffoli optimization." Phys. Rev. A 93 (2015).
+ *          multiple control Toffoli optimization." Phys. Rev. A 93 (2015). With ceil((k - 2) / 2) clean
+ *          ancillas the k controls are accumulated by a ladder of RC3X (and RCCX) gates, the target is
+ *          flipped by a Toffoli gate and the ladder is uncomputed. Otherwise, Barenco, Adriano, et al.
+ *          "Elementary gates for quantum computation." Phys. Rev. A 52.5 (1995): 3457. Lemma 7.2 with
+ *          k - 2 ancillas in any state, whose inner Toffoli gates are relative phase ones, or Lemma 7.3,
+ *          splitting the controls over a single ancilla and borrowing the idle halves. Among the
+ *          strategies the ancillas allow, the one with the lowest T-count, then depth is taken.
  *
  *  @param controls The set of control qubits
  *  @param t The target qubit
  *  @param dirty The set of dirty ancilla qubits
  *  @param clean The set of clean ancilla qubits
  *  @param inverse The inverse flag for performing inverse decompositon (Default False)
- *  @return Qcircuit& The decomposed quantum circuit realizing a multi-control control Toffoli operation using Clifford+T gates.
+ *  @return QCircuit The decomposed quantum circuit realizing a multi-control control Toffoli operation using Clifford+T gates.
+ *  @throws QcoreException if three or more controls come without any ancilla
+ */
+QCircuit decompose_MCT_Clifford_T(QubitSet &controls, Qubit target, QubitSet &dirty, QubitSet &clean, bool inverse = false);  // Cliffort + T decomposition
+
+/** @brief Decomposing a multi-control Toffoli gate of a circuit with ancillas found by liveness analysis
+ *
+ * @details Qubits known |0> before the gate serve as clean ancillas, all other qubits of
+ *          the register outside the gate as dirty ones, the longest idle first, so no
+ *          qubit is added to the circuit.
+ *
+ *  @param controls The set of control qubits
+ *  @param target The target qubit
+ *  @param liveness The liveness of the circuit qubits
+ *  @param position The gate index of the multi-control Toffoli gate in the analyzed circuit
+ *  @param inverse The inverse flag for performing inverse decompositon (Default False)
+ *  @return QCircuit The decomposed quantum circuit realizing the multi-control Toffoli operation using Clifford+T gates
+ *  @throws QcoreException if three or more controls span the whole register
+ */
+QCircuit decompose_MCT_Clifford_T(QubitSet &controls, Qubit target, const QubitLiveness &liveness, std::size_t position, bool inverse = false);
+
+/** @brief Appending the Clifford+T decomposition of a multi-control Toffoli gate to a gate list
+ *
+ * @details Same decomposition as decompose_MCT_Clifford_T without an intermediate circuit.
+ *
+ *  @param controls The set of control qubits
+ *  @param target The target qubit
+ *  @param dirty The set of dirty ancilla qubits
+ *  @param clean The set of clean ancilla qubits
+ *  @param gates The destination gate list, appended to
+ *  @param inverse The inverse flag for performing inverse decompositon (Default False)
+ *  @throws QcoreException if three or more controls come without any ancilla
+ */
+void instantiateMCT(const QubitSet &controls, Qubit target, const QubitSet &dirty, const QubitSet &clean, QGateSet &gates, bool inverse = false);
+
+/**
+ * @brief Template instance of a multi-control Toffoli decomposition plan
+ *
+ * @details The inverse template, instantiated in reverse plan order, yields the
+ *          mirrored (inverse) decomposition.
+ */
+struct MCTPlanStep {
+    const DecompositionStep *steps;
+    const DecompositionStep *inverse;
+    std::size_t count;
+    std::array<Qubit, 4> qubits;
+};
+
+/**
+ * @brief Non-owning reference to a callable receiving the steps of a plan
+ *
+ * @details The callable is invoked with every MCTPlanStep in emission order and must
+ *          outlive the sink. Nothing is copied or allocated.
+ */
+class MCTPlanSink {
+   private:
+    void *callable;
+    void (*invoke)(void *, const MCTPlanStep &);
+
+   public:
+    template <typename F>
+    explicit MCTPlanSink(F &callable)
+        : callable(&callable), invoke([](void *f, const MCTPlanStep &step) { (*static_cast<F *>(f))(step); }) {}
+
+    inline void operator()(const MCTPlanStep &step) const { this->invoke(this->callable, step); }
+};
+
+/** @brief Planning the Clifford+T decomposition of a multi-control Toffoli gate
+ *
+ * @details The plan instantiateMCT expands, one template instance per step, so the
+ *          gates can be counted or streamed without being constructed. The strategies
+ *          are costed by streaming them into counters and only the chosen one reaches
+ *          the sink; the mirrored plan is emitted directly in reverse order with
+ *          inverse templates.
+ *
+ *  @param controls The set of control qubits
+ *  @param target The target qubit
+ *  @param dirty The set of dirty ancilla qubits
+ *  @param clean The set of clean ancilla qubits
+ *  @param sink The receiver of the plan steps
+ *  @param inverse The inverse flag for emitting the mirrored plan (Default False)
+ *  @throws QcoreException if three or more controls come without any ancilla
+ */
+void planMCT(const QubitSet &controls, Qubit target, const QubitSet &dirty, const QubitSet &clean, MCTPlanSink sink, bool inverse = false);
+
+inline void planMCT(const QubitSet &controls, Qubit target, const QubitSet &dirty, const QubitSet &clean, std::vector<MCTPlanStep> &plan) {
+    auto append = [&plan](const MCTPlanStep &step) { plan.push_back(step); };
+    planMCT(controls, target, dirty, clean, MCTPlanSink(append));
+}
+
+/** @brief Emitting the Clifford+T decomposition of a multi-control Toffoli gate into an output iterator
+ *
+ * @details Same decomposition as decompose_MCT_Clifford_T; the gates are constructed at
+ *          the output, which is the only memory allocated.
+ *
+ *  @param controls The set of control qubits
+ *  @param target The target qubit
+ *  @param dirty The set of dirty ancilla qubits
+ *  @param clean The set of clean ancilla qubits
+ *  @param out The output iterator
+ *  @param inverse The inverse flag for performing inverse decompositon (Default False)
+ *  @return OutputIt The output iterator past the last emitted gate
+ *  @throws QcoreException if three or more controls come without any ancilla
+ */
+template <typename OutputIt>
+OutputIt decompose_MCT_Clifford_T(const QubitSet &controls, Qubit target, const QubitSet &dirty, const QubitSet &clean, OutputIt out,
+                                  bool inverse = false) {
+    auto emit = [&out](const MCTPlanStep &step) { out = instantiate(step.steps, step.count, step.qubits.data(), out); };
+    planMCT(controls, target, dirty, clean, MCTPlanSink(emit), inverse);
+    return out;
+}
+
+/** @brief Counting the gates of the Clifford+T decomposition of a multi-control Toffoli gate
+ *
+ *
+ *  @param controls The set of control qubits
+ *  @param target The target qubit
+ *  @param dirty The set of dirty ancilla qubits
+ *  @param clean The set of clean ancilla qubits
+ *  @return std::size_t The number of gates instantiateMCT appends
+ *  @throws QcoreException if three or more controls come without any ancilla
  */
-QCircuit &decompose_MCT_Clifford_T(QubitSet &controls, Qubit target, QubitSet &dirty, QubitSet &clean, bool inverse = false);  // Cliffort + T decomposition
+std::size_t countMCT(const QubitSet &controls, Qubit target, const QubitSet &dirty, const QubitSet &clean);
 
 }  // namespace qcore
\ No newline at end of file
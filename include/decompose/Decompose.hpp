@@ -0,0 +1,68 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Decompose.hpp
+ *  @brief  Specification of Whole-circuit Gate Decomposition
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+
+namespace qcore {
+
+/**
+ * @brief Target gate set of a decomposition
+ */
+enum class DecompositionBasis : std::uint8_t {
+    CLIFFORD_T,  // H, S, SDG, T, TDG, X, CX
+    RZ_SX_X_CX,  // RZ, SX, X, CX
+    U3_CX        // U3, CX
+};
+
+/** @brief Decomposing every multi-qubit Toffoli-like gate of a circuit into a basis
+ *
+ * @details CCX, RCCX, SRCCX(DG), SSRCCX(DG), RC3X, SRC3X(DG) and MCX gates are lowered
+ *          with the Clifford+T templates; MCX gates take their ancillas from the qubits of
+ *          the register that are known |0> (clean) or idle (dirty) around them by qubit
+ *          liveness analysis. Classically controlled gates and all other gates
+ *          are kept. The gate list is cut into disjoint ranges that are lowered on the
+ *          thread pool into per-range buffers reserved to their exact size; the range
+ *          offsets are then known up front and the buffers are moved into a single
+ *          allocation of the final gate list.
+ *
+ *  @param qc The quantum circuit to be decomposed in place
+ *  @param basis The target gate set, only Clifford+T (Default), see translate for the others
+ *  @param threads The number of worker threads (Default 0 = hardware concurrency)
+ *  @return gcount_t The number of gates decomposed
+ *  @throws QcoreException if an MCX gate with three or more controls spans the whole register
+ *          or the basis is not Clifford+T
+ */
+gcount_t decompose(QCircuit &qc, const DecompositionBasis &basis = DecompositionBasis::CLIFFORD_T, std::size_t threads = 0);
+
+}  // namespace qcore
@@ -0,0 +1,159 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   DecomposedView.hpp
+ *  @brief  Specification of the Lazy Clifford+T Decomposition View
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <array>
+#include <iterator>
+#include <ostream>
+#include <vector>
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+#include "analysis/Liveness.hpp"
+#include "decompose/Clifford_T.hpp"
+
+namespace qcore {
+
+/**
+ * @brief Gate of a decomposed circuit as seen through a view
+ *
+ * @details A lowered gate is a single-qubit or CX step of the template of its source
+ *          gate. Gates that are not lowered are passed through: only type and source
+ *          are set, and the source carries operands, angles and classical condition.
+ */
+struct DecomposedGate {
+    gate_t type = GateType::NONE;
+    Qubit control = 0;
+    Qubit target = 0;
+    bool controlled = false;
+    bool lowered = false;
+    QGate *source = nullptr;
+};
+
+/**
+ * @brief Clifford+T decomposition of a circuit expanded on the fly
+ *
+ * @details Iteration yields the gates decompose would produce, in the same order and
+ *          with the same ancillas, expanding one macro gate at a time from its
+ *          template or multi-control Toffoli plan; nothing is materialized. Counting
+ *          fast-forwards over whole templates and plans. The view holds the liveness of
+ *          the circuit, linear in its size, and is invalidated by changes to the
+ *          circuit.
+ */
+class DecomposedView {
+   private:
+    QCircuit *qc;
+    QubitLiveness liveness;
+
+   public:
+    class const_iterator {
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = DecomposedGate;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const DecomposedGate *;
+        using reference = const DecomposedGate &;
+
+       private:
+        const DecomposedView *view = nullptr;
+        std::size_t position = 0;
+        std::vector<MCTPlanStep> plan{};  // expansion of the gate at position, reused
+        std::size_t step = 0;
+        std::size_t offset = 0;
+        DecomposedGate current{};
+
+        void load();
+
+        void settle();
+
+       public:
+        const_iterator() = default;
+
+        const_iterator(const DecomposedView *view, std::size_t position);
+
+        inline const DecomposedGate &operator*() const { return this->current; }
+
+        inline const DecomposedGate *operator->() const { return &this->current; }
+
+        const_iterator &operator++();
+
+        inline bool operator==(const const_iterator &other) const {
+            return this->position == other.position && this->step == other.step && this->offset == other.offset;
+        }
+
+        inline bool operator!=(const const_iterator &other) const { return !(*this == other); }
+    };
+
+    /**
+     * @brief Construct a view over a circuit
+     *
+     * @param qc The quantum circuit, which must outlive the view
+     */
+    explicit DecomposedView(QCircuit &qc);
+
+    inline const_iterator begin() const { return const_iterator(this, 0); }
+
+    inline const_iterator end() const { return const_iterator(this, this->qc->getGates().size()); }
+
+    /**
+     * @brief Counting the gates of the decomposed circuit
+     *
+     * @return gcount_t The number of gates, computed per input gate
+     * @throws QcoreException if an MCX gate with three or more controls spans the whole register
+     */
+    gcount_t size() const;
+
+    /**
+     * @brief Counting the gates of the decomposed circuit by type
+     *
+     * @details Every template is counted once per call and looked up afterwards.
+     *
+     *  @return The number of gates of every gate type
+     *  @throws QcoreException if an MCX gate with three or more controls spans the whole register
+     */
+    std::array<gcount_t, GateType::TYPECOUNT> histogram() const;
+
+    inline gcount_t count(const gate_t &gateType) const { return histogram()[gateType]; }
+
+    inline gcount_t tCount() const {
+        const auto counts = histogram();
+        return counts[GateType::T] + counts[GateType::TDG];
+    }
+
+    /**
+     * @brief Writing the decomposed circuit as OpenQASM 2.0
+     *
+     * @param os The output stream, written gate by gate
+     */
+    void writeQASM(std::ostream &os) const;
+};
+
+}  // namespace qcore
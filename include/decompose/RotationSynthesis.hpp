@@ -0,0 +1,164 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   RotationSynthesis.hpp
+ *  @brief  Specification of the Approximate Clifford+T Synthesis of Z Rotations
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+
+namespace qcore {
+
+// smallest supported approximation error, bounded by the extended precision of the search
+static constexpr fp MIN_SYNTHESIS_EPSILON = static_cast<fp>(1e-8);
+
+// approximation error used by the synthesize_rotations pass
+static constexpr fp DEFAULT_SYNTHESIS_EPSILON = static_cast<fp>(1e-6);
+
+// single-qubit Clifford+T gates (H, S, SDG, T, TDG, X) in the order they are applied
+using CliffordTWord = std::vector<gate_t>;
+
+/** @brief Synthesizing a Z rotation over Clifford+T
+ *
+ * @details Number-theoretic synthesis after Ross and Selinger. For growing exponents k
+ *          the top-left entry u = w / sqrt2^k, w in Z[omega], is searched in the slice
+ *          of the unit disk within epsilon of exp(-i angle / 2) while the
+ *          sqrt2-conjugate of u stays in the unit disk, the two-dimensional search
+ *          being split into one-dimensional grid problems over Z[sqrt2]. For every
+ *          candidate the norm equation t^dagger t = 1 - u^dagger u is solved when its
+ *          integer norm is, up to powers of 2, a prime of the form 8m + 1 and the exact
+ *          unitary [[u, -t^dagger], [t, u^dagger]] is decomposed with the
+ *          Kliuchnikov-Maslov-Mosca reduction. Multiples of pi/4 are returned exactly.
+ *
+ *  @param angle The angle of rotation in radian
+ *  @param epsilon The operator norm error allowed up to a global phase
+ *  @return CliffordTWord The gates realizing RZ(angle) up to a global phase
+ *  @throws QcoreException if epsilon is not in [MIN_SYNTHESIS_EPSILON, 1)
+ */
+CliffordTWord synthesizeRZ(fp angle, fp epsilon);
+
+/**
+ * @brief Memoized Z rotation synthesis keyed by (angle, epsilon)
+ *
+ * @details Angles are normalized to [0, 2pi) before lookup. With a cache file, the
+ *          entries of the file are loaded on construction and every new synthesis
+ *          is appended to it, so later processes start warm. Lookups may run
+ *          concurrently; a miss synthesizes outside the lock.
+ */
+class RZSynthesisCache {
+   private:
+    using key_t = std::pair<std::uint64_t, std::uint64_t>;
+
+    struct KeyHash {
+        std::size_t operator()(const key_t &key) const;
+    };
+
+    mutable std::shared_mutex lock{};
+    std::unordered_map<key_t, CliffordTWord, KeyHash> words{};
+    std::string file{};
+
+    static key_t keyOf(fp angle, fp epsilon);
+
+    const CliffordTWord &store(const std::vector<std::pair<key_t, CliffordTWord>> &entries);
+
+   public:
+    /**
+     * @brief Construct a cache
+     *
+     * @param file The cache file, loaded if it exists (Default "" = in memory only)
+     */
+    explicit RZSynthesisCache(const std::string &file = "");
+
+    /**
+     * @brief Obtaining the synthesis of a Z rotation, synthesizing it on a miss
+     *
+     * @param angle The angle of rotation in radian
+     * @param epsilon The operator norm error
+     * @return const CliffordTWord& The cached gates, valid as long as the cache
+     */
+    const CliffordTWord &lookup(fp angle, fp epsilon);
+
+    /**
+     * @brief Synthesize the missing angles in parallel
+     *
+     * @param angles The angles of rotation, duplicates allowed
+     * @param epsilon The operator norm error
+     * @param threads The number of worker threads (Default 0 = hardware concurrency)
+     * @return std::size_t The number of angles synthesized
+     */
+    std::size_t prefetch(const std::vector<fp> &angles, fp epsilon, std::size_t threads = 0);
+
+    bool contains(fp angle, fp epsilon) const;
+
+    std::size_t size() const;
+
+    inline const std::string &getFile() const { return this->file; }
+};
+
+/** @brief Obtaining the process-wide in-memory synthesis cache
+ *
+ *
+ *  @return RZSynthesisCache& The shared cache
+ */
+RZSynthesisCache &defaultSynthesisCache();
+
+/** @brief Replacing Z rotations by Clifford+T approximations
+ *
+ * @details Every RZ, P and U1 gate is replaced by its cached synthesis, the classical
+ *          condition being copied to every replacement gate; multiples of pi/4 become
+ *          exact phase gates. The distinct angles missing in the cache are
+ *          synthesized in parallel first.
+ *
+ *  @param qc The quantum circuit to be rewritten in place
+ *  @param epsilon The operator norm error per rotation
+ *  @param cache The synthesis cache
+ *  @param threads The number of worker threads (Default 0 = hardware concurrency)
+ *  @return gcount_t The number of rotations replaced
+ *  @throws QcoreException if an angle is symbolic
+ */
+gcount_t synthesizeRotations(QCircuit &qc, fp epsilon, RZSynthesisCache &cache, std::size_t threads = 0);
+
+/** @brief Replacing Z rotations by Clifford+T approximations using the default cache
+ *
+ *
+ *  @param qc The quantum circuit to be rewritten in place
+ *  @param epsilon The operator norm error per rotation (Default DEFAULT_SYNTHESIS_EPSILON)
+ *  @param threads The number of worker threads (Default 0 = hardware concurrency)
+ *  @return gcount_t The number of rotations replaced
+ */
+gcount_t synthesizeRotations(QCircuit &qc, fp epsilon = DEFAULT_SYNTHESIS_EPSILON, std::size_t threads = 0);
+
+}  // namespace qcore
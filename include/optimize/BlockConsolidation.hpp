@@ -0,0 +1,76 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   BlockConsolidation.hpp
+ *  @brief  Specification of the Two-Qubit Block Consolidation Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+#include "Unitary.hpp"
+
+namespace qcore {
+
+/** @brief Obtaining the number of CX gates needed to realize a gate on two qubits
+ *
+ *
+ *  @param gate The quantum gate
+ *  @return gcount_t The CX cost, 0 for single-qubit gates
+ */
+gcount_t cxCost(QGate &gate);
+
+/** @brief Synthesizing a two-qubit unitary with at most 3 CX gates and U3 gates
+ *
+ * @details The KAK coordinates are reduced modulo pi/2 (the remainders are Pauli
+ *          products absorbed into the local gates). The number of coordinates that
+ *          vanish decides between the 0, 1, 2 and 3 CX circuits of the canonical
+ *          interaction; all CX gates use low as control. Local layers are emitted as
+ *          single U3 gates, identities are skipped.
+ *
+ *  @param matrix The unitary, qubit order |high low>
+ *  @param low The qubit mapped to the least significant bit
+ *  @param high The qubit mapped to the most significant bit
+ *  @return QGateSet The gates realizing the unitary up to global phase
+ */
+QGateSet synthesizeTwoQubitUnitary(const Matrix4 &matrix, const Qubit &low, const Qubit &high);
+
+/** @brief Consolidating maximal two-qubit blocks and resynthesizing them with KAK
+ *
+ * @details A block collects consecutive gates acting on the same pair of qubits
+ *          (including single-qubit gates directly before its first two-qubit gate)
+ *          and ends at the first other gate touching one of them. The 4x4 unitaries
+ *          of the blocks are built and resynthesized concurrently; a block is replaced
+ *          only if the resynthesis uses fewer CX gates than its cxCost.
+ *
+ *  @param qc The quantum circuit to be optimized in place
+ *  @param threads The number of worker threads (Default 0 = hardware concurrency)
+ *  @return gcount_t The reduction of the CX cost
+ */
+gcount_t consolidateTwoQubitBlocks(QCircuit &qc, std::size_t threads = 0);
+
+}  // namespace qcore
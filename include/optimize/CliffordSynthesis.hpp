@@ -0,0 +1,67 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   CliffordSynthesis.hpp
+ *  @brief  Specification of the Tableau-based Clifford Resynthesis Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+#include "Tableau.hpp"
+
+namespace qcore {
+
+/** @brief Synthesizing a canonical Clifford circuit for a tableau (Aaronson-Gottesman)
+ *
+ * @details The tableau is reduced to the identity qubit by qubit: a SWAP and/or H makes
+ *          the X part of destabilizer i nonzero on qubit i, CX and S gates clear the rest
+ *          of destabilizer i, then CX, H and S gates clear stabilizer i. Z and X gates fix
+ *          the remaining signs. The inverse of the reducing gates realizes the tableau
+ *          exactly (up to global phase) with O(n^2) gates over H, S, SDG, X, Z, CX, SWAP.
+ *
+ *  @param tableau The tableau of the Clifford operation
+ *  @param qubits The circuit qubits, qubits[i] being tableau qubit i
+ *  @return QGateSet The gates in circuit order
+ */
+QGateSet synthesizeClifford(CliffordTableau tableau, const QubitSet &qubits);
+
+/** @brief Resynthesizing maximal Clifford subcircuits from their stabilizer tableaux
+ *
+ * @details A subcircuit collects H, S, SDG, X, Y, Z, CX, CZ and SWAP gates from its first
+ *          gate on until such a gate touches a qubit that a gate outside the subcircuit
+ *          used in between. Its tableau is resynthesized, cleaned up by inverse-pair
+ *          cancellation and phase merging, and replaces the subcircuit at the position of
+ *          its first gate when it needs fewer CNOTs (SWAP counting as three), or as many
+ *          CNOTs and fewer gates.
+ *
+ *  @param qc The quantum circuit to be optimized in place
+ *  @return gcount_t The reduction in the number of CX gates (SWAP counting as three)
+ */
+gcount_t resynthesizeCliffordRegions(QCircuit &qc);
+
+}  // namespace qcore
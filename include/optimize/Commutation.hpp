@@ -0,0 +1,201 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   Commutation.hpp
+ *  @brief  Specification of Gate Commutation Rules and the Commutation-Aware Rescheduling Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <array>
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+
+namespace qcore {
+
+/**
+ * @brief Axis of a single-qubit rotation
+ */
+enum RotationAxis : std::uint8_t {
+    AXISNONE,
+    AXISX,
+    AXISY,
+    AXISZ
+};
+
+/** @brief Obtaining the axis in whose basis a gate type acts on its controls
+ *
+ *
+ *  @param gateType The gate type
+ *  @return RotationAxis AXISZ unless the type modifies one of its "controls"
+ */
+constexpr RotationAxis controlAxis(const gate_t &gateType) {
+    switch (gateType) {
+        case GateType::PERES:  // the middle qubit of PERES is flipped
+        case GateType::PERESDG:
+        case GateType::LCCX:
+        case GateType::LCCXDG:
+        case GateType::MEASURE:
+        case GateType::RESET:
+        case GateType::BARRIER:
+        case GateType::IF:
+            return RotationAxis::AXISNONE;
+        default:
+            return RotationAxis::AXISZ;  // a control is only ever read
+    }
+}
+
+/** @brief Obtaining the axis in whose basis a gate type acts on its targets
+ *
+ *
+ *  @param gateType The gate type
+ *  @return RotationAxis The axis, AXISNONE if the type is not diagonal in a Pauli basis
+ */
+constexpr RotationAxis targetAxis(const gate_t &gateType) {
+    switch (gateType) {
+        case GateType::Z:
+        case GateType::S:
+        case GateType::SDG:
+        case GateType::T:
+        case GateType::TDG:
+        case GateType::P:
+        case GateType::RZ:
+        case GateType::U1:
+        case GateType::CZ:
+        case GateType::CS:
+        case GateType::CSDG:
+        case GateType::CT:
+        case GateType::CTDG:
+        case GateType::CP:
+        case GateType::CRZ:
+        case GateType::CU1:
+        case GateType::RZZ:
+            return RotationAxis::AXISZ;
+        case GateType::X:
+        case GateType::RX:
+        case GateType::SX:
+        case GateType::SXDG:
+        case GateType::V:
+        case GateType::VDG:
+        case GateType::CX:
+        case GateType::CCX:
+        case GateType::MCX:
+        case GateType::CRX:
+        case GateType::RXX:
+        case GateType::CSX:
+        case GateType::CSXDG:
+        case GateType::CV:
+        case GateType::CVDG:
+            return RotationAxis::AXISX;
+        case GateType::Y:
+        case GateType::RY:
+        case GateType::CY:
+        case GateType::CRY:
+            return RotationAxis::AXISY;
+        default:
+            return RotationAxis::AXISNONE;
+    }
+}
+
+// bit 2 * role_a + role_b is set when two gate types commute on a shared qubit that is
+// a control (role 0) or target (role 1) of the first and second gate respectively
+using commutation_t = std::uint8_t;
+
+/** @brief Computing the commutation mask of a pair of gate types
+ *
+ * @details Two gates commute on a shared qubit when both act diagonally in the same
+ *          Pauli basis there, and commute as a whole when that holds on every shared
+ *          qubit.
+ *
+ *  @param lhs The first gate type
+ *  @param rhs The second gate type
+ *  @return commutation_t The mask over the (role_lhs, role_rhs) combinations
+ */
+constexpr commutation_t commutationMask(const gate_t &lhs, const gate_t &rhs) {
+    const RotationAxis lhs_axes[2] = {controlAxis(lhs), targetAxis(lhs)};
+    const RotationAxis rhs_axes[2] = {controlAxis(rhs), targetAxis(rhs)};
+    commutation_t mask = 0;
+    for (std::size_t a = 0; a < 2; ++a) {
+        for (std::size_t b = 0; b < 2; ++b) {
+            if (lhs_axes[a] != RotationAxis::AXISNONE && lhs_axes[a] == rhs_axes[b]) {
+                mask |= static_cast<commutation_t>(1u << (2 * a + b));
+            }
+        }
+    }
+    return mask;
+}
+
+using CommutationTable = std::array<std::array<commutation_t, GateType::TYPECOUNT>, GateType::TYPECOUNT>;
+
+constexpr CommutationTable makeCommutationTable() {
+    CommutationTable table{};
+    for (std::size_t a = 0; a < GateType::TYPECOUNT; ++a) {
+        for (std::size_t b = 0; b < GateType::TYPECOUNT; ++b) {
+            table[a][b] = commutationMask(static_cast<gate_t>(a), static_cast<gate_t>(b));
+        }
+    }
+    return table;
+}
+
+// commutation masks of all pairs of gate types, evaluated at compile time
+static constexpr CommutationTable COMMUTATION_TABLE = makeCommutationTable();
+
+/** @brief Checking whether two gates commute (sufficient condition)
+ *
+ * @details Uses COMMUTATION_TABLE on every shared qubit. Classically conditioned
+ *          gates never commute with gates sharing a qubit.
+ *
+ *  @param lhs The first gate
+ *  @param rhs The second gate
+ *  @return true if the gates can be swapped
+ */
+bool commute(QGate &lhs, QGate &rhs);
+
+/** @brief Computing the layered (ASAP) depth of a quantum circuit
+ *
+ *
+ *  @param qc The quantum circuit
+ *  @return depth_t The number of layers in which every qubit carries at most one gate
+ */
+depth_t layeredDepth(QCircuit &qc);
+
+/** @brief Rescheduling gates across commuting neighbours to reduce the layered depth
+ *
+ * @details Gates are placed one by one into the earliest layer that is free on all of
+ *          their qubits and lies above every non-commuting gate on them. Only the last
+ *          lookahead gates per qubit are inspected; the next one is treated as blocking,
+ *          which keeps the pass linear in the number of gates. Gates reading or writing
+ *          classical bits keep their relative order. The circuit is re-serialized layer
+ *          by layer; the original order is kept if its layered depth would grow.
+ *
+ *  @param qc The quantum circuit to be rescheduled in place
+ *  @param lookahead The number of gates per qubit inspected (Default 32)
+ *  @return depth_t The reduction of the layered depth
+ */
+depth_t reorderCommutingGates(QCircuit &qc, std::size_t lookahead = 32);
+
+}  // namespace qcore
@@ -0,0 +1,64 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   InverseCancellation.hpp
+ *  @brief  Specification of the Inverse Gate Pair Cancellation Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+
+namespace qcore {
+
+/** @brief Checking whether two quantum gates cancel each other when applied back to back
+ *
+ * @details The gates must be unitary, unparameterized and unconditioned, act on the
+ *          same controls and targets, and their types must be inverses of each other
+ *          (see inverseGateType). ISWAP and RC3X never cancel: inverseGateType maps
+ *          them to themselves, but neither is self inverse.
+ *
+ *  @param first The earlier quantum gate
+ *  @param second The later quantum gate
+ *  @return true if second is the inverse of first
+ */
+bool isInversePair(QGate &first, QGate &second);
+
+/** @brief Removing adjacent inverse gate pairs (e.g. H·H, CX·CX, T·TDG, S·SDG)
+ *
+ * @details A single sweep keeps the last surviving gate of every qubit. A gate
+ *          cancels against its predecessor when that gate is the last one on all
+ *          of its qubits and both form an inverse pair. On cancellation the per-qubit
+ *          table is rolled back to the predecessors of the removed gate, so nested
+ *          pairs such as A·B·B†·A† cascade away in the same sweep. Every gate is
+ *          visited once and touches only its own qubits: O(n) in the number of gates.
+ *
+ *  @param qc The quantum circuit to be optimized in place
+ *  @return gcount_t The number of removed gates
+ */
+gcount_t cancelInversePairs(QCircuit &qc);
+
+}  // namespace qcore
@@ -0,0 +1,132 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   LinearSynthesis.hpp
+ *  @brief  Specification of GF(2) Matrices and the CNOT Resynthesis Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+
+namespace qcore {
+
+/**
+ * @brief Square matrix over GF(2) with rows packed into 64-bit words
+ *
+ * @details Row i holds the parity of the input qubits that qubit i carries after a
+ *          CNOT circuit; CX(c, t) adds row c to row t.
+ */
+class GF2Matrix {
+   private:
+    std::size_t dimension;
+    std::size_t words;
+    std::vector<std::uint64_t> bits;
+
+   public:
+    /**
+     * @brief Construct the identity matrix
+     *
+     * @param dimension The number of rows and columns
+     */
+    explicit GF2Matrix(std::size_t dimension = 0);
+
+    inline std::size_t size() const { return this->dimension; }
+
+    inline std::size_t wordCount() const { return this->words; }
+
+    inline std::uint64_t *row(std::size_t r) { return this->bits.data() + r * this->words; }
+
+    inline const std::uint64_t *row(std::size_t r) const { return this->bits.data() + r * this->words; }
+
+    inline bool get(std::size_t r, std::size_t c) const { return ((row(r)[c >> 6] >> (c & 63)) & 1) != 0; }
+
+    inline void flip(std::size_t r, std::size_t c) { row(r)[c >> 6] ^= std::uint64_t{1} << (c & 63); }
+
+    /**
+     * @brief Add (xor) one row to another, a word at a time
+     *
+     * @param source The row added
+     * @param destination The row modified
+     */
+    inline void addRow(std::size_t source, std::size_t destination) {
+        const std::uint64_t *src = row(source);
+        std::uint64_t *dst = row(destination);
+        for (std::size_t w = 0; w < this->words; ++w) {
+            dst[w] ^= src[w];
+        }
+    }
+
+    /**
+     * @brief Extract up to 64 consecutive bits of a row
+     *
+     * @param r The row
+     * @param begin The first column
+     * @param count The number of columns (at most 64)
+     * @return std::uint64_t The bits, column begin in the least significant bit
+     */
+    std::uint64_t bitsOf(std::size_t r, std::size_t begin, std::size_t count) const;
+
+    GF2Matrix transpose() const;
+
+    bool operator==(const GF2Matrix &other) const;
+};
+
+// a CNOT as (control, target)
+using CNOT = std::pair<std::size_t, std::size_t>;
+
+/** @brief Synthesizing a CNOT circuit for an invertible GF(2) matrix (Patel-Markov-Hayes)
+ *
+ * @details Columns are processed in sections; rows sharing a section pattern are
+ *          combined with a single row addition before Gaussian elimination clears the
+ *          rest. Applied to the matrix and to its transpose, this yields O(n^2 / log n)
+ *          CNOTs.
+ *
+ *  @param matrix The invertible matrix
+ *  @param section The section size (Default 0 = log2 of the dimension)
+ *  @return std::vector<CNOT> The CNOTs in circuit order
+ *  @throws QcoreException if the matrix is singular
+ */
+std::vector<CNOT> pmhSynthesis(GF2Matrix matrix, std::size_t section = 0);
+
+/** @brief Resynthesizing maximal CX-only subcircuits with Patel-Markov-Hayes
+ *
+ * @details A subcircuit collects CX gates from its first gate on until a CX touches a
+ *          qubit that a gate outside the subcircuit used in between. The parity matrix
+ *          of the subcircuit over its qubits is resynthesized, and the result replaces
+ *          the subcircuit at the position of its first gate when it has fewer CNOTs.
+ *
+ *  @param qc The quantum circuit to be optimized in place
+ *  @return gcount_t The reduction in the number of CX gates
+ */
+gcount_t resynthesizeCNOTRegions(QCircuit &qc);
+
+}  // namespace qcore
@@ -0,0 +1,192 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   PassManager.hpp
+ *  @brief  Specification of the Pass Manager for Circuit Compilation Pipelines
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+#include "Definition.hpp"
+#include "QCircuit.hpp"
+
+namespace qcore {
+
+// a circuit transformation, returning the size of its effect (ignored by the manager)
+using pass_t = std::function<gcount_t(QCircuit &)>;
+
+/**
+ * @brief Measurements of a single pass execution
+ *
+ * @details memory_before and memory_after are the resident set sizes of the process
+ *          around the pass in bytes (0 where the platform does not report them).
+ *          peak_memory is the larger of the two samples and, if the pass raised it,
+ *          the high-water mark of the process. All are process wide, so in
+ *          parallel runs they include the memory of all concurrent pipelines.
+ */
+struct PassRecord {
+    std::string name{};
+    std::size_t iteration = 0;
+    fp seconds = 0;
+    std::size_t peak_memory = 0;
+    std::size_t memory_before = 0;
+    std::size_t memory_after = 0;
+    gcount_t gates_before = 0;
+    gcount_t gates_after = 0;
+
+    inline std::int64_t memoryDelta() const {
+        return static_cast<std::int64_t>(memory_after) - static_cast<std::int64_t>(memory_before);
+    }
+
+    inline std::int64_t gateDelta() const {
+        return static_cast<std::int64_t>(gates_after) - static_cast<std::int64_t>(gates_before);
+    }
+};
+
+/**
+ * @brief Measurements of a pipeline run on one circuit
+ */
+struct PipelineReport {
+    bool valid = true;
+    std::string error{};
+    std::size_t iterations = 0;
+    gcount_t initial_gates = 0;
+    gcount_t final_gates = 0;
+    fp seconds = 0;
+    std::vector<PassRecord> passes{};
+};
+
+/**
+ * @brief Sequence of circuit transformations applied as a compilation pipeline
+ *
+ * @details Passes run in the order they were added. With fixed-point iteration the
+ *          whole sequence is repeated while an iteration shrinks the gate count, up
+ *          to the iteration limit. Many circuits are processed concurrently on the
+ *          work-stealing thread pool, one pipeline per task; passes themselves are
+ *          expected to be single-threaded in that case.
+ */
+class PassManager {
+   private:
+    std::vector<std::pair<std::string, pass_t>> passes{};
+    bool fixed_point;
+    std::size_t max_iterations;
+
+   public:
+    /**
+     * @brief Construct a new pass manager
+     *
+     * @param fixed_point Repeating the pipeline until the gate count stops shrinking (Default False)
+     * @param max_iterations The maximum number of pipeline iterations (Default 16)
+     */
+    explicit PassManager(bool fixed_point = false, std::size_t max_iterations = 16);
+
+    /**
+     * @brief Append a pass to the pipeline
+     *
+     * @param name The name used in the records
+     * @param pass The circuit transformation
+     * @return PassManager& The pass manager
+     */
+    PassManager &addPass(const std::string &name, pass_t pass);
+
+    /**
+     * @brief Append a built-in pass to the pipeline
+     *
+     * @param name The name of the pass (see builtinPasses)
+     * @return PassManager& The pass manager
+     * @throws QcoreException if no built-in pass has that name
+     */
+    PassManager &addPass(const std::string &name);
+
+    /**
+     * @brief Run the pipeline on a circuit in place
+     *
+     * @param qc The quantum circuit
+     * @return PipelineReport The measurements of every pass execution
+     */
+    PipelineReport run(QCircuit &qc) const;
+
+    /**
+     * @brief Run the pipeline on many circuits concurrently
+     *
+     * @details Empty entries get an invalid report with the error "no circuit"; a
+     *          pass throwing on a circuit invalidates only the report of that circuit.
+     *
+     *  @param circuits The quantum circuits, optimized in place
+     *  @param threads The number of worker threads (Default 0 = hardware concurrency)
+     *  @return std::vector<PipelineReport> One report per circuit, in input order
+     */
+    std::vector<PipelineReport> run(std::vector<std::unique_ptr<QCircuit>> &circuits, std::size_t threads = 0) const;
+
+    inline std::size_t size() const { return this->passes.size(); }
+
+    inline bool isFixedPoint() const { return this->fixed_point; }
+
+    inline std::size_t getMaxIterations() const { return this->max_iterations; }
+};
+
+/** @brief Obtaining the built-in passes by name
+ *
+ * @details cancel_inverse_pairs, merge_rotations, merge_rotations_clifford_t,
+ *          fuse_single_qubit_runs, consolidate_two_qubit_blocks (single-threaded)
+ *          fold_phase_polynomial, reorder_commuting_gates, resynthesize_cnot_regions,
+ *          resynthesize_clifford_regions, zx_simplify, apply_templates,
+ *          decompose_clifford_t (single-threaded), translate_clifford_t,
+ *          translate_rz_sx_x_cx, translate_u3_cx and synthesize_rotations
+ *          (single-threaded, DEFAULT_SYNTHESIS_EPSILON).
+ *
+ *  @return The map from pass names to passes
+ */
+const std::map<std::string, pass_t> &builtinPasses();
+
+/** @brief Obtaining the resident set high-water mark of the process
+ *
+ *
+ *  @return std::size_t The peak resident memory in bytes, 0 if unavailable
+ */
+std::size_t peakResidentMemory();
+
+/** @brief Obtaining the current resident set size of the process
+ *
+ *
+ *  @return std::size_t The resident memory in bytes, 0 if unavailable (non-Linux)
+ */
+std::size_t residentMemory();
+
+/** @brief Converting a pipeline report to JSON
+ *
+ *
+ *  @param report The pipeline report
+ *  @return The JSON object {Iterations, InitialGateCount, FinalGateCount, WallTime, Passes, ...}
+ */
+nlohmann::json toJSON(const PipelineReport &report);
+
+}  // namespace qcore
@@ -0,0 +1,64 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   PhaseFolding.hpp
+ *  @brief  Specification of the Phase Polynomial T-Count Optimization Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+
+namespace qcore {
+
+/** @brief Counting the T and TDG gates of a quantum circuit
+ *
+ *
+ *  @param qc The quantum circuit
+ *  @return gcount_t The T-count
+ */
+gcount_t tCount(QCircuit &qc);
+
+/** @brief Merging phase gates that act on the same parity of the circuit variables
+ *
+ * @details Every qubit carries an affine parity over path variables: CX, X and SWAP
+ *          update the parities linearly, diagonal gates leave them unchanged, and any
+ *          other gate starts a fresh variable on its targets. The CX+phase regions in
+ *          between are thus represented as a phase polynomial (parity -> angle) over a
+ *          linear reversible map. Phase gates (Z, S, SDG, T, TDG and RZ/P/U1 with
+ *          constant angles) on a parity that occurred before are added to the first
+ *          occurrence and removed; the merged angle is re-emitted there as Clifford+T
+ *          phase gates when it is a multiple of pi/4, as a rotation otherwise. The
+ *          CX structure is kept. Parities are sparse and looked up by hashing, so the
+ *          pass runs in near-linear time. The result is equal up to global phase.
+ *
+ *  @param qc The quantum circuit to be optimized in place
+ *  @return gcount_t The reduction in the number of gates
+ */
+gcount_t foldPhasePolynomial(QCircuit &qc);
+
+}  // namespace qcore
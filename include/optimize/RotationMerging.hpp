@@ -0,0 +1,77 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   RotationMerging.hpp
+ *  @brief  Specification of the Rotation Merging and Constant Folding Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+#include "optimize/Commutation.hpp"
+
+namespace qcore {
+
+/** @brief Obtaining the axis along which a gate acts on one of its qubits
+ *
+ * @details A gate is diagonal in the basis of an axis on a qubit when it commutes
+ *          with every rotation about that axis on the qubit, e.g. CX on its control
+ *          (Z) and on its target (X), CZ/RZZ/CP on all its qubits (Z).
+ *
+ *  @param gate The quantum gate
+ *  @param qubit The qubit of interest
+ *  @return RotationAxis The axis, AXISNONE if the gate does not commute with any rotation
+ */
+RotationAxis commutingAxis(QGate &gate, const Qubit &qubit);
+
+/** @brief Obtaining the Clifford+T phase gates of a Z rotation through k * pi/4
+ *
+ *
+ *  @param k The multiple of pi/4
+ *  @param qubit The target qubit
+ *  @return QGateSet At most two of T, S, Z, SDG, TDG (equal up to global phase)
+ */
+QGateSet phaseGates(std::int64_t k, const Qubit &qubit);
+
+/** @brief Merging consecutive rotations about the same axis and folding constant angles
+ *
+ * @details Runs of RZ/P/U1 (and, once such a rotation is pending, Z/S/SDG/T/TDG),
+ *          RX and RY on the same qubit are merged into a single rotation placed at
+ *          the first gate of the run. A pending rotation stays open across gates that
+ *          commute with it on that qubit (see commutingAxis). Merged rotations whose
+ *          angle folds to a multiple of 2pi are removed. With clifford_t set, runs of
+ *          fixed phase gates are merged as well and Z rotations through a multiple of
+ *          pi/4 are re-emitted as T/S/Z/SDG/TDG gates. Only uncontrolled, unconditioned
+ *          rotations with constant angles are merged; the result is equal up to global
+ *          phase.
+ *
+ *  @param qc The quantum circuit to be optimized in place
+ *  @param clifford_t Emitting pi/4 multiples as Clifford+T phase gates (Default False)
+ *  @return gcount_t The number of gates merged into a preceding rotation or folded away
+ */
+gcount_t mergeRotations(QCircuit &qc, bool clifford_t = false);
+
+}  // namespace qcore
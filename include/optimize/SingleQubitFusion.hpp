@@ -0,0 +1,61 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   SingleQubitFusion.hpp
+ *  @brief  Specification of the Single-Qubit Gate Run Fusion Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+#include "Unitary.hpp"
+
+namespace qcore {
+
+/** @brief Creating a U3 gate realizing a single-qubit unitary up to global phase
+ *
+ *
+ *  @param matrix The unitary
+ *  @param qubit The target qubit
+ *  @return QGate The U3 gate
+ */
+QGate u3Gate(const Matrix2 &matrix, const Qubit &qubit);
+
+/** @brief Fusing maximal runs of single-qubit gates into one U3 gate each
+ *
+ * @details The 2x2 matrices of the gates of a run are multiplied as the run grows, so
+ *          every gate is visited once. A run ends at the first gate acting on the qubit
+ *          that is not an unconditioned single-qubit unitary with constant angles.
+ *          Runs of two or more gates are replaced by a U3 at the position of their first
+ *          gate (ZYZ Euler angles), or dropped when the product is the identity up to
+ *          global phase. Single gates are kept as they are.
+ *
+ *  @param qc The quantum circuit to be optimized in place
+ *  @return gcount_t The reduction in the number of gates
+ */
+gcount_t fuseSingleQubitRuns(QCircuit &qc);
+
+}  // namespace qcore
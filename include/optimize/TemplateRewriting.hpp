@@ -0,0 +1,149 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   TemplateRewriting.hpp
+ *  @brief  Specification of the Template-Matching Rewrite Engine
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+
+namespace qcore {
+
+/**
+ * @brief Gate of a rewrite template over relative qubits
+ *
+ * @details Controls and targets are slot numbers 0, 1, ... that a match binds to
+ *          distinct circuit qubits. Template gates are unparameterized.
+ */
+struct TemplateGate {
+    gate_t type = GateType::NONE;
+    ControlSet controls{};
+    TargetSet targets{};
+};
+
+/**
+ * @brief Gate-level identity: the pattern may be replaced by the replacement
+ *
+ * @details The pattern gates must be connected through shared wires and the
+ *          replacement may only use slots of the pattern.
+ */
+struct RewriteRule {
+    std::string name{};
+    std::vector<TemplateGate> pattern{};
+    std::vector<TemplateGate> replacement{};
+};
+
+/**
+ * @brief Set of rewrite rules compiled into a matching automaton
+ *
+ * @details Every pattern is ordered so that each gate is a wire neighbour of an earlier
+ *          one and then merged into a prefix tree whose transitions are labelled with a
+ *          gate type, the slots of its operands and its matched wire neighbours, slots
+ *          being renumbered in order of first use so that rules with a common beginning
+ *          share states. The only circuit gate that can take a transition is the
+ *          successor (or predecessor) of a matched gate on a bound wire, so matching
+ *          never backtracks over circuit gates and costs at most the number of states
+ *          per start gate.
+ */
+class TemplateMatcher {
+   private:
+    struct Transition {
+        TemplateGate gate{};
+        std::vector<std::size_t> before{};  // per operand: depth of the matched gate preceding it on the wire
+        std::vector<std::size_t> after{};   // per operand: depth of the matched gate following it on the wire
+        std::size_t anchor = 0;             // operand locating the candidate gate
+        std::size_t next = 0;
+    };
+
+    struct State {
+        std::size_t bound = 0;  // slots bound on reaching the state
+        std::vector<Transition> transitions{};
+        std::vector<std::size_t> accepted{};
+    };
+
+    std::vector<RewriteRule> rules;  // with renumbered slots
+    std::vector<State> states;
+
+   public:
+    // largest number of relative qubits in a template
+    static constexpr std::size_t MAX_SLOTS = 8;
+
+    /**
+     * @brief Compile rewrite rules
+     *
+     * @param rules The rewrite rules, earlier rules win among matches of equal gain
+     * @throws QcoreException if a rule is malformed
+     */
+    explicit TemplateMatcher(std::vector<RewriteRule> rules);
+
+    /**
+     * @brief Rewrite a circuit with the rules
+     *
+     * @details Every round scans the gate dependency graph once. From every gate the
+     *          automaton is run along the wires and the match with the largest gain
+     *          (pattern minus replacement size) whose gates are not used yet is taken.
+     *          Its replacement is put at the position of its last gate, or else its
+     *          first, such that every dependency of the contracted circuit still points
+     *          forward; matches with an outside gate both after and before them are
+     *          skipped. All matches of a round are replaced at once, and rounds are
+     *          repeated while they rewrite something.
+     *
+     *  @param qc The quantum circuit to be rewritten in place
+     *  @param max_rounds The maximum number of rounds (Default 8)
+     *  @return gcount_t The number of rewrites applied
+     */
+    gcount_t rewrite(QCircuit &qc, std::size_t max_rounds = 8) const;
+
+    inline std::size_t size() const { return this->rules.size(); }
+
+    inline std::size_t stateCount() const { return this->states.size(); }
+};
+
+/** @brief Obtaining the built-in rewrite rules
+ *
+ * @details Hadamard conjugations (H·CX·H = CZ, H·CZ·H = CX, CX with reversed roles,
+ *          H·X·H = Z, H·Z·H = X) and the Clifford+T decompositions of the Toffoli and
+ *          the relative phase Toffoli (Margolus) gate, which are contracted back into
+ *          single CCX and RCCX gates. Every rule shrinks the gate count.
+ *
+ *  @return The rewrite rules
+ */
+const std::vector<RewriteRule> &builtinTemplates();
+
+/** @brief Rewriting a circuit with the built-in templates
+ *
+ *
+ *  @param qc The quantum circuit to be rewritten in place
+ *  @return gcount_t The number of rewrites applied
+ */
+gcount_t applyTemplates(QCircuit &qc);
+
+}  // namespace qcore
@@ -0,0 +1,61 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   ZXSimplification.hpp
+ *  @brief  Specification of the ZX-Calculus Circuit Simplification Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+
+namespace qcore {
+
+/** @brief Counting the gates with a phase that is not a multiple of pi/2
+ *
+ *
+ *  @param qc The quantum circuit
+ *  @return gcount_t The number of T, TDG and non-Clifford RZ/RX/P/U1 gates
+ */
+gcount_t nonCliffordCount(QCircuit &qc);
+
+/** @brief Simplifying a circuit through its ZX-diagram
+ *
+ * @details Gates outside of isZXGate (measurements, Toffolis, conditioned gates, ...)
+ *          are kept in place and split the circuit into maximal segments of isZXGate
+ *          gates. Each segment is translated with circuitToZX, reduced with fullReduce
+ *          (including phase gadgets) and extracted again; the extracted circuit is
+ *          cleaned up by inverse-pair cancellation and Clifford+T phase merging. It
+ *          replaces the segment when it has fewer non-Clifford gates, or as many and
+ *          fewer CNOTs (SWAP counting as three), or as many of both and fewer gates.
+ *
+ *  @param qc The quantum circuit to be optimized in place
+ *  @return gcount_t The reduction in the number of non-Clifford gates
+ */
+gcount_t simplifyWithZX(QCircuit &qc);
+
+}  // namespace qcore
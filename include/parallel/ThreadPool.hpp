@@ -0,0 +1,135 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   ThreadPool.hpp
+ *  @brief  Specification of a Work-Stealing Thread Pool
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Definition.hpp"
+
+namespace qcore {
+
+using task_t = std::function<void()>;
+
+/**
+ * @brief Fixed size pool of worker threads with per-worker task queues
+ *
+ * @details Every worker owns a deque. Tasks submitted from outside the pool are
+ *          distributed round-robin, tasks submitted by a worker go to its own queue.
+ *          A worker takes work from the back of its own queue and, once empty, steals
+ *          from the front of the other queues. The number of queued (not yet started)
+ *          tasks is bounded by the capacity; submit() blocks the caller while the
+ *          bound is reached, so producers cannot run ahead of the workers.
+ */
+class ThreadPool {
+   private:
+    struct TaskQueue {
+        std::deque<task_t> tasks;
+        std::mutex lock;
+    };
+
+    std::vector<std::unique_ptr<TaskQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex state_lock;
+    std::condition_variable work_available;
+    std::condition_variable slot_available;
+    std::condition_variable all_done;
+
+    std::size_t capacity;
+    std::size_t queued;
+    std::size_t pending;
+    std::size_t next_queue;
+    bool stopping;
+
+    void push(task_t task);
+
+    bool pop(std::size_t index, task_t &task);
+
+    void run(std::size_t index);
+
+   public:
+    /**
+     * @brief Construct a new thread pool
+     *
+     * @param threads The number of worker threads (Default 0 = hardware concurrency)
+     * @param capacity The maximum number of queued tasks (Default 0 = 4 per worker)
+     */
+    explicit ThreadPool(std::size_t threads = 0, std::size_t capacity = 0);
+
+    ThreadPool(const ThreadPool &) = delete;
+
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ~ThreadPool();
+
+    /**
+     * @brief Queue a task for execution, blocking while the pool is at capacity
+     *
+     * @param task The callable to be executed by one of the workers
+     */
+    template <typename F>
+    void submit(F &&task) {
+        push(task_t(std::forward<F>(task)));
+    }
+
+    /**
+     * @brief Block until every submitted task has finished
+     */
+    void wait();
+
+    inline std::size_t size() const { return this->workers.size(); }
+};
+
+/** @brief Resolving the number of worker threads to be used
+ *
+ *
+ *  @param threads The requested number of threads (0 = hardware concurrency)
+ *  @return The number of threads, at least one
+ */
+std::size_t resolveThreads(std::size_t threads);
+
+/** @brief Splitting the range [0, n) into chunks executed on the thread pool
+ *
+ *
+ *  @param pool The thread pool
+ *  @param n The size of the range
+ *  @param func The function called as func(begin, end) for every chunk
+ *  @param grain The minimum chunk size (Default 1)
+ */
+void parallelFor(ThreadPool &pool, std::size_t n, const std::function<void(std::size_t, std::size_t)> &func, std::size_t grain = 1);
+
+}  // namespace qcore
@@ -0,0 +1,65 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   ClassicalBits.hpp
+ *  @brief  Classical Register Handling Shared by the Simulators
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Definition.hpp"
+#include "QGate.hpp"
+
+namespace qcore {
+
+/** @brief Evaluating the classical condition of a gate
+ *
+ * @details The condition is compared with the classical bits read as an unsigned
+ *          integer, bit i being cbits[i].
+ *
+ *  @param gate The conditioned gate
+ *  @param cbits The classical bits
+ *  @param func The name of the caller, used in error messages
+ *  @return true if the gate applies
+ *  @throws QcoreException if the condition is not an integer
+ */
+bool conditionHolds(QGate &gate, const std::vector<std::uint8_t> &cbits, const std::string &func);
+
+/** @brief Recording the outcome of the i-th target of a measurement
+ *
+ * @details The outcome goes to the i-th classical bit of the gate, if it has one; the
+ *          classical bits grow as needed.
+ *
+ *  @param cbits The classical bits
+ *  @param gate The measurement
+ *  @param i The index of the measured target
+ *  @param outcome The outcome
+ */
+void storeOutcome(std::vector<std::uint8_t> &cbits, QGate &gate, std::size_t i, bool outcome);
+
+}  // namespace qcore
@@ -0,0 +1,393 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   DecisionDiagram.hpp
+ *  @brief  Specification of the Decision-Diagram (QMDD) Simulation Backend
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Definition.hpp"
+#include "QCircuit.hpp"
+#include "Unitary.hpp"
+#include "zx/FlatHashMap.hpp"
+
+namespace qcore {
+
+// edge weights closer than this (per component) are identified, smaller ones are zero
+constexpr fp DD_TOLERANCE = static_cast<fp>(1e-13);
+
+// live nodes per node table before the first garbage collection
+constexpr std::size_t DEFAULT_GC_LIMIT = std::size_t{1} << 17;
+
+// entries of each compute table
+constexpr std::size_t COMPUTE_TABLE_SIZE = std::size_t{1} << 15;
+
+/**
+ * @brief Weighted edge of a decision diagram
+ *
+ * @details Node 0 is the terminal; the zero edge points to it with weight 0. N is the
+ *          number of successors: 2 for state vectors, 4 for matrices (row-major).
+ */
+template <std::size_t N>
+struct DDEdge {
+    std::uint32_t node = 0;
+    Complex weight{};
+
+    inline bool isZero() const { return this->node == 0 && this->weight == Complex{}; }
+};
+
+using VectorEdge = DDEdge<2>;
+using MatrixEdge = DDEdge<4>;
+
+/**
+ * @brief Sizes and cache behaviour of a decision-diagram package
+ */
+struct DDStatistics {
+    std::size_t vector_nodes = 0;
+    std::size_t matrix_nodes = 0;
+    std::size_t peak_nodes = 0;
+    std::size_t collections = 0;
+    std::uint64_t lookups = 0;
+    std::uint64_t hits = 0;
+};
+
+/**
+ * @brief Node tables and operations of quantum multiple-valued decision diagrams
+ *
+ * @details Level q of a diagram decides qubit q, the root sits at level n - 1 and every
+ *          path visits all levels. Nodes are normalized (the successor of largest
+ *          magnitude, the first of equal ones, gets weight 1) and hash-consed in a
+ *          unique table, so equal sub-diagrams are one node. Additions and products
+ *          are memoized in direct-mapped compute tables of fixed size.
+ *
+ *          Edges held outside the package must be referenced with incRef and released
+ *          with decRef. garbageCollect frees the unreferenced nodes once a table holds
+ *          more than its limit, invalidating the compute tables; the limit doubles only
+ *          when the referenced nodes alone exceed half of it, so the tables stay within
+ *          a constant factor of the live diagrams.
+ *
+ *          Normalized weights are looked up in a table of canonical values first, so
+ *          that weights equal up to DD_TOLERANCE are equal bit for bit and their nodes
+ *          are shared; the table is rebuilt from the live nodes on every collection.
+ */
+class DDPackage {
+   private:
+    template <std::size_t N>
+    struct Node {
+        std::array<DDEdge<N>, N> edges{};
+        std::int32_t level = -1;
+        std::uint32_t ref = 0;
+        std::uint32_t next = 0;  // chain of the unique table bucket, or of the free list
+        bool identity = false;   // matrix node of the identity on its levels
+    };
+
+    template <std::size_t N>
+    struct NodeTable {
+        std::vector<Node<N>> nodes{};
+        std::vector<std::uint32_t> buckets{};
+        std::uint32_t free = 0;
+        std::size_t live = 0;
+        std::size_t limit = 0;
+    };
+
+    template <std::size_t N>
+    struct AddEntry {
+        std::uint32_t lhs = 0;
+        std::uint32_t rhs = 0;
+        Complex ratio{};
+        DDEdge<N> result{};
+        std::uint64_t generation = 0;
+    };
+
+    template <std::size_t N>
+    struct MultiplyEntry {
+        std::uint32_t lhs = 0;
+        std::uint32_t rhs = 0;
+        DDEdge<N> result{};
+        std::uint64_t generation = 0;
+    };
+
+    std::size_t qubits;
+    NodeTable<2> vectors{};
+    NodeTable<4> matrices{};
+    std::vector<AddEntry<2>> vector_additions;
+    std::vector<AddEntry<4>> matrix_additions;
+    std::vector<MultiplyEntry<2>> vector_products;
+    std::vector<MultiplyEntry<4>> matrix_products;
+    FlatHashMap<std::uint64_t, Complex> weights{};  // canonical weight per cell of the tolerance grid
+    std::uint64_t generation = 1;
+    DDStatistics statistics{};
+
+    Complex canonical(const Complex &w);
+
+    void rebuildWeights();
+
+    template <std::size_t N>
+    NodeTable<N> &table();
+
+    template <std::size_t N>
+    const NodeTable<N> &table() const;
+
+    template <std::size_t N>
+    std::vector<AddEntry<N>> &additions();
+
+    template <std::size_t N>
+    std::vector<MultiplyEntry<N>> &products();
+
+    template <std::size_t N>
+    DDEdge<N> makeNode(std::int32_t level, std::array<DDEdge<N>, N> edges);
+
+    template <std::size_t N>
+    void incRef(NodeTable<N> &nodes, std::uint32_t node);
+
+    template <std::size_t N>
+    void decRef(NodeTable<N> &nodes, std::uint32_t node);
+
+    template <std::size_t N>
+    std::size_t countNodes(const NodeTable<N> &nodes, std::uint32_t root) const;
+
+    template <std::size_t N>
+    void collect(NodeTable<N> &nodes, bool force);
+
+    template <std::size_t N>
+    DDEdge<N> addEdges(const DDEdge<N> &lhs, const DDEdge<N> &rhs);
+
+    template <std::size_t N>
+    DDEdge<N> multiplyEdges(const MatrixEdge &lhs, const DDEdge<N> &rhs);
+
+    MatrixEdge makeOperator(std::int32_t level, const std::vector<std::int32_t> &roles, const Complex *matrix, std::size_t dim, std::size_t row,
+                            std::size_t column, bool active);
+
+    fp norm(const VectorEdge &edge, std::vector<fp> &norms) const;
+
+   public:
+    /**
+     * @brief Construct an empty package
+     *
+     * @param qubits The number of qubits (levels) of all diagrams
+     * @param gc_limit The number of live nodes per table before the first collection (Default DEFAULT_GC_LIMIT)
+     * @throws QcoreException if qubits is 0
+     */
+    explicit DDPackage(std::size_t qubits, std::size_t gc_limit = DEFAULT_GC_LIMIT);
+
+    /**
+     * @brief Make the basis state |index>
+     *
+     * @param index The basis state, qubit q at bit q (qubits from 64 on are 0) (Default 0)
+     * @return VectorEdge The state
+     */
+    VectorEdge makeBasisState(std::uint64_t index = 0);
+
+    /**
+     * @brief Make the identity
+     *
+     * @return MatrixEdge The identity on all qubits
+     */
+    MatrixEdge makeIdentity();
+
+    /**
+     * @brief Make the operator of a controlled dense gate
+     *
+     * @param targets The target qubits, targets[i] being bit i of the matrix index
+     * @param matrix The row-major 2^k x 2^k matrix of the k targets
+     * @param controls The control qubits
+     * @return MatrixEdge The operator on all qubits
+     * @throws QcoreException if a qubit is repeated or lies outside the register
+     */
+    MatrixEdge makeGate(const QubitSet &targets, const Complex *matrix, const QubitSet &controls = {});
+
+    /**
+     * @brief Make the operator of a unitary gate
+     *
+     * @param gate The quantum gate, a unitary supported by isSupportedUnitary
+     * @return MatrixEdge The operator on all qubits
+     * @throws QcoreException if the gate is not a supported unitary
+     */
+    MatrixEdge makeGate(QGate &gate);
+
+    VectorEdge add(const VectorEdge &lhs, const VectorEdge &rhs);
+
+    MatrixEdge add(const MatrixEdge &lhs, const MatrixEdge &rhs);
+
+    VectorEdge multiply(const MatrixEdge &lhs, const VectorEdge &rhs);
+
+    MatrixEdge multiply(const MatrixEdge &lhs, const MatrixEdge &rhs);
+
+    /**
+     * @brief Obtain an amplitude of a state
+     *
+     * @param state The state
+     * @param index The basis state, qubit q at bit q (qubits from 64 on are 0)
+     * @return Complex The amplitude
+     */
+    Complex amplitude(const VectorEdge &state, std::uint64_t index) const;
+
+    /**
+     * @brief Obtain an entry of an operator
+     *
+     * @param op The operator
+     * @param row The row, qubit q at bit q
+     * @param column The column, qubit q at bit q
+     * @return Complex The entry
+     */
+    Complex entry(const MatrixEdge &op, std::uint64_t row, std::uint64_t column) const;
+
+    /**
+     * @brief Obtain the probability of measuring 1 on a qubit
+     *
+     * @param state The state
+     * @param qubit The qubit
+     * @return fp The probability relative to the squared norm of the state
+     */
+    fp probability(const VectorEdge &state, Qubit qubit) const;
+
+    /**
+     * @brief Count the nodes of a diagram
+     *
+     * @param edge The root edge
+     * @return std::size_t The number of distinct non-terminal nodes
+     */
+    std::size_t nodeCount(const VectorEdge &edge) const;
+
+    std::size_t nodeCount(const MatrixEdge &edge) const;
+
+    // an edge held outside the package keeps its nodes from being collected
+    void incRef(const VectorEdge &edge);
+
+    void incRef(const MatrixEdge &edge);
+
+    void decRef(const VectorEdge &edge);
+
+    void decRef(const MatrixEdge &edge);
+
+    /**
+     * @brief Free the unreferenced nodes of the tables that exceed their limit
+     *
+     * @details Must not be called while unreferenced results are still in use.
+     *
+     *  @param force Collecting regardless of the limits (Default False)
+     */
+    void garbageCollect(bool force = false);
+
+    inline std::size_t getQubits() const { return this->qubits; }
+
+    inline const DDStatistics &getStatistics() const { return this->statistics; }
+};
+
+/**
+ * @brief Simulator keeping the state as a decision diagram
+ *
+ * @details Every gate is turned into its operator diagram and multiplied onto the
+ *          state. Memory and time follow the diagram sizes instead of 2^n, which keeps
+ *          structured circuits of many qubits with limited entanglement tractable.
+ *          Measurements, resets and classically conditioned gates are supported.
+ */
+class DDSimulator {
+   private:
+    DDPackage package;
+    VectorEdge state{};
+    std::vector<std::uint8_t> cbits{};
+    std::mt19937_64 rng;
+
+    void replace(const VectorEdge &next);
+
+   public:
+    /**
+     * @brief Construct a simulator in the state |0...0>
+     *
+     * @param qubits The number of qubits
+     * @param seed The seed of the measurement outcomes (Default 0)
+     * @param gc_limit The number of live nodes per table before the first collection (Default DEFAULT_GC_LIMIT)
+     */
+    explicit DDSimulator(std::size_t qubits, std::uint64_t seed = 0, std::size_t gc_limit = DEFAULT_GC_LIMIT);
+
+    /**
+     * @brief Reset the register to |0...0> and clear the classical bits
+     */
+    void reset();
+
+    /**
+     * @brief Apply a gate
+     *
+     * @param gate The quantum gate
+     * @throws QcoreException if the gate is not supported or acts outside the register
+     */
+    void apply(QGate &gate);
+
+    /**
+     * @brief Apply the gates of a circuit to the current state
+     *
+     * @param qc The quantum circuit
+     * @throws QcoreException if the circuit is wider than the register or a gate is not supported
+     */
+    void run(QCircuit &qc);
+
+    /**
+     * @brief Measure a qubit in the computational basis and collapse the state
+     *
+     * @param qubit The qubit
+     * @return true if the outcome is 1
+     */
+    bool measure(Qubit qubit);
+
+    /**
+     * @brief Reset a qubit to |0> by measuring it and flipping a 1
+     *
+     * @param qubit The qubit
+     */
+    void reset(Qubit qubit);
+
+    inline fp probability(Qubit qubit) const { return this->package.probability(this->state, qubit); }
+
+    inline Complex amplitude(std::uint64_t index) const { return this->package.amplitude(this->state, index); }
+
+    inline std::size_t getQubits() const { return this->package.getQubits(); }
+
+    inline const VectorEdge &getState() const { return this->state; }
+
+    inline DDPackage &getPackage() { return this->package; }
+
+    inline const std::vector<std::uint8_t> &getCbits() const { return this->cbits; }
+};
+
+/** @brief Building the unitary of a circuit as a decision diagram
+ *
+ * @details The gate operators are multiplied onto the identity one by one, collecting
+ *          garbage in between. The returned edge holds a reference, to be released with
+ *          decRef once it is no longer needed.
+ *
+ *  @param package The decision-diagram package, of at least the circuit's width
+ *  @param qc The quantum circuit of unitary gates
+ *  @return MatrixEdge The unitary of the circuit
+ *  @throws QcoreException if a gate is not a supported unitary or the circuit is too wide
+ */
+MatrixEdge buildUnitary(DDPackage &package, QCircuit &qc);
+
+}  // namespace qcore
@@ -0,0 +1,112 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   GateFusion.hpp
+ *  @brief  Specification of the Gate Fusion Stage of the State-vector Simulator
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "Definition.hpp"
+#include "QCircuit.hpp"
+#include "simulate/StateVector.hpp"
+
+namespace qcore {
+
+// default cost of streaming the state once, in complex products per amplitude and SIMD lane,
+// measured on a single core; shared memory bandwidth makes passes dearer with more threads
+static constexpr fp DEFAULT_PASS_COST = 2;
+
+/**
+ * @brief Dense unitary of consecutive gates
+ *
+ * @details qubits[i] is bit i of the row and column indices of the row-major matrix.
+ */
+struct FusedBlock {
+    QubitSet qubits{};
+    std::vector<Complex> matrix{};
+    gcount_t gates = 0;
+};
+
+/**
+ * @brief Step of a fused simulation, either a fused block or a single gate of the circuit
+ */
+struct SimulationStep {
+    QGate *gate = nullptr;
+    FusedBlock block{};
+
+    inline bool isFused() const { return this->gate == nullptr; }
+};
+
+/** @brief Estimating the cost of applying a gate with the sparse kernels
+ *
+ * @details The cost of a kernel call per amplitude of the state is the fraction of
+ *          amplitudes it touches (halved per control, and for a diagonal with a unit
+ *          factor) times the pass cost plus its complex products per amplitude over
+ *          the SIMD lanes.
+ *
+ *  @param gate The quantum gate
+ *  @param simd The instruction set of the kernels
+ *  @param pass_cost The cost of streaming the state once (Default DEFAULT_PASS_COST)
+ *  @return fp The cost per amplitude
+ */
+fp gateCost(QGate &gate, const SimdLevel &simd, fp pass_cost = DEFAULT_PASS_COST);
+
+/** @brief Estimating the cost of applying a dense matrix on a set of qubits
+ *
+ * @details One pass plus 2^k complex products per amplitude; the products only
+ *          vectorize over the runs below the lowest qubit.
+ *
+ *  @param qubits The qubits of the matrix
+ *  @param simd The instruction set of the kernels
+ *  @param pass_cost The cost of streaming the state once (Default DEFAULT_PASS_COST)
+ *  @return fp The cost per amplitude
+ */
+fp blockCost(const QubitSet &qubits, const SimdLevel &simd, fp pass_cost = DEFAULT_PASS_COST);
+
+/** @brief Fusing the gates of a circuit into dense unitaries
+ *
+ * @details Gates are collected greedily into open blocks on disjoint qubits: a gate
+ *          joins the blocks sharing a qubit with it if the union stays within
+ *          max_qubits, otherwise those blocks are closed and it opens a new one. As
+ *          open blocks are disjoint, a gate commutes with every block it does not
+ *          touch. Measurements, resets, conditioned gates, unsupported and wider gates
+ *          close the blocks on their qubits and are kept as single steps. At barriers
+ *          and at the end, the open blocks are packed first fit into blocks of at most
+ *          max_qubits and closed. A closed block becomes a dense matrix if blockCost is
+ *          below the summed gateCost of its gates, otherwise its gates are kept.
+ *
+ *  @param qc The quantum circuit, which must outlive the steps
+ *  @param max_qubits The largest number of qubits of a block (Default 4)
+ *  @param simd The instruction set the steps are costed for (Default detectSimdLevel())
+ *  @param pass_cost The cost of streaming the state once (Default DEFAULT_PASS_COST)
+ *  @return std::vector<SimulationStep> The steps in an order equivalent to the circuit
+ *  @throws QcoreException if max_qubits is 0 or exceeds MAX_DENSE_QUBITS
+ */
+std::vector<SimulationStep> fuseGates(QCircuit &qc, std::size_t max_qubits = 4, const SimdLevel &simd = detectSimdLevel(),
+                                      fp pass_cost = DEFAULT_PASS_COST);
+
+}  // namespace qcore
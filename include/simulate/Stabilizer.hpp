@@ -0,0 +1,125 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Stabilizer.hpp
+ *  @brief  Specification of the Stabilizer Tableau Simulator for Clifford Circuits
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Definition.hpp"
+#include "QCircuit.hpp"
+#include "Tableau.hpp"
+
+namespace qcore {
+
+/** @brief Checking whether the stabilizer simulator supports a gate
+ *
+ *
+ *  @param gate The quantum gate, possibly conditioned
+ *  @return true for H, S, SDG, SX, SXDG, X, Y, Z, I, CX, CY, CZ, SWAP, MEASURE, RESET and BARRIER
+ */
+bool isStabilizerGate(QGate &gate);
+
+/** @brief Checking whether the stabilizer simulator supports every gate of a circuit
+ *
+ *
+ *  @param qc The quantum circuit
+ *  @return true if all gates pass isStabilizerGate
+ */
+bool isStabilizerCircuit(QCircuit &qc);
+
+/**
+ * @brief Aaronson-Gottesman (CHP) simulator of Clifford circuits
+ *
+ * @details The state C|0...0> is tracked by the tableau of C, whose X and Z bits are
+ *          packed per qubit column into 64-bit words, so a gate costs O(n / 64) word
+ *          operations and a measurement O(n^2 / 64). Mid-circuit measurements, resets
+ *          and gates conditioned on the classical register are supported.
+ */
+class StabilizerSimulator {
+   private:
+    CliffordTableau tableau;
+    std::vector<std::uint8_t> cbits{};
+    std::mt19937_64 rng;
+
+   public:
+    /**
+     * @brief Construct a simulator in the state |0...0>
+     *
+     * @param qubits The number of qubits
+     * @param seed The seed of the measurement outcomes (Default 0)
+     */
+    explicit StabilizerSimulator(std::size_t qubits, std::uint64_t seed = 0);
+
+    /**
+     * @brief Reset the register to |0...0> and clear the classical bits
+     */
+    void reset();
+
+    /**
+     * @brief Apply a gate
+     *
+     * @param gate The quantum gate
+     * @throws QcoreException if the gate is not supported or acts outside the register
+     */
+    void apply(QGate &gate);
+
+    /**
+     * @brief Apply the gates of a circuit to the current state
+     *
+     * @param qc The quantum circuit
+     * @throws QcoreException if the circuit is wider than the register or a gate is not supported
+     */
+    void run(QCircuit &qc);
+
+    /**
+     * @brief Measure a qubit in the computational basis and collapse the state
+     *
+     * @param qubit The qubit
+     * @return true if the outcome is 1
+     */
+    bool measure(Qubit qubit);
+
+    /**
+     * @brief Reset a qubit to |0> by measuring it and flipping a 1
+     *
+     * @param qubit The qubit
+     */
+    void reset(Qubit qubit);
+
+    inline bool isDeterministic(Qubit qubit) const { return this->tableau.isDeterministic(qubit); }
+
+    inline std::size_t getQubits() const { return this->tableau.size(); }
+
+    inline const CliffordTableau &getTableau() const { return this->tableau; }
+
+    inline const std::vector<std::uint8_t> &getCbits() const { return this->cbits; }
+};
+
+}  // namespace qcore
@@ -0,0 +1,343 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   StateVector.hpp
+ *  @brief  Specification of the SIMD State-vector Simulator
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+#include "Unitary.hpp"
+#include "parallel/ThreadPool.hpp"
+
+namespace qcore {
+
+// alignment of the amplitude storage in bytes, one AVX-512 register
+static constexpr std::size_t AMPLITUDE_ALIGNMENT = 64;
+
+// largest register the state-vector simulator accepts
+static constexpr std::size_t MAX_STATEVECTOR_QUBITS = 40;
+
+// largest number of qubits of a dense matrix kernel
+static constexpr std::size_t MAX_DENSE_QUBITS = 6;
+
+// default number of low qubits of a chunk in blocked execution, 2^15 amplitudes fill 512 KiB
+static constexpr std::size_t DEFAULT_BLOCK_QUBITS = 15;
+
+struct SimulationStep;
+
+/**
+ * @brief Instruction set used by the simulation kernels
+ */
+enum class SimdLevel : std::uint8_t { SCALAR, AVX2, AVX512 };
+
+/** @brief Detecting the widest instruction set supported by the processor
+ *
+ *
+ *  @return SimdLevel AVX512 (AVX-512F), AVX2 (AVX2 and FMA) or SCALAR
+ */
+SimdLevel detectSimdLevel();
+
+/** @brief Obtaining the name of an instruction set
+ *
+ *
+ *  @param level The instruction set
+ *  @return std::string "scalar", "avx2" or "avx512"
+ */
+std::string toString(const SimdLevel &level);
+
+/**
+ * @brief Amplitudes of a register, or of a block of a larger register
+ *
+ * @details Basis state i is stored at data[i], qubit q being bit q of i.
+ */
+struct AmplitudeSpan {
+    Complex *data = nullptr;
+    std::size_t qubits = 0;
+
+    inline std::size_t size() const { return std::size_t{1} << this->qubits; }
+};
+
+/** @brief Applying a (multi-)controlled 2x2 unitary to a target qubit
+ *
+ * @details The kernel is chosen by the structure of the matrix: diagonal matrices only
+ *          scale the amplitudes whose factor is not one, anti-diagonal ones swap the two
+ *          halves and scale them, all others run the generic 2x2 kernel. Amplitudes are
+ *          processed in contiguous runs between the fixed (target and control) bits,
+ *          which the SIMD kernels vectorize; a target on qubit 0 is handled by a kernel
+ *          working on adjacent amplitude pairs. With a pool, runs are distributed over
+ *          the workers.
+ *
+ *  @param state The amplitudes
+ *  @param target The target qubit
+ *  @param matrix The unitary
+ *  @param controls The control qubits as a bit mask
+ *  @param simd The instruction set of the kernels
+ *  @param pool The thread pool (Default nullptr = serial)
+ *  @throws QcoreException if the processor does not support the instruction set
+ */
+void applyMatrix(const AmplitudeSpan &state, Qubit target, const Matrix2 &matrix, std::size_t controls, const SimdLevel &simd,
+                 ThreadPool *pool = nullptr);
+
+/** @brief Applying a (multi-)controlled 4x4 unitary to a qubit pair
+ *
+ *
+ *  @param state The amplitudes
+ *  @param low The qubit mapped to the least significant bit of the matrix
+ *  @param high The qubit mapped to the most significant bit of the matrix
+ *  @param matrix The unitary, qubit order |high low>
+ *  @param controls The control qubits as a bit mask
+ *  @param simd The instruction set of the kernels
+ *  @param pool The thread pool (Default nullptr = serial)
+ *  @throws QcoreException if the processor does not support the instruction set
+ */
+void applyMatrix(const AmplitudeSpan &state, Qubit low, Qubit high, const Matrix4 &matrix, std::size_t controls, const SimdLevel &simd,
+                 ThreadPool *pool = nullptr);
+
+/** @brief Applying a (multi-)controlled dense unitary to a few qubits
+ *
+ * @details The amplitudes are gathered 2^k at a time from the offsets of the target
+ *          bits and multiplied by the matrix; runs below the lowest operand are
+ *          vectorized, so a matrix touching qubit 0 runs on scalar code.
+ *
+ *  @param state The amplitudes
+ *  @param qubits The distinct qubits, qubits[i] being bit i of the matrix index
+ *  @param matrix The 2^k x 2^k unitary in row-major order
+ *  @param controls The control qubits as a bit mask
+ *  @param simd The instruction set of the kernels
+ *  @param pool The thread pool (Default nullptr = serial)
+ *  @throws QcoreException if more than MAX_DENSE_QUBITS qubits are given or the
+ *          processor does not support the instruction set
+ */
+void applyMatrix(const AmplitudeSpan &state, const QubitSet &qubits, const Complex *matrix, std::size_t controls, const SimdLevel &simd,
+                 ThreadPool *pool = nullptr);
+
+/** @brief Exchanging two qubits under a control mask
+ *
+ *
+ *  @param state The amplitudes
+ *  @param a The first qubit
+ *  @param b The second qubit
+ *  @param controls The control qubits as a bit mask
+ *  @param pool The thread pool (Default nullptr = serial)
+ */
+void applySwap(const AmplitudeSpan &state, Qubit a, Qubit b, std::size_t controls, ThreadPool *pool = nullptr);
+
+/** @brief Exchanging qubits pairwise in a single pass
+ *
+ * @details Contiguous runs lie below the lowest exchanged qubit, so pairs of high qubits
+ *          move long runs.
+ *
+ *  @param state The amplitudes
+ *  @param pairs The pairs of qubits to exchange, all distinct
+ *  @param pool The thread pool (Default nullptr = serial)
+ */
+void applySwaps(const AmplitudeSpan &state, const std::vector<std::pair<Qubit, Qubit>> &pairs, ThreadPool *pool = nullptr);
+
+/** @brief Applying the unitary of a gate, ignoring its classical condition
+ *
+ * @details Barriers and identities are no-ops. With a layout, circuit qubit q of the
+ *          gate acts on qubit layout[q] of the amplitudes.
+ *
+ *  @param state The amplitudes
+ *  @param gate The quantum gate
+ *  @param simd The instruction set of the kernels
+ *  @param pool The thread pool (Default nullptr = serial)
+ *  @param layout The qubit map (Default nullptr = identity)
+ *  @return false if the gate is not a unitary the simulator supports, the amplitudes being untouched
+ *  @throws QcoreException if a qubit lies outside the amplitudes
+ */
+bool applyGate(const AmplitudeSpan &state, QGate &gate, const SimdLevel &simd, ThreadPool *pool = nullptr, const Qubit *layout = nullptr);
+
+/** @brief Obtaining the 4x4 matrix of a gate on two targets, ignoring its classical condition
+ *
+ * @details The matrix acts on (targets[0], targets[1]), targets[0] being the least
+ *          significant bit. The caller evaluates the condition of a conditioned gate.
+ *
+ *  @param gate The quantum gate
+ *  @param matrix The gate matrix (set on success)
+ *  @return true if the gate is an uncontrolled two-target gate with a known unitary
+ */
+bool tryPairMatrix(QGate &gate, Matrix4 &matrix);
+
+/** @brief Checking whether applyGate supports a gate
+ *
+ *
+ *  @param gate The quantum gate
+ *  @return true if the gate is a supported unitary (or a barrier)
+ */
+bool isSupportedUnitary(QGate &gate);
+
+/**
+ * @brief State-vector simulator of quantum circuits
+ *
+ * @details The 2^n amplitudes live in one buffer aligned for AVX-512 and are first
+ *          touched by the workers that later process them. Gates are applied in place
+ *          by the kernels of the instruction set selected at construction (detected at
+ *          runtime by default). Gates with a 2x2 target matrix and any number of
+ *          controls, SWAP and CSWAP, the two-qubit interactions RXX, RZZ and ISWAP, the
+ *          relative phase Toffolis (through their Clifford+T templates), LCCX and PERES
+ *          are supported, as are measurement, reset, barriers and gates conditioned on
+ *          the classical register.
+ */
+class StateVector {
+   private:
+    struct AlignedDelete {
+        void operator()(Complex *amplitudes) const;
+    };
+
+    std::size_t qubits;
+    std::unique_ptr<Complex[], AlignedDelete> amplitudes;
+    SimdLevel simd;
+    std::unique_ptr<ThreadPool> pool;
+    std::vector<std::uint8_t> cbits{};
+    std::mt19937_64 rng;
+
+    void prepare(QCircuit &qc, const std::string &func);
+
+    // applies a gate whose circuit qubit q lives at position layout[q] of the register
+    void apply(QGate &gate, const Qubit *layout);
+
+   public:
+    /**
+     * @brief Construct a simulator in the state |0...0>
+     *
+     * @param qubits The number of qubits
+     * @param threads The number of worker threads (Default 0 = hardware concurrency)
+     * @param simd The instruction set of the kernels (Default detectSimdLevel())
+     * @param seed The seed of the measurement outcomes (Default 0)
+     * @throws QcoreException if the register exceeds MAX_STATEVECTOR_QUBITS or the
+     *         processor does not support the instruction set
+     */
+    explicit StateVector(std::size_t qubits, std::size_t threads = 0, SimdLevel simd = detectSimdLevel(), std::uint64_t seed = 0);
+
+    /**
+     * @brief Reset the register to |0...0> and clear the classical bits
+     */
+    void reset();
+
+    /**
+     * @brief Apply a gate
+     *
+     * @param gate The quantum gate
+     * @throws QcoreException if the gate is not supported or acts outside the register
+     */
+    void apply(QGate &gate);
+
+    /**
+     * @brief Apply the gates of a circuit to the current state
+     *
+     * @param qc The quantum circuit
+     * @throws QcoreException if the circuit is wider than the register or a gate is not supported
+     */
+    void run(QCircuit &qc);
+
+    /**
+     * @brief Apply simulation steps prepared by fuseGates to the current state
+     *
+     * @param steps The fused blocks and single gates, referring to gates of a live circuit
+     * @throws QcoreException if a step acts outside the register or a gate is not supported
+     */
+    void run(const std::vector<SimulationStep> &steps);
+
+    /**
+     * @brief Apply simulation steps cache-blocked to the current state
+     *
+     * @details The register is cut into chunks of 2^block_qubits amplitudes, which fit
+     *          into the cache, and the steps are grouped into phases applied to one chunk
+     *          after the other, so a phase costs a single pass over memory; with a pool,
+     *          chunks are distributed over the workers. A phase takes the pending unitary
+     *          steps on at most block_qubits circuit qubits that commute with the steps
+     *          skipped before them. Its qubits outside the chunk are first exchanged in
+     *          one pass with the highest unused local positions, and steps are mapped
+     *          through the permuted layout. Measurements, resets, conditioned and wider
+     *          steps (and a phase of a single step needing an exchange) run on the whole
+     *          register; the layout is restored at the end.
+     *
+     *  @param steps The fused blocks and single gates, referring to gates of a live circuit
+     *  @param block_qubits The number of low qubits of a chunk (Default DEFAULT_BLOCK_QUBITS)
+     *  @return std::size_t The number of passes over the register: chunk sweeps, qubit swaps and global steps
+     *  @throws QcoreException if block_qubits is 0, a step acts outside the register or a gate is not supported
+     */
+    std::size_t runBlocked(const std::vector<SimulationStep> &steps, std::size_t block_qubits = DEFAULT_BLOCK_QUBITS);
+
+    /**
+     * @brief Apply the gates of a circuit cache-blocked to the current state
+     *
+     * @param qc The quantum circuit
+     * @param block_qubits The number of low qubits of a chunk (Default DEFAULT_BLOCK_QUBITS)
+     * @return std::size_t The number of passes over the register
+     * @throws QcoreException if the circuit is wider than the register or a gate is not supported
+     */
+    std::size_t runBlocked(QCircuit &qc, std::size_t block_qubits = DEFAULT_BLOCK_QUBITS);
+
+    /**
+     * @brief Measure a qubit in the computational basis and collapse the state
+     *
+     * @param qubit The qubit
+     * @return true if the outcome is 1
+     */
+    bool measure(Qubit qubit);
+
+    /**
+     * @brief Reset a qubit to |0> by measuring it and flipping a 1
+     *
+     * @param qubit The qubit
+     */
+    void reset(Qubit qubit);
+
+    /**
+     * @brief Obtain the probability of measuring 1 on a qubit
+     *
+     * @param qubit The qubit
+     * @return fp The probability
+     */
+    fp probability(Qubit qubit);
+
+    inline Complex amplitude(std::size_t index) const { return this->amplitudes[index]; }
+
+    inline AmplitudeSpan span() const { return AmplitudeSpan{this->amplitudes.get(), this->qubits}; }
+
+    inline std::size_t size() const { return std::size_t{1} << this->qubits; }
+
+    inline std::size_t getQubits() const { return this->qubits; }
+
+    inline SimdLevel getSimdLevel() const { return this->simd; }
+
+    inline ThreadPool *getPool() const { return this->pool.get(); }
+
+    inline const std::vector<std::uint8_t> &getCbits() const { return this->cbits; }
+};
+
+}  // namespace qcore
@@ -0,0 +1,55 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Extraction.hpp
+ *  @brief  Specification of the Circuit Extraction from ZX-Diagrams
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include "Definition.hpp"
+#include "QCircuit.hpp"
+#include "zx/ZXDiagram.hpp"
+
+namespace qcore {
+
+/** @brief Extracting a circuit from a graph-like ZX-diagram with generalized flow
+ *
+ * @details The frontier starts at the spiders next to the outputs and moves towards
+ *          the inputs: Hadamard edges to outputs become H gates, frontier phases phase
+ *          gates and edges inside the frontier CZ gates. A frontier spider with a single
+ *          other neighbour is replaced by that neighbour. Otherwise the biadjacency
+ *          matrix between the frontier and its neighbours is Gauss-Jordan reduced, each
+ *          row addition becoming a CX gate, or a neighbouring phase gadget is pivoted
+ *          into the frontier. Diagrams from circuitToZX and fullReduce always have such
+ *          a flow. The remaining input wires give Hadamards and a SWAP permutation.
+ *
+ *  @param diagram The ZX-diagram (consumed)
+ *  @return QGateSet The gates in circuit order over H, CX, CZ, SWAP, Clifford+T phase
+ *          gates and RZ, equal to the diagram up to global phase
+ *  @throws QcoreException if the extraction gets stuck
+ */
+QGateSet extractCircuit(ZXDiagram diagram);
+
+}  // namespace qcore
@@ -0,0 +1,228 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   FlatHashMap.hpp
+ *  @brief  Open-addressing Hash Map with Inline Storage
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace qcore {
+
+/**
+ * @brief Hash map from unsigned integers to small values stored in one flat array
+ *
+ * @details Linear probing over a power-of-two table with Fibonacci hashing; deletion
+ *          shifts the following entries back, so there are no tombstones and lookups
+ *          stay short under heavy insert/erase traffic. The largest key value is
+ *          reserved as the empty marker. Iteration visits the slots in table order.
+ *
+ * @tparam Key An unsigned integer type
+ * @tparam Value A trivially copyable value type
+ */
+template <typename Key, typename Value>
+class FlatHashMap {
+    static_assert(std::is_unsigned<Key>::value, "FlatHashMap keys must be unsigned integers");
+
+   public:
+    struct Entry {
+        Key key;
+        Value value;
+    };
+
+    static constexpr Key EMPTY = std::numeric_limits<Key>::max();
+
+    class const_iterator {
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Entry *;
+        using reference = const Entry &;
+
+       private:
+        const Entry *slot;
+        const Entry *last;
+
+        void skip() {
+            while (slot != last && slot->key == EMPTY) {
+                ++slot;
+            }
+        }
+
+       public:
+        const_iterator(const Entry *slot, const Entry *last) : slot(slot), last(last) { skip(); }
+
+        const Entry &operator*() const { return *slot; }
+
+        const Entry *operator->() const { return slot; }
+
+        const_iterator &operator++() {
+            ++slot;
+            skip();
+            return *this;
+        }
+
+        bool operator!=(const const_iterator &other) const { return slot != other.slot; }
+
+        bool operator==(const const_iterator &other) const { return slot == other.slot; }
+    };
+
+   private:
+    std::vector<Entry> slots;
+    std::size_t entries = 0;
+    unsigned shift = 64;
+
+    inline std::size_t home(Key key) const {
+        return static_cast<std::size_t>((static_cast<std::uint64_t>(key) * 0x9E3779B97F4A7C15ULL) >> this->shift);
+    }
+
+    inline std::size_t mask() const { return this->slots.size() - 1; }
+
+    void rehash(std::size_t capacity) {
+        std::vector<Entry> previous(capacity, Entry{EMPTY, Value{}});
+        previous.swap(this->slots);
+        this->shift = 64;
+        for (std::size_t size = capacity; size > 1; size >>= 1) {
+            --this->shift;
+        }
+        for (const auto &entry : previous) {
+            if (entry.key != EMPTY) {
+                std::size_t i = home(entry.key);
+                while (this->slots[i].key != EMPTY) {
+                    i = (i + 1) & mask();
+                }
+                this->slots[i] = entry;
+            }
+        }
+    }
+
+    inline std::size_t slotOf(Key key) const {
+        if (this->entries == 0) {
+            return this->slots.size();
+        }
+        for (std::size_t i = home(key);; i = (i + 1) & mask()) {
+            if (this->slots[i].key == key) {
+                return i;
+            }
+            if (this->slots[i].key == EMPTY) {
+                return this->slots.size();
+            }
+        }
+    }
+
+   public:
+    inline std::size_t size() const { return this->entries; }
+
+    inline bool empty() const { return this->entries == 0; }
+
+    inline const_iterator begin() const { return const_iterator(this->slots.data(), this->slots.data() + this->slots.size()); }
+
+    inline const_iterator end() const {
+        return const_iterator(this->slots.data() + this->slots.size(), this->slots.data() + this->slots.size());
+    }
+
+    inline bool contains(Key key) const { return slotOf(key) != this->slots.size(); }
+
+    /**
+     * @brief Look up the value of a key
+     *
+     * @param key The key
+     * @return Value* The stored value, nullptr if the key is absent
+     */
+    inline Value *find(Key key) {
+        const std::size_t i = slotOf(key);
+        return (i == this->slots.size()) ? nullptr : &this->slots[i].value;
+    }
+
+    inline const Value *find(Key key) const {
+        const std::size_t i = slotOf(key);
+        return (i == this->slots.size()) ? nullptr : &this->slots[i].value;
+    }
+
+    /**
+     * @brief Insert a key or overwrite its value
+     *
+     * @param key The key, not EMPTY
+     * @param value The value
+     * @return true if the key was not present before
+     */
+    bool insert(Key key, Value value) {
+        if (4 * (this->entries + 1) > 3 * this->slots.size()) {
+            rehash(this->slots.empty() ? 8 : 2 * this->slots.size());
+        }
+        std::size_t i = home(key);
+        while (this->slots[i].key != EMPTY) {
+            if (this->slots[i].key == key) {
+                this->slots[i].value = value;
+                return false;
+            }
+            i = (i + 1) & mask();
+        }
+        this->slots[i] = Entry{key, value};
+        ++this->entries;
+        return true;
+    }
+
+    /**
+     * @brief Remove a key
+     *
+     * @param key The key
+     * @return true if the key was present
+     */
+    bool erase(Key key) {
+        std::size_t i = slotOf(key);
+        if (i == this->slots.size()) {
+            return false;
+        }
+
+        // shift back every following entry whose probe sequence passes the hole
+        for (std::size_t j = (i + 1) & mask(); this->slots[j].key != EMPTY; j = (j + 1) & mask()) {
+            const std::size_t k = home(this->slots[j].key);
+            const bool between = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+            if (!between) {
+                this->slots[i] = this->slots[j];
+                i = j;
+            }
+        }
+        this->slots[i] = Entry{EMPTY, Value{}};
+        --this->entries;
+        return true;
+    }
+
+    void clear() {
+        this->slots.clear();
+        this->entries = 0;
+        this->shift = 64;
+    }
+};
+
+}  // namespace qcore
@@ -0,0 +1,119 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Simplify.hpp
+ *  @brief  Specification of the ZX-Calculus Rewrite Rules
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include "Definition.hpp"
+#include "zx/ZXDiagram.hpp"
+
+namespace qcore {
+
+/** @brief Fusing a Z spider into a neighbouring Z spider (spider fusion)
+ *
+ * @details v is removed, its phase is added to u and its other edges are moved to u,
+ *          where parallel edges are resolved by ZXDiagram::addEdge.
+ *
+ *  @param diagram The ZX-diagram
+ *  @param u The surviving spider
+ *  @param v The spider fused into u, connected to u by a simple edge
+ */
+void fuseSpiders(ZXDiagram &diagram, vertex_t u, vertex_t v);
+
+/** @brief Bringing a diagram into graph-like form
+ *
+ * @details All Z spiders connected by simple edges are fused, so every remaining edge
+ *          between spiders is a Hadamard edge, and a phase-free spider is put on every
+ *          edge that connects two boundaries.
+ *
+ *  @param diagram The ZX-diagram
+ */
+void toGraphLike(ZXDiagram &diagram);
+
+/** @brief Removing an interior spider with phase +-pi/2 by local complementation
+ *
+ * @details The edges between all pairs of neighbours are toggled and the phase of v
+ *          is subtracted from every neighbour.
+ *
+ *  @param diagram The graph-like ZX-diagram
+ *  @param v The spider
+ */
+void localComplement(ZXDiagram &diagram, vertex_t v);
+
+/** @brief Removing two connected interior spiders with phase 0 or pi by pivoting
+ *
+ * @details With U, V the exclusive and W the common neighbours of u and v, the edges
+ *          between U-V, U-W and V-W are toggled; U gains the phase of v, V the phase of
+ *          u and W both phases plus pi.
+ *
+ *  @param diagram The graph-like ZX-diagram
+ *  @param u The first spider
+ *  @param v The second spider, connected to u
+ */
+void pivot(ZXDiagram &diagram, vertex_t u, vertex_t v);
+
+/** @brief Moving the phase of a spider onto a new phase gadget
+ *
+ * @details v keeps its edges with phase 0 and gains a Hadamard edge to a new phase-free
+ *          hub, which carries the new leaf with the former phase of v.
+ *
+ *  @param diagram The graph-like ZX-diagram
+ *  @param v The spider
+ *  @return vertex_t The hub of the new gadget
+ */
+vertex_t unfusePhaseGadget(ZXDiagram &diagram, vertex_t v);
+
+/** @brief Fusing phase gadgets acting on the same spiders
+ *
+ * @details A gadget is a leaf spider of degree one attached to an interior hub with
+ *          phase 0 or pi (a pi is moved onto the leaf as a sign). Gadgets with the same
+ *          hub neighbourhood are merged into one leaf by adding phases; gadgets whose
+ *          phase vanishes are removed.
+ *
+ *  @param diagram The graph-like ZX-diagram
+ *  @return std::size_t The number of gadgets removed
+ */
+std::size_t fuseGadgets(ZXDiagram &diagram);
+
+/** @brief Simplifying a diagram to a reduced graph-like form
+ *
+ * @details After toGraphLike, the rules are matched incrementally from a work list:
+ *          phase-free spiders of degree two are removed, interior +-pi/2 spiders are
+ *          removed by local complementation and connected interior Pauli spiders by
+ *          pivoting. With gadgets set, an interior Pauli spider next to an interior
+ *          non-Clifford spider is pivoted after the non-Clifford phase is unfused into a
+ *          phase gadget, and gadgets on the same spiders are fused. Only the vertices a
+ *          rewrite touched are matched again, so each rewrite costs time in the size of
+ *          the neighbourhoods involved. Every rule keeps the diagram extractable.
+ *
+ *  @param diagram The ZX-diagram
+ *  @param gadgets Creating and fusing phase gadgets (Default True)
+ *  @return std::size_t The number of rewrites applied
+ */
+std::size_t fullReduce(ZXDiagram &diagram, bool gadgets = true);
+
+}  // namespace qcore
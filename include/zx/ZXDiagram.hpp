@@ -0,0 +1,197 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   ZXDiagram.hpp
+ *  @brief  ZX-Diagram Representation of Quantum Circuits
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Definition.hpp"
+#include "GateType.hpp"
+#include "QCircuit.hpp"
+#include "zx/FlatHashMap.hpp"
+
+namespace qcore {
+
+// vertex identifier of a ZX-diagram
+using vertex_t = std::uint32_t;
+
+enum class VertexType : std::uint8_t {
+    BOUNDARY,  // input or output of the diagram
+    Z          // Z spider; X spiders are Z spiders with all their edges Hadamard-toggled
+};
+
+enum class EdgeType : std::uint8_t {
+    SIMPLE,
+    HADAMARD
+};
+
+using Neighbourhood = FlatHashMap<vertex_t, EdgeType>;
+
+/**
+ * @brief Undirected ZX-diagram over Z spiders, Hadamard edges and boundaries
+ *
+ * @details Phases are kept in radian, normalized to [0, 2pi), and the diagram is equal
+ *          to its circuit up to a global scalar. Each vertex stores its neighbours in a
+ *          flat hash map, so edge lookups, insertions and removals take constant time
+ *          and rewrite rules only touch the vertices they change. Removed vertex ids
+ *          are not reused.
+ */
+class ZXDiagram {
+   private:
+    std::vector<VertexType> types;
+    std::vector<fp> phases;
+    std::vector<Neighbourhood> adjacency;
+    std::vector<bool> alive;
+    std::vector<vertex_t> inputs;
+    std::vector<vertex_t> outputs;
+    std::size_t vertices = 0;
+    std::size_t edges = 0;
+
+   public:
+    ZXDiagram() = default;
+
+    /**
+     * @brief Add a vertex
+     *
+     * @param type The vertex type
+     * @param phase The phase in radian (Default 0)
+     * @return vertex_t The new vertex
+     */
+    vertex_t addVertex(VertexType type, fp phase = 0);
+
+    /**
+     * @brief Remove a vertex together with its edges
+     *
+     * @param v The vertex
+     */
+    void removeVertex(vertex_t v);
+
+    /**
+     * @brief Add an edge, resolving parallel edges and self-loops between Z spiders
+     *
+     * @details A Hadamard self-loop adds pi to the phase, a simple one vanishes. Two
+     *          Hadamard edges cancel (Hopf law). A simple edge next to a Hadamard edge is
+     *          kept as a simple edge and pi is added to u: once the spiders are fused
+     *          along the simple edge the Hadamard edge is a self-loop.
+     *
+     *  @param u The first vertex
+     *  @param v The second vertex
+     *  @param type The edge type
+     *  @throws QcoreException for a parallel edge at a boundary
+     */
+    void addEdge(vertex_t u, vertex_t v, EdgeType type);
+
+    /**
+     * @brief Remove the edge between two vertices if present
+     *
+     * @param u The first vertex
+     * @param v The second vertex
+     */
+    void removeEdge(vertex_t u, vertex_t v);
+
+    /**
+     * @brief Set the type of an existing edge
+     *
+     * @param u The first vertex
+     * @param v The second vertex
+     * @param type The new edge type
+     */
+    void setEdgeType(vertex_t u, vertex_t v, EdgeType type);
+
+    inline bool isConnected(vertex_t u, vertex_t v) const { return this->adjacency[u].contains(v); }
+
+    // type of the edge between u and v, which must exist
+    inline EdgeType getEdgeType(vertex_t u, vertex_t v) const { return *this->adjacency[u].find(v); }
+
+    inline const Neighbourhood &getNeighbours(vertex_t v) const { return this->adjacency[v]; }
+
+    inline std::size_t degree(vertex_t v) const { return this->adjacency[v].size(); }
+
+    inline VertexType getType(vertex_t v) const { return this->types[v]; }
+
+    inline bool isBoundary(vertex_t v) const { return this->types[v] == VertexType::BOUNDARY; }
+
+    inline bool isAlive(vertex_t v) const { return v < this->alive.size() && this->alive[v]; }
+
+    inline fp getPhase(vertex_t v) const { return this->phases[v]; }
+
+    void setPhase(vertex_t v, fp phase);
+
+    void addToPhase(vertex_t v, fp phase);
+
+    inline std::vector<vertex_t> &getInputs() { return this->inputs; }
+
+    inline std::vector<vertex_t> &getOutputs() { return this->outputs; }
+
+    inline const std::vector<vertex_t> &getInputs() const { return this->inputs; }
+
+    inline const std::vector<vertex_t> &getOutputs() const { return this->outputs; }
+
+    // number of live vertices
+    inline std::size_t vertexCount() const { return this->vertices; }
+
+    // one past the largest vertex id handed out so far
+    inline std::size_t vertexBound() const { return this->types.size(); }
+
+    inline std::size_t edgeCount() const { return this->edges; }
+
+    /**
+     * @brief Check whether no neighbour of a vertex is a boundary
+     *
+     * @param v The vertex
+     * @return true if v is an interior vertex
+     */
+    bool isInterior(vertex_t v) const;
+};
+
+/** @brief Checking whether a gate has a ZX-diagram translation
+ *
+ *
+ *  @param gate The quantum gate
+ *  @return true for unconditioned I, H, X, Y, Z, S, SDG, T, TDG, SX, SXDG, RX, RZ,
+ *          P, U1, CX, CZ and SWAP gates with constant angles
+ */
+bool isZXGate(QGate &gate);
+
+/** @brief Translating a quantum circuit into a ZX-diagram
+ *
+ * @details Every qubit gets an input and an output boundary. Z phases become Z spiders,
+ *          X phases Z spiders behind and before a Hadamard edge, CZ a Hadamard edge
+ *          between two Z spiders and CX a Hadamard edge from the control spider to the
+ *          target spider sitting between Hadamard edges; H only toggles the type of the
+ *          next wire edge and SWAP exchanges wire ends. Phases are fused into the last
+ *          spider of a wire while that wire ends in a simple edge.
+ *
+ *  @param qc The quantum circuit
+ *  @return ZXDiagram The diagram, equal to the circuit up to a global scalar
+ *  @throws QcoreException if a gate has no translation (see isZXGate)
+ */
+ZXDiagram circuitToZX(QCircuit &qc);
+
+}  // namespace qcore
@@ -12,6 +12,8 @@
 
 #include "QCircuit.hpp"
 #include "QGate.hpp"
+#include "analysis/Batch.hpp"
+#include "optimize/PassManager.hpp"
 
 
 
@@ -92,6 +94,57 @@ nl::json writeQASM(const nl::json &jqasm, const std::string &filename) {
     return j_string;
 }
 
+nl::json batchCircuitProperties(const nl::json &inputs, std::size_t threads, bool columnar) {
+    qcore::BatchSummary summaries{};
+    if (inputs.is_string()) {
+        summaries = qcore::analyzeQCircuitDirectory(inputs.get<std::string>(), threads);
+    }
+    else {
+        summaries = qcore::analyzeQCircuits(inputs.get<std::vector<std::string>>(), threads);
+    }
+
+    return columnar ? qcore::toColumnarJSON(summaries) : qcore::toJSON(summaries);
+}
+
+nl::json compileQASM(const nl::json &inputs, const std::vector<std::string> &passes, bool fixed_point, std::size_t max_iterations, std::size_t threads) {
+    auto manager = qcore::PassManager(fixed_point, max_iterations);
+    for (const auto &pass : passes) {
+        manager.addPass(pass);
+    }
+
+    std::vector<std::string> sources = inputs.is_string() ? std::vector<std::string>{inputs.get<std::string>()}
+                                                          : inputs.get<std::vector<std::string>>();
+    std::vector<std::unique_ptr<qcore::QCircuit>> circuits(sources.size());
+    std::vector<std::string> errors(sources.size());
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+        try {
+            circuits[i] = std::make_unique<qcore::QCircuit>();
+            auto is = std::istringstream(sources[i]);
+            circuits[i]->readQASM(is);
+        }
+        catch (const std::exception &ex) {
+            circuits[i].reset();
+            errors[i] = ex.what();
+        }
+    }
+
+    auto reports = manager.run(circuits, threads);
+
+    nl::json results = nl::json::array();
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+        nl::json result = qcore::toJSON(reports[i]);
+        if (circuits[i] && reports[i].valid) {
+            result["QASM"] = circuits[i]->toString(qcore::FileFormat::OpenQASM);
+        }
+        else if (!errors[i].empty()) {
+            result["Error"] = errors[i];
+        }
+        results.push_back(result);
+    }
+
+    return inputs.is_string() ? results[0] : results;
+}
+
 PYBIND11_MODULE(pyqcore, m) {
     m.doc() = R"pbdoc(
         Python interface for the QCORE quantum core library
@@ -101,6 +154,8 @@ PYBIND11_MODULE(pyqcore, m) {
            read_From_File
            readQASM
            circuitProperties
+           batchCircuitProperties
+           compileQASM
            writeQASM
     )pbdoc";
 
@@ -117,6 +172,30 @@ PYBIND11_MODULE(pyqcore, m) {
         number of gates of each type:
     )pbdoc");
 
+    m.def("batchCircuitProperties", &batchCircuitProperties, R"pbdoc(
+        Provides the circuitProperties summary of many QASM files at once
+        -----------------------------------------------------------------
+        inputs: a list of file paths or a directory searched for *.qasm files
+        threads: number of worker threads (0 = all cores)
+        columnar: return one array per property instead of one object per file
+        files that fail to parse carry an Error entry instead of properties
+    )pbdoc",
+    py::arg("inputs"), py::arg("threads") = 0, py::arg("columnar") = false,
+    py::call_guard<py::gil_scoped_release>());
+
+    m.def("compileQASM", &compileQASM, R"pbdoc(
+        Runs a pipeline of optimization passes over one or many QASM strings
+        --------------------------------------------------------------------
+        inputs: a QASM string or a list of QASM strings
+        passes: names of built-in passes, applied in order
+        fixed_point: repeat the pipeline while the gate count shrinks
+        max_iterations: upper bound on pipeline repetitions
+        threads: number of worker threads over the circuits (0 = all cores)
+        returns the optimized QASM with per-pass wall time, peak memory and gate delta
+    )pbdoc",
+    py::arg("inputs"), py::arg("passes"), py::arg("fixed_point") = false, py::arg("max_iterations") = 16,
+    py::arg("threads") = 0, py::call_guard<py::gil_scoped_release>());
+
     m.def("writeQASM", &writeQASM, "write quantum circuit to a file",
     "file_name");
 
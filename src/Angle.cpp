@@ -0,0 +1,227 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Angle.cpp
+ *  @brief  Instance Description for the Numeric View of Rotation Angles
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "Angle.hpp"
+
+#include <cctype>
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+
+namespace qcore {
+
+/*
+ * Recursive descent evaluation of
+ *   expr    := term (('+' | '-') term)*
+ *   term    := unary (('*' | '/') unary)*
+ *   unary   := ('+' | '-') unary | primary
+ *   primary := number [primary] | 'pi' | '(' expr ')'
+ */
+class AngleParser {
+   private:
+    const std::string &text;
+    std::size_t pos;
+
+    void skipSpaces() {
+        while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) {
+            ++pos;
+        }
+    }
+
+    bool accept(char ch) {
+        skipSpaces();
+        if (pos < text.size() && text[pos] == ch) {
+            ++pos;
+            return true;
+        }
+        return false;
+    }
+
+    bool acceptPi() {
+        skipSpaces();
+        if (text.compare(pos, 2, "pi") == 0) {
+            pos += 2;
+            return true;
+        }
+        if (text.compare(pos, 2, "\xCF\x80") == 0) {  // UTF-8 encoded π
+            pos += 2;
+            return true;
+        }
+        return false;
+    }
+
+    bool atPrimary() {
+        skipSpaces();
+        return pos < text.size() && (text[pos] == '(' || text[pos] == 'p' || text[pos] == '\xCF');
+    }
+
+    fp primary() {
+        if (accept('(')) {
+            fp value = expr();
+            if (!accept(')')) {
+                throw QcoreException("[angleValue] angle: " + text + " msg: missing ')'");
+            }
+            return value;
+        }
+
+        if (acceptPi()) {
+            return PI;
+        }
+
+        skipSpaces();
+        const char *begin = text.c_str() + pos;
+        char *end = nullptr;
+        fp value = std::strtod(begin, &end);
+        if (end == begin) {
+            throw QcoreException("[angleValue] angle: " + text + " msg: not a constant expression");
+        }
+        pos += static_cast<std::size_t>(end - begin);
+
+        // implicit multiplication such as "2pi" or "3(pi/4)"
+        if (atPrimary()) {
+            value *= primary();
+        }
+        return value;
+    }
+
+    fp unary() {
+        if (accept('-')) {
+            return -unary();
+        }
+        if (accept('+')) {
+            return unary();
+        }
+        return primary();
+    }
+
+    fp term() {
+        fp value = unary();
+        while (true) {
+            if (accept('*')) {
+                value *= unary();
+            } else if (accept('/')) {
+                fp divisor = unary();
+                if (divisor == 0) {
+                    throw QcoreException("[angleValue] angle: " + text + " msg: division by zero");
+                }
+                value /= divisor;
+            } else {
+                return value;
+            }
+        }
+    }
+
+    fp expr() {
+        fp value = term();
+        while (true) {
+            if (accept('+')) {
+                value += term();
+            } else if (accept('-')) {
+                value -= term();
+            } else {
+                return value;
+            }
+        }
+    }
+
+   public:
+    explicit AngleParser(const std::string &text) : text(text), pos(0) {}
+
+    fp parse() {
+        fp value = expr();
+        skipSpaces();
+        if (pos != text.size()) {
+            throw QcoreException("[angleValue] angle: " + text + " msg: unexpected '" + text.substr(pos) + "'");
+        }
+        return value;
+    }
+};
+
+fp angleValue(const angle_t &angle) {
+    return AngleParser(angle).parse();
+}
+
+bool tryAngleValue(const angle_t &angle, fp &value) {
+    try {
+        value = angleValue(angle);
+        return true;
+    } catch (const QcoreException &) {
+        return false;
+    }
+}
+
+fp normalizeAngle(fp value, fp period) {
+    value = std::fmod(value, period);
+    if (value < 0) {
+        value += period;
+    }
+    if (value < ANGLE_TOLERANCE || period - value < ANGLE_TOLERANCE) {
+        return 0;
+    }
+    return value;
+}
+
+bool isAngleMultiple(fp value, fp unit, std::int64_t &multiple) {
+    fp ratio = normalizeAngle(value) / unit;
+    fp nearest = std::round(ratio);
+    if (std::abs(ratio - nearest) * unit > ANGLE_TOLERANCE) {
+        return false;
+    }
+
+    auto count = static_cast<std::int64_t>(std::llround(2 * PI / unit));
+    multiple = static_cast<std::int64_t>(nearest);
+    if (count > 0) {
+        multiple %= count;
+    }
+    return true;
+}
+
+angle_t angleString(fp value) {
+    value = normalizeAngle(value);
+    if (value == 0) {
+        return "0.0";
+    }
+
+    // the QASM parser reads "pi" and "pi/<n>" symbolically
+    for (std::int64_t denominator = 1; denominator <= 64; denominator *= 2) {
+        if (std::abs(value - PI / static_cast<fp>(denominator)) < ANGLE_TOLERANCE) {
+            return denominator == 1 ? "pi" : "pi/" + std::to_string(denominator);
+        }
+    }
+
+    auto os = std::ostringstream();
+    os << std::fixed << std::setprecision(15) << value;
+    std::string text = os.str();
+    text.erase(text.find_last_not_of('0') + 1);
+    if (text.back() == '.') {
+        text += '0';
+    }
+    return text;
+}
+
+}  // namespace qcore
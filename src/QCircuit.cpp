@@ -41,6 +41,28 @@ depth_t QCircuit::getDepth() {
     return max_depth;
 }
 
+void QCircuit::updateProperties() {
+    this->max_gate_size = 0;
+    this->depth = QubitDepthMap{};
+    this->properties = PropertiesMap{};
+
+    for (auto& g : this->gates) {
+        this->properties[g->getType()] += 1;
+
+        gsize_t gate_size = g->getControls().size() + g->getTargets().size();
+        if (this->max_gate_size < gate_size) {
+            this->max_gate_size = gate_size;
+        }
+
+        for (auto qubit : g->getControls()) {
+            this->depth[qubit] += 1;
+        }
+        for (auto qubit : g->getTargets()) {
+            this->depth[qubit] += 1;
+        }
+    }
+}
+
 std::string QCircuit::toString(const FileFormat& format) {
     if (format == FileFormat::OpenQASM) {
         auto os = std::ostringstream();
@@ -86,19 +108,24 @@ void QCircuit::addQCircuit(QCircuit& qc){
     moveQGates(this->gates, qc.gates);
 }
 
+void QCircuit::addQCircuit(QCircuit&& qc){
+    moveQGates(this->gates, qc.gates);
+}
+
 void QCircuit::addQCircuit(const QCircuit& qc, int s, int e){
     for (ConstantQGateIterator g = qc.gates.begin() + s; g + e != qc.gates.end(); ++g) {
         this->gates.push_back(QGatePtr(new QGate(**g)));
     }
 }
 
-QCircuit& QCircuit::inverse(){
+QCircuit QCircuit::inverse(){
     auto qc = QCircuit{};
     qc.setQubits(this->qubits);
     qc.gates.reserve(this->gates.size());
     for (auto i = this->gates.rbegin(); i != this->gates.rend(); ++i){
         qc.addQGate(static_cast<QGate&>(**i).inverse());
     }
+    return qc;
 }
 
 FileFormat QCircuit::writeQCircuit(const std::string& filename) {
@@ -189,7 +216,7 @@ void QCircuit::clone(const QCircuit& ckt) {
     init();
 
     this->qreg = ckt.qreg;
-    this->qreg = ckt.creg;
+    this->creg = ckt.creg;
     this->max_gate_size = ckt.max_gate_size;
     this->qubits = ckt.qubits;
     this->cbits = ckt.cbits;
@@ -203,7 +230,7 @@ void QCircuit::clone(const QCircuit& ckt) {
 
 void QCircuit::init() {
     this->qreg = 0;
-    this->qreg = 0;
+    this->creg = 0;
     this->max_gate_size = 0;
     this->qubits = QubitSet{};
     this->cbits = CbitSet{};
@@ -219,7 +246,7 @@ void exchangeQubits(QubitSet& qubits, int i, int j) {
     qubits[j] = qubit;
 }
 
-QubitSet& mergeQubits(const std::vector<QubitSet>& q_sets) {
+QubitSet mergeQubits(const std::vector<QubitSet>& q_sets) {
     size_t total_size = 0;
     for (const auto& q_set : q_sets) {
         total_size = q_set.size();
@@ -259,4 +286,10 @@ void moveQGates(QGateSet& dest, QGateSet& src) {
     dest.reserve(dest.size() + src.size());
     std::move(std::make_move_iterator(src.begin()), std::make_move_iterator(src.end()), std::back_inserter(dest));
 }
+
+gcount_t removeEmptyQGates(QGateSet& gates) {
+    auto size = gates.size();
+    gates.erase(std::remove(gates.begin(), gates.end(), nullptr), gates.end());
+    return size - gates.size();
+}
 }  // namespace qcore
@@ -35,7 +35,7 @@
 
 namespace qcore {
 
-std::uint64_t QGate::gate_count = 0;
+std::atomic<std::uint64_t> QGate::gate_count{0};
 
 bool QGateCompare::operator()(const QGate &lhs, const QGate &rhs) {
     return lhs.getId() < rhs.getId();
@@ -162,9 +162,11 @@ QGate::QGate(const QGate &g) {
     this->controls = g.controls;
     this->targets = g.targets;
     this->cbits = g.cbits;
+    this->flag = g.flag;
+    this->expression = g.expression;
 }
 
-QGate& QGate::inverse(){
+QGate QGate::inverse(){
     auto gate = QGate{*this}; 
     gate.gate_type = inverseGateType(gate.gate_type);
     //Rotations and other parameterized gates need to be specified
@@ -179,6 +181,8 @@ QGate &QGate::operator=(const QGate &g) {
     this->controls = g.controls;
     this->targets = g.targets;
     this->cbits = g.cbits;
+    this->flag = g.flag;
+    this->expression = g.expression;
     return *this;
 }
 
@@ -0,0 +1,311 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   Tableau.cpp
+ *  @brief  Instance Description for the Stabilizer Tableau Representation of Clifford Circuits
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "Tableau.hpp"
+
+#include <algorithm>
+#include <bitset>
+
+namespace qcore {
+
+CliffordTableau::CliffordTableau(std::size_t qubits)
+    : qubits(qubits), words((2 * qubits + 63) / 64), x_bits(qubits * words, 0), z_bits(qubits * words, 0), r_bits(words, 0) {
+    for (std::size_t q = 0; q < qubits; ++q) {
+        xColumn(q)[q >> 6] |= std::uint64_t{1} << (q & 63);
+        zColumn(q)[(qubits + q) >> 6] |= std::uint64_t{1} << ((qubits + q) & 63);
+    }
+}
+
+void CliffordTableau::h(std::size_t q) {
+    std::uint64_t *xq = xColumn(q), *zq = zColumn(q), *r = this->r_bits.data();
+    for (std::size_t w = 0; w < this->words; ++w) {
+        r[w] ^= xq[w] & zq[w];
+        std::uint64_t t = xq[w];
+        xq[w] = zq[w];
+        zq[w] = t;
+    }
+}
+
+void CliffordTableau::s(std::size_t q) {
+    std::uint64_t *xq = xColumn(q), *zq = zColumn(q), *r = this->r_bits.data();
+    for (std::size_t w = 0; w < this->words; ++w) {
+        r[w] ^= xq[w] & zq[w];
+        zq[w] ^= xq[w];
+    }
+}
+
+void CliffordTableau::sdg(std::size_t q) {
+    std::uint64_t *xq = xColumn(q), *zq = zColumn(q), *r = this->r_bits.data();
+    for (std::size_t w = 0; w < this->words; ++w) {
+        r[w] ^= xq[w] & ~zq[w];
+        zq[w] ^= xq[w];
+    }
+}
+
+void CliffordTableau::x(std::size_t q) {
+    std::uint64_t *zq = zColumn(q), *r = this->r_bits.data();
+    for (std::size_t w = 0; w < this->words; ++w) {
+        r[w] ^= zq[w];
+    }
+}
+
+void CliffordTableau::y(std::size_t q) {
+    std::uint64_t *xq = xColumn(q), *zq = zColumn(q), *r = this->r_bits.data();
+    for (std::size_t w = 0; w < this->words; ++w) {
+        r[w] ^= xq[w] ^ zq[w];
+    }
+}
+
+void CliffordTableau::z(std::size_t q) {
+    std::uint64_t *xq = xColumn(q), *r = this->r_bits.data();
+    for (std::size_t w = 0; w < this->words; ++w) {
+        r[w] ^= xq[w];
+    }
+}
+
+void CliffordTableau::cx(std::size_t control, std::size_t target) {
+    std::uint64_t *xc = xColumn(control), *zc = zColumn(control);
+    std::uint64_t *xt = xColumn(target), *zt = zColumn(target), *r = this->r_bits.data();
+    for (std::size_t w = 0; w < this->words; ++w) {
+        r[w] ^= xc[w] & zt[w] & ~(xt[w] ^ zc[w]);
+        xt[w] ^= xc[w];
+        zc[w] ^= zt[w];
+    }
+}
+
+void CliffordTableau::cz(std::size_t a, std::size_t b) {
+    std::uint64_t *xa = xColumn(a), *za = zColumn(a);
+    std::uint64_t *xb = xColumn(b), *zb = zColumn(b), *r = this->r_bits.data();
+    for (std::size_t w = 0; w < this->words; ++w) {
+        r[w] ^= xa[w] & xb[w] & (za[w] ^ zb[w]);
+        za[w] ^= xb[w];
+        zb[w] ^= xa[w];
+    }
+}
+
+void CliffordTableau::cy(std::size_t control, std::size_t target) {
+    sdg(target);
+    cx(control, target);
+    s(target);
+}
+
+void CliffordTableau::swap(std::size_t a, std::size_t b) {
+    std::swap_ranges(xColumn(a), xColumn(a) + this->words, xColumn(b));
+    std::swap_ranges(zColumn(a), zColumn(a) + this->words, zColumn(b));
+}
+
+bool isTableauGate(QGate &gate) {
+    if (gate.getIsClassical()) {
+        return false;
+    }
+
+    const auto controls = gate.getControls().size(), targets = gate.getTargets().size();
+    switch (gate.getType()) {
+        case GateType::H:
+        case GateType::S:
+        case GateType::SDG:
+        case GateType::X:
+        case GateType::Y:
+        case GateType::Z:
+            return controls == 0 && targets == 1;
+        case GateType::CX:
+        case GateType::CZ:
+            return controls == 1 && targets == 1 && gate.getControls()[0] != gate.getTargets()[0];
+        case GateType::SWAP:
+            return controls == 0 && targets == 2 && gate.getTargets()[0] != gate.getTargets()[1];
+        default:
+            return false;
+    }
+}
+
+bool CliffordTableau::apply(QGate &gate) {
+    if (!isTableauGate(gate)) {
+        return false;
+    }
+
+    auto &targets = gate.getTargets();
+    for (auto q : targets) {
+        if (q >= this->qubits) {
+            return false;
+        }
+    }
+    if (!gate.getControls().empty() && gate.getControls()[0] >= this->qubits) {
+        return false;
+    }
+
+    switch (gate.getType()) {
+        case GateType::H:
+            h(targets[0]);
+            break;
+        case GateType::S:
+            s(targets[0]);
+            break;
+        case GateType::SDG:
+            sdg(targets[0]);
+            break;
+        case GateType::X:
+            x(targets[0]);
+            break;
+        case GateType::Y:
+            y(targets[0]);
+            break;
+        case GateType::Z:
+            z(targets[0]);
+            break;
+        case GateType::CX:
+            cx(gate.getControls()[0], targets[0]);
+            break;
+        case GateType::CZ:
+            cz(gate.getControls()[0], targets[0]);
+            break;
+        default:
+            swap(targets[0], targets[1]);
+            break;
+    }
+    return true;
+}
+
+bool CliffordTableau::isDeterministic(std::size_t q) const {
+    // the stabilizers are the rows n to 2n - 1, the rows past 2n are never set
+    const std::uint64_t *xq = this->x_bits.data() + q * this->words;
+    for (std::size_t w = this->qubits >> 6; w < this->words; ++w) {
+        const std::uint64_t stabilizers = (w == (this->qubits >> 6)) ? ~std::uint64_t{0} << (this->qubits & 63) : ~std::uint64_t{0};
+        if ((xq[w] & stabilizers) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CliffordTableau::measure(std::size_t q, bool coin) {
+    const std::size_t n = this->qubits;
+    std::uint64_t *r = this->r_bits.data();
+
+    std::size_t p = n;
+    while (p < 2 * n && !xBit(p, q)) {
+        ++p;
+    }
+
+    if (p == 2 * n) {
+        // the stabilizers n + i with x_iq = 1 (in row order) multiply to +-Z_q
+        std::vector<std::uint64_t> selected(this->words, 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (xBit(i, q)) {
+                selected[(n + i) >> 6] |= std::uint64_t{1} << ((n + i) & 63);
+            }
+        }
+        // only the words from row n on hold selected rows
+        const std::size_t first = n >> 6;
+        std::int64_t phase = 0;
+        for (std::size_t w = first; w < this->words; ++w) {
+            phase += 2 * std::bitset<64>(r[w] & selected[w]).count();
+        }
+        for (std::size_t j = 0; j < n; ++j) {
+            const std::uint64_t *xj = this->x_bits.data() + j * this->words, *zj = this->z_bits.data() + j * this->words;
+            std::uint64_t x_carry = 0, z_carry = 0;
+            for (std::size_t w = first; w < this->words; ++w) {
+                const std::uint64_t x1 = xj[w] & selected[w], z1 = zj[w] & selected[w];
+                // the running product before each row: exclusive prefix parities
+                std::uint64_t x2 = x1, z2 = z1;
+                for (unsigned shift = 1; shift < 64; shift <<= 1) {
+                    x2 ^= x2 << shift;
+                    z2 ^= z2 << shift;
+                }
+                const std::uint64_t x_all = x2 >> 63, z_all = z2 >> 63;
+                x2 = (x2 << 1) ^ (0 - x_carry);
+                z2 = (z2 << 1) ^ (0 - z_carry);
+                x_carry ^= x_all;
+                z_carry ^= z_all;
+
+                const std::uint64_t y = x1 & z1, x = x1 & ~z1, z = ~x1 & z1;
+                const std::uint64_t plus = (y & z2 & ~x2) | (x & z2 & x2) | (z & x2 & ~z2);
+                const std::uint64_t minus = (y & x2 & ~z2) | (x & z2 & ~x2) | (z & x2 & z2);
+                phase += static_cast<std::int64_t>(std::bitset<64>(plus).count()) - static_cast<std::int64_t>(std::bitset<64>(minus).count());
+            }
+        }
+        return ((phase % 4) + 4) % 4 == 2;
+    }
+
+    // every other row with an X part on q becomes its product with row p
+    std::vector<std::uint64_t> rows(xColumn(q), xColumn(q) + this->words), low(this->words, 0), high(this->words, 0);
+    rows[p >> 6] &= ~(std::uint64_t{1} << (p & 63));
+    for (std::size_t j = 0; j < n; ++j) {
+        const bool xp = xBit(p, j), zp = zBit(p, j);
+        if (!xp && !zp) {
+            continue;
+        }
+        std::uint64_t *xj = xColumn(j), *zj = zColumn(j);
+        for (std::size_t w = 0; w < this->words; ++w) {
+            const std::uint64_t x2 = xj[w], z2 = zj[w];
+            std::uint64_t plus = 0, minus = 0;
+            if (xp && zp) {
+                plus = z2 & ~x2;
+                minus = x2 & ~z2;
+            } else if (xp) {
+                plus = z2 & x2;
+                minus = z2 & ~x2;
+            } else {
+                plus = x2 & ~z2;
+                minus = x2 & z2;
+            }
+            plus &= rows[w];
+            minus &= rows[w];
+            high[w] ^= low[w] & plus;
+            low[w] ^= plus;
+            high[w] ^= ~low[w] & minus;
+            low[w] ^= minus;
+            xj[w] ^= xp ? rows[w] : 0;
+            zj[w] ^= zp ? rows[w] : 0;
+        }
+    }
+    const std::uint64_t rp = sign(p) ? ~std::uint64_t{0} : 0;
+    for (std::size_t w = 0; w < this->words; ++w) {
+        r[w] ^= rows[w] & (rp ^ high[w]);
+    }
+
+    // the destabilizer becomes row p and row p becomes +-Z_q
+    const std::size_t d = p - n;
+    const std::uint64_t d_bit = std::uint64_t{1} << (d & 63), p_bit = std::uint64_t{1} << (p & 63);
+    for (std::size_t j = 0; j < n; ++j) {
+        std::uint64_t *xj = xColumn(j), *zj = zColumn(j);
+        xj[d >> 6] = xBit(p, j) ? (xj[d >> 6] | d_bit) : (xj[d >> 6] & ~d_bit);
+        zj[d >> 6] = zBit(p, j) ? (zj[d >> 6] | d_bit) : (zj[d >> 6] & ~d_bit);
+        xj[p >> 6] &= ~p_bit;
+        zj[p >> 6] = (j == q) ? (zj[p >> 6] | p_bit) : (zj[p >> 6] & ~p_bit);
+    }
+    r[d >> 6] = sign(p) ? (r[d >> 6] | d_bit) : (r[d >> 6] & ~d_bit);
+    r[p >> 6] = coin ? (r[p >> 6] | p_bit) : (r[p >> 6] & ~p_bit);
+    return coin;
+}
+
+bool CliffordTableau::operator==(const CliffordTableau &other) const {
+    return this->qubits == other.qubits && this->x_bits == other.x_bits && this->z_bits == other.z_bits && this->r_bits == other.r_bits;
+}
+
+}  // namespace qcore
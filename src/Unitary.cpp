@@ -0,0 +1,543 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Unitary.cpp
+ *  @brief  Instance Description for the Matrix Representation of Quantum Gates
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "Unitary.hpp"
+
+#include <cmath>
+
+#include "Angle.hpp"
+
+namespace qcore {
+
+bool hasRotationMatrix(const gate_t &gateType) {
+    switch (gateType) {
+        case GateType::RX:
+        case GateType::CRX:
+        case GateType::RY:
+        case GateType::CRY:
+        case GateType::RZ:
+        case GateType::CRZ:
+        case GateType::P:
+        case GateType::CP:
+        case GateType::U1:
+        case GateType::CU1:
+        case GateType::U2:
+        case GateType::CU2:
+        case GateType::U3:
+        case GateType::CU3:
+        case GateType::U:
+        case GateType::CU:
+            return true;
+        default:
+            return false;
+    }
+}
+
+Matrix2 u3Matrix(fp theta, fp phi, fp lambda) {
+    const fp c = std::cos(theta / 2);
+    const fp s = std::sin(theta / 2);
+    return {Complex{c, 0}, -std::polar(s, lambda), std::polar(s, phi), std::polar(c, phi + lambda)};
+}
+
+Matrix2 rotationMatrix(const gate_t &gateType, const RotationMap &angles) {
+    // angles in RotationType order, whatever keys the reader assigned
+    std::array<fp, 4> a{0, 0, 0, 0};
+    std::size_t count = 0;
+    for (const auto &angle : angles) {
+        if (count < a.size()) {
+            a[count++] = angleValue(angle.second);
+        }
+    }
+
+    auto require = [&](std::size_t needed) {
+        if (count < needed) {
+            throw QcoreException("[rotationMatrix] gate: " + toString(gateType) + " msg: expected " + std::to_string(needed) + " angle(s)");
+        }
+    };
+
+    switch (gateType) {
+        case GateType::RX:
+        case GateType::CRX: {
+            require(1);
+            const fp c = std::cos(a[0] / 2), s = std::sin(a[0] / 2);
+            return {Complex{c, 0}, Complex{0, -s}, Complex{0, -s}, Complex{c, 0}};
+        }
+        case GateType::RY:
+        case GateType::CRY: {
+            require(1);
+            const fp c = std::cos(a[0] / 2), s = std::sin(a[0] / 2);
+            return {Complex{c, 0}, Complex{-s, 0}, Complex{s, 0}, Complex{c, 0}};
+        }
+        case GateType::RZ:
+        case GateType::CRZ:
+            require(1);
+            return {std::polar(1.0, -a[0] / 2), Complex{0, 0}, Complex{0, 0}, std::polar(1.0, a[0] / 2)};
+        case GateType::P:
+        case GateType::CP:
+        case GateType::U1:
+        case GateType::CU1:
+            require(1);
+            return {Complex{1, 0}, Complex{0, 0}, Complex{0, 0}, std::polar(1.0, a[0])};
+        case GateType::U2:
+        case GateType::CU2:
+            require(2);
+            return u3Matrix(PI / 2, a[0], a[1]);
+        case GateType::U3:
+        case GateType::CU3:
+        case GateType::U:
+            require(3);
+            return u3Matrix(a[0], a[1], a[2]);
+        case GateType::CU: {
+            require(3);
+            auto matrix = u3Matrix(a[0], a[1], a[2]);
+            if (count > 3) {
+                for (auto &entry : matrix) {
+                    entry *= std::polar(1.0, a[3]);
+                }
+            }
+            return matrix;
+        }
+        default:
+            throw QcoreException("[rotationMatrix] gate: " + toString(gateType) + " msg: not a parameterized single target gate");
+    }
+}
+
+bool tryTargetMatrix(QGate &gate, Matrix2 &matrix) {
+    if (gate.getTargets().size() != 1) {
+        return false;
+    }
+
+    if (hasFixedMatrix(gate.getType())) {
+        matrix = fixedMatrix(gate.getType());
+        return true;
+    }
+
+    if (hasRotationMatrix(gate.getType())) {
+        try {
+            matrix = rotationMatrix(gate.getType(), gate.getAngle());
+            return true;
+        } catch (const QcoreException &) {
+            return false;  // symbolic angles
+        }
+    }
+
+    return false;
+}
+
+bool trySingleQubitMatrix(QGate &gate, Matrix2 &matrix) {
+    if (gate.getIsClassical() || !gate.getControls().empty()) {
+        return false;
+    }
+    return tryTargetMatrix(gate, matrix);
+}
+
+Matrix2 multiply(const Matrix2 &lhs, const Matrix2 &rhs) {
+    return {lhs[0] * rhs[0] + lhs[1] * rhs[2], lhs[0] * rhs[1] + lhs[1] * rhs[3],
+            lhs[2] * rhs[0] + lhs[3] * rhs[2], lhs[2] * rhs[1] + lhs[3] * rhs[3]};
+}
+
+Matrix4 multiply(const Matrix4 &lhs, const Matrix4 &rhs) {
+    Matrix4 product{};
+    for (std::size_t r = 0; r < 4; ++r) {
+        for (std::size_t k = 0; k < 4; ++k) {
+            const Complex factor = lhs[4 * r + k];
+            for (std::size_t c = 0; c < 4; ++c) {
+                product[4 * r + c] += factor * rhs[4 * k + c];
+            }
+        }
+    }
+    return product;
+}
+
+Matrix2 adjoint(const Matrix2 &matrix) {
+    return {std::conj(matrix[0]), std::conj(matrix[2]), std::conj(matrix[1]), std::conj(matrix[3])};
+}
+
+Matrix4 adjoint(const Matrix4 &matrix) {
+    Matrix4 result{};
+    for (std::size_t r = 0; r < 4; ++r) {
+        for (std::size_t c = 0; c < 4; ++c) {
+            result[4 * c + r] = std::conj(matrix[4 * r + c]);
+        }
+    }
+    return result;
+}
+
+Matrix4 kron(const Matrix2 &high, const Matrix2 &low) {
+    Matrix4 product{};
+    for (std::size_t i1 = 0; i1 < 2; ++i1) {
+        for (std::size_t j1 = 0; j1 < 2; ++j1) {
+            for (std::size_t i0 = 0; i0 < 2; ++i0) {
+                for (std::size_t j0 = 0; j0 < 2; ++j0) {
+                    product[4 * (2 * i1 + i0) + 2 * j1 + j0] = high[2 * i1 + j1] * low[2 * i0 + j0];
+                }
+            }
+        }
+    }
+    return product;
+}
+
+static Matrix4 controlledMatrix(const Matrix2 &target, bool control_low) {
+    Matrix4 matrix{};
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            const std::size_t ci = control_low ? (i & 1) : (i >> 1), cj = control_low ? (j & 1) : (j >> 1);
+            const std::size_t ti = control_low ? (i >> 1) : (i & 1), tj = control_low ? (j >> 1) : (j & 1);
+            if (ci != cj) {
+                continue;
+            }
+            if (ci == 0) {
+                matrix[4 * i + j] = (ti == tj) ? Complex{1, 0} : Complex{0, 0};
+            } else {
+                matrix[4 * i + j] = target[2 * ti + tj];
+            }
+        }
+    }
+    return matrix;
+}
+
+bool tryTwoQubitMatrix(QGate &gate, const Qubit &low, const Qubit &high, Matrix4 &matrix) {
+    if (gate.getIsClassical()) {
+        return false;
+    }
+
+    auto &controls = gate.getControls();
+    auto &targets = gate.getTargets();
+    auto onPair = [&](const Qubit &q) { return q == low || q == high; };
+
+    if (controls.empty() && targets.size() == 1) {
+        Matrix2 target{};
+        if (!onPair(targets[0]) || !tryTargetMatrix(gate, target)) {
+            return false;
+        }
+        matrix = (targets[0] == low) ? kron(IDENTITY2, target) : kron(target, IDENTITY2);
+        return true;
+    }
+
+    if (controls.size() == 1 && targets.size() == 1) {
+        Matrix2 target{};
+        if (!onPair(controls[0]) || !onPair(targets[0]) || controls[0] == targets[0] || !tryTargetMatrix(gate, target)) {
+            return false;
+        }
+        matrix = controlledMatrix(target, controls[0] == low);
+        return true;
+    }
+
+    if (!controls.empty() || targets.size() != 2 || !onPair(targets[0]) || !onPair(targets[1]) || targets[0] == targets[1]) {
+        return false;
+    }
+
+    // the remaining two-qubit gates are symmetric in their operands
+    matrix = Matrix4{};
+    switch (gate.getType()) {
+        case GateType::SWAP:
+            matrix[0] = matrix[6] = matrix[9] = matrix[15] = Complex{1, 0};
+            return true;
+        case GateType::ISWAP:
+            matrix[0] = matrix[15] = Complex{1, 0};
+            matrix[6] = matrix[9] = Complex{0, 1};
+            return true;
+        case GateType::RXX:
+        case GateType::RZZ: {
+            fp theta = 0;
+            if (gate.getAngle().empty() || !tryAngleValue(gate.getAngle().begin()->second, theta)) {
+                return false;
+            }
+            const Complex c{std::cos(theta / 2), 0}, s{0, -std::sin(theta / 2)};
+            if (gate.getType() == GateType::RXX) {
+                matrix[0] = matrix[5] = matrix[10] = matrix[15] = c;
+                matrix[3] = matrix[6] = matrix[9] = matrix[12] = s;
+            } else {
+                matrix[0] = matrix[15] = c + s;
+                matrix[5] = matrix[10] = c - s;
+            }
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+bool isIdentityUpToPhase(const Matrix2 &matrix, fp tolerance) {
+    return std::abs(matrix[1]) < tolerance && std::abs(matrix[2]) < tolerance &&
+           std::abs(matrix[0] - matrix[3]) < tolerance;
+}
+
+EulerAngles zyzDecomposition(const Matrix2 &matrix) {
+    // scale into SU(2): V = e^(-i phase) U with det(V) = 1
+    const Complex det = matrix[0] * matrix[3] - matrix[1] * matrix[2];
+    const fp su2_phase = std::arg(det) / 2;
+    const Complex scale = std::polar(1.0, -su2_phase);
+    const Complex v00 = matrix[0] * scale;
+    const Complex v10 = matrix[2] * scale;
+    const Complex v11 = matrix[3] * scale;
+
+    // V = RZ(phi) RY(theta) RZ(lambda):
+    //   v00 = e^(-i(phi+lambda)/2) cos(theta/2), v10 = e^(i(phi-lambda)/2) sin(theta/2), v11 = e^(i(phi+lambda)/2) cos(theta/2)
+    EulerAngles angles{};
+    angles.theta = 2 * std::atan2(std::abs(v10), std::abs(v00));
+
+    const fp sum = (std::abs(v11) > MATRIX_TOLERANCE) ? 2 * std::arg(v11) : 0;
+    const fp diff = (std::abs(v10) > MATRIX_TOLERANCE) ? 2 * std::arg(v10) : 0;
+    angles.phi = (sum + diff) / 2;
+    angles.lambda = (sum - diff) / 2;
+
+    // RZ(phi) RY(theta) RZ(lambda) = e^(-i(phi+lambda)/2) U3(theta, phi, lambda)
+    angles.phase = su2_phase - (angles.phi + angles.lambda) / 2;
+
+    return angles;
+}
+
+// magic basis {(|00> + |11>), i(|01> + |10>), (|01> - |10>), i(|00> - |11>)} / sqrt(2) as columns
+static const Matrix4 MAGIC{Complex{SQRT1_2, 0}, Complex{0, 0}, Complex{0, 0}, Complex{0, SQRT1_2},
+                           Complex{0, 0}, Complex{0, SQRT1_2}, Complex{SQRT1_2, 0}, Complex{0, 0},
+                           Complex{0, 0}, Complex{0, SQRT1_2}, Complex{-SQRT1_2, 0}, Complex{0, 0},
+                           Complex{SQRT1_2, 0}, Complex{0, 0}, Complex{0, 0}, Complex{0, -SQRT1_2}};
+
+// eigenvalues of XX, YY and ZZ on the magic basis vectors
+static constexpr std::array<fp, 4> MAGIC_XX{1, 1, -1, -1};
+static constexpr std::array<fp, 4> MAGIC_YY{-1, 1, -1, 1};
+static constexpr std::array<fp, 4> MAGIC_ZZ{1, -1, -1, 1};
+
+static Matrix4 transpose(const Matrix4 &matrix) {
+    Matrix4 result{};
+    for (std::size_t r = 0; r < 4; ++r) {
+        for (std::size_t c = 0; c < 4; ++c) {
+            result[4 * c + r] = matrix[4 * r + c];
+        }
+    }
+    return result;
+}
+
+static Matrix4 fromMagic(const std::array<fp, 4> &phases) {
+    Matrix4 diagonal{};
+    for (std::size_t k = 0; k < 4; ++k) {
+        diagonal[5 * k] = std::polar(1.0, phases[k]);
+    }
+    return multiply(MAGIC, multiply(diagonal, adjoint(MAGIC)));
+}
+
+// cyclic Jacobi iteration on a real symmetric 4x4 matrix, returns the eigenvectors as columns
+static std::array<fp, 16> jacobiEigenvectors(std::array<fp, 16> a) {
+    std::array<fp, 16> v{};
+    for (std::size_t k = 0; k < 4; ++k) {
+        v[5 * k] = 1;
+    }
+
+    for (int sweep = 0; sweep < 64; ++sweep) {
+        fp off = 0;
+        for (std::size_t p = 0; p < 4; ++p) {
+            for (std::size_t q = p + 1; q < 4; ++q) {
+                off += a[4 * p + q] * a[4 * p + q];
+            }
+        }
+        if (off < 1e-30) {
+            break;
+        }
+
+        for (std::size_t p = 0; p < 4; ++p) {
+            for (std::size_t q = p + 1; q < 4; ++q) {
+                const fp apq = a[4 * p + q];
+                if (std::abs(apq) < 1e-300) {
+                    continue;
+                }
+                const fp theta = (a[4 * q + q] - a[4 * p + p]) / (2 * apq);
+                const fp t = (theta >= 0 ? 1 : -1) / (std::abs(theta) + std::sqrt(theta * theta + 1));
+                const fp c = 1 / std::sqrt(t * t + 1), s = t * c;
+                for (std::size_t k = 0; k < 4; ++k) {
+                    const fp akp = a[4 * k + p], akq = a[4 * k + q];
+                    a[4 * k + p] = c * akp - s * akq;
+                    a[4 * k + q] = s * akp + c * akq;
+                }
+                for (std::size_t k = 0; k < 4; ++k) {
+                    const fp apk = a[4 * p + k], aqk = a[4 * q + k];
+                    a[4 * p + k] = c * apk - s * aqk;
+                    a[4 * q + k] = s * apk + c * aqk;
+                }
+                for (std::size_t k = 0; k < 4; ++k) {
+                    const fp vkp = v[4 * k + p], vkq = v[4 * k + q];
+                    v[4 * k + p] = c * vkp - s * vkq;
+                    v[4 * k + q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+    return v;
+}
+
+static Complex determinant(const Matrix4 &m) {
+    // Laplace expansion along 2x2 minors of the first two rows
+    auto minor = [&](std::size_t r0, std::size_t r1, std::size_t c0, std::size_t c1) {
+        return m[4 * r0 + c0] * m[4 * r1 + c1] - m[4 * r0 + c1] * m[4 * r1 + c0];
+    };
+    return minor(0, 1, 0, 1) * minor(2, 3, 2, 3) - minor(0, 1, 0, 2) * minor(2, 3, 1, 3) +
+           minor(0, 1, 0, 3) * minor(2, 3, 1, 2) + minor(0, 1, 1, 2) * minor(2, 3, 0, 3) -
+           minor(0, 1, 1, 3) * minor(2, 3, 0, 2) + minor(0, 1, 2, 3) * minor(2, 3, 0, 1);
+}
+
+// splitting high (x) low into its factors, low is scaled into SU(2)
+static void factorLocal(const Matrix4 &matrix, Matrix2 &high, Matrix2 &low) {
+    std::size_t block = 0;
+    fp largest = -1;
+    for (std::size_t b = 0; b < 4; ++b) {
+        fp norm = 0;
+        for (std::size_t i0 = 0; i0 < 2; ++i0) {
+            for (std::size_t j0 = 0; j0 < 2; ++j0) {
+                norm += std::norm(matrix[4 * (2 * (b >> 1) + i0) + 2 * (b & 1) + j0]);
+            }
+        }
+        if (norm > largest) {
+            largest = norm;
+            block = b;
+        }
+    }
+
+    for (std::size_t i0 = 0; i0 < 2; ++i0) {
+        for (std::size_t j0 = 0; j0 < 2; ++j0) {
+            low[2 * i0 + j0] = matrix[4 * (2 * (block >> 1) + i0) + 2 * (block & 1) + j0];
+        }
+    }
+    const Complex scale = std::sqrt(low[0] * low[3] - low[1] * low[2]);
+    for (auto &entry : low) {
+        entry /= scale;
+    }
+
+    for (std::size_t i1 = 0; i1 < 2; ++i1) {
+        for (std::size_t j1 = 0; j1 < 2; ++j1) {
+            Complex overlap{0, 0};
+            for (std::size_t i0 = 0; i0 < 2; ++i0) {
+                for (std::size_t j0 = 0; j0 < 2; ++j0) {
+                    overlap += std::conj(low[2 * i0 + j0]) * matrix[4 * (2 * i1 + i0) + 2 * j1 + j0];
+                }
+            }
+            high[2 * i1 + j1] = overlap / fp{2};
+        }
+    }
+}
+
+Matrix4 canonicalMatrix(fp a, fp b, fp c) {
+    std::array<fp, 4> phases{};
+    for (std::size_t k = 0; k < 4; ++k) {
+        phases[k] = a * MAGIC_XX[k] + b * MAGIC_YY[k] + c * MAGIC_ZZ[k];
+    }
+    return fromMagic(phases);
+}
+
+KAKDecomposition kakDecomposition(const Matrix4 &matrix) {
+    const Matrix4 check = multiply(adjoint(matrix), matrix);
+    for (std::size_t r = 0; r < 4; ++r) {
+        for (std::size_t c = 0; c < 4; ++c) {
+            if (std::abs(check[4 * r + c] - ((r == c) ? Complex{1, 0} : Complex{0, 0})) > 1e-7) {
+                throw QcoreException("[kakDecomposition] msg: matrix is not unitary");
+            }
+        }
+    }
+
+    // scale into SU(4) and move to the magic basis
+    const fp det_phase = std::arg(determinant(matrix)) / 4;
+    Matrix4 special = matrix;
+    for (auto &entry : special) {
+        entry *= std::polar(1.0, -det_phase);
+    }
+    const Matrix4 magic = multiply(adjoint(MAGIC), multiply(special, MAGIC));
+    const Matrix4 square = multiply(transpose(magic), magic);
+
+    // real and imaginary parts of the symmetric unitary commute, so a generic real
+    // combination of both shares their eigenvectors
+    static constexpr std::array<fp, 5> mixes{0.5772156649015329, 1.6180339887498949, -0.7071067811865476, 2.7182818284590452, 0.3183098861837907};
+    std::array<fp, 16> p{};
+    std::array<fp, 4> phases{};
+    bool diagonal = false;
+    for (fp mix : mixes) {
+        std::array<fp, 16> combined{};
+        for (std::size_t k = 0; k < 16; ++k) {
+            combined[k] = square[k].real() + mix * square[k].imag();
+        }
+        p = jacobiEigenvectors(combined);
+
+        Matrix4 orthogonal{};
+        for (std::size_t k = 0; k < 16; ++k) {
+            orthogonal[k] = p[k];
+        }
+        const Matrix4 d = multiply(transpose(orthogonal), multiply(square, orthogonal));
+
+        diagonal = true;
+        for (std::size_t r = 0; r < 4 && diagonal; ++r) {
+            for (std::size_t c = 0; c < 4; ++c) {
+                if (r != c && std::abs(d[4 * r + c]) > 1e-7) {
+                    diagonal = false;
+                    break;
+                }
+            }
+        }
+        if (diagonal) {
+            for (std::size_t k = 0; k < 4; ++k) {
+                phases[k] = std::arg(d[5 * k]) / 2;
+            }
+            break;
+        }
+    }
+    if (!diagonal) {
+        throw QcoreException("[kakDecomposition] msg: failed to diagonalize");
+    }
+
+    // P in SO(4) and product of the square roots equal to det = 1
+    Matrix4 orthogonal{};
+    for (std::size_t k = 0; k < 16; ++k) {
+        orthogonal[k] = p[k];
+    }
+    if (determinant(orthogonal).real() < 0) {
+        for (std::size_t r = 0; r < 4; ++r) {
+            orthogonal[4 * r] = -orthogonal[4 * r];
+        }
+    }
+    if (std::abs(std::remainder(phases[0] + phases[1] + phases[2] + phases[3], 2 * PI)) > PI / 2) {
+        phases[0] += PI;
+    }
+
+    // magic = K1 D P^T with K1 = magic P D^-1 real orthogonal
+    Matrix4 inverse_root{};
+    for (std::size_t k = 0; k < 4; ++k) {
+        inverse_root[5 * k] = std::polar(1.0, -phases[k]);
+    }
+    const Matrix4 left = multiply(MAGIC, multiply(multiply(magic, multiply(orthogonal, inverse_root)), adjoint(MAGIC)));
+    const Matrix4 right = multiply(MAGIC, multiply(transpose(orthogonal), adjoint(MAGIC)));
+
+    KAKDecomposition kak{};
+    factorLocal(left, kak.after_high, kak.after_low);
+    factorLocal(right, kak.before_high, kak.before_low);
+
+    kak.a = (phases[0] + phases[1] - phases[2] - phases[3]) / 4;
+    kak.b = (-phases[0] + phases[1] - phases[2] + phases[3]) / 4;
+    kak.c = (phases[0] - phases[1] - phases[2] + phases[3]) / 4;
+    kak.phase = det_phase + (phases[0] + phases[1] + phases[2] + phases[3]) / 4;
+
+    return kak;
+}
+
+}  // namespace qcore
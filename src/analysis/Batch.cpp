@@ -0,0 +1,187 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Batch.cpp
+ *  @brief  Instance Description for Concurrent Multi-File Circuit Analysis
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "analysis/Batch.hpp"
+
+#include <filesystem>
+
+#include "parallel/ThreadPool.hpp"
+
+namespace qcore {
+
+CircuitSummary summarizeQCircuit(QCircuit &qc) {
+    auto summary = CircuitSummary{};
+    summary.valid = true;
+    summary.qreg = qc.getQregSize();
+    summary.creg = qc.getCregSize();
+    summary.depth = qc.getDepth();
+    summary.properties = qc.getProperties();
+    for (const auto &element : summary.properties) {
+        summary.gates += element.second;
+    }
+    return summary;
+}
+
+std::vector<std::string> listQASMFiles(const std::string &directory) {
+    namespace fs = std::filesystem;
+
+    if (!fs::is_directory(directory)) {
+        throw QcoreException("[listQASMFiles] " + directory + " msg: not a directory");
+    }
+
+    std::vector<std::string> files{};
+    for (const auto &entry : fs::recursive_directory_iterator(directory, fs::directory_options::skip_permission_denied)) {
+        if (!entry.is_regular_file()) {
+            continue;
+        }
+
+        std::string extension = entry.path().extension().string();
+        std::transform(extension.cbegin(), extension.cend(), extension.begin(), [](unsigned char ch) { return ::tolower(ch); });
+        if (extension == ".qasm") {
+            files.push_back(entry.path().string());
+        }
+    }
+
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+BatchSummary analyzeQCircuits(const std::vector<std::string> &files, std::size_t threads) {
+    auto summaries = BatchSummary(files.size());
+
+    // every task writes its own slot, no further synchronization is needed
+    auto analyze = [&files, &summaries](std::size_t index) {
+        auto &summary = summaries[index];
+        try {
+            auto qc = QCircuit{};
+            qc.readQCircuit(files[index]);
+            summary = summarizeQCircuit(qc);
+        } catch (const std::exception &ex) {
+            summary = CircuitSummary{};
+            summary.error = ex.what();
+        }
+        summary.file = files[index];
+    };
+
+    threads = std::min(resolveThreads(threads), std::max<std::size_t>(files.size(), 1));
+    if (threads == 1) {
+        for (std::size_t i = 0; i < files.size(); ++i) {
+            analyze(i);
+        }
+        return summaries;
+    }
+
+    auto pool = ThreadPool(threads);
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        pool.submit([&analyze, i] { analyze(i); });
+    }
+    pool.wait();
+
+    return summaries;
+}
+
+BatchSummary analyzeQCircuitDirectory(const std::string &directory, std::size_t threads) {
+    return analyzeQCircuits(listQASMFiles(directory), threads);
+}
+
+nlohmann::json toJSON(const CircuitSummary &summary) {
+    nlohmann::json properties{};
+
+    if (!summary.file.empty()) {
+        properties["File"] = summary.file;
+    }
+
+    if (!summary.valid) {
+        properties["Error"] = summary.error;
+        return properties;
+    }
+
+    properties["QuantumRegSize"] = summary.qreg;
+    properties["ClassicalRegSize"] = summary.creg;
+    nlohmann::json gateSummary = nlohmann::json::object();
+    for (const auto &element : summary.properties) {
+        gateSummary[toString(element.first)] = element.second;
+    }
+    properties["GateSummary"] = gateSummary;
+    properties["CircuitDepth"] = summary.depth;
+
+    return properties;
+}
+
+nlohmann::json toJSON(const BatchSummary &summaries) {
+    nlohmann::json result = nlohmann::json::array();
+    for (const auto &summary : summaries) {
+        result.push_back(toJSON(summary));
+    }
+    return result;
+}
+
+nlohmann::json toColumnarJSON(const BatchSummary &summaries) {
+    const std::size_t n = summaries.size();
+
+    std::vector<std::string> files(n);
+    std::vector<regsize_t> qregs(n), cregs(n);
+    std::vector<depth_t> depths(n);
+    std::vector<gcount_t> gates(n);
+    nlohmann::json errors = nlohmann::json::array();
+
+    std::map<gate_t, std::vector<gcount_t>> gateColumns{};
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto &summary = summaries[i];
+        files[i] = summary.file;
+        qregs[i] = summary.qreg;
+        cregs[i] = summary.creg;
+        depths[i] = summary.depth;
+        gates[i] = summary.gates;
+        errors.push_back(summary.valid ? nlohmann::json(nullptr) : nlohmann::json(summary.error));
+
+        for (const auto &element : summary.properties) {
+            auto &column = gateColumns[element.first];
+            column.resize(n, 0);
+            column[i] = element.second;
+        }
+    }
+
+    nlohmann::json gateSummary = nlohmann::json::object();
+    for (const auto &column : gateColumns) {
+        gateSummary[toString(column.first)] = column.second;
+    }
+
+    nlohmann::json result{};
+    result["File"] = files;
+    result["QuantumRegSize"] = qregs;
+    result["ClassicalRegSize"] = cregs;
+    result["CircuitDepth"] = depths;
+    result["GateCount"] = gates;
+    result["GateSummary"] = gateSummary;
+    result["Error"] = errors;
+
+    return result;
+}
+
+}  // namespace qcore
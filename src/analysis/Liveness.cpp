@@ -0,0 +1,115 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Liveness.cpp
+ *  @brief  Instance Description for Qubit Liveness Analysis
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "analysis/Liveness.hpp"
+
+#include <algorithm>
+
+namespace qcore {
+
+QubitLiveness::QubitLiveness(QCircuit &qc) {
+    auto &gates = qc.getGates();
+    this->gates = gates.size();
+
+    regsize_t width = qc.getQregSize();
+    for (auto &g : gates) {
+        for (auto q : g->getControls()) {
+            width = std::max<regsize_t>(width, q + 1);
+        }
+        for (auto q : g->getTargets()) {
+            width = std::max<regsize_t>(width, q + 1);
+        }
+    }
+    this->uses.resize(width);
+    this->resets.resize(width);
+
+    for (std::size_t i = 0; i < gates.size(); ++i) {
+        auto &g = *gates[i];
+        if (g.getType() == GateType::BARRIER) {
+            continue;
+        }
+        const bool reset = g.getType() == GateType::RESET && !g.getIsClassical();
+        for (auto q : g.getControls()) {
+            this->uses[q].push_back(i);
+            this->resets[q].push_back(false);
+        }
+        for (auto q : g.getTargets()) {
+            this->uses[q].push_back(i);
+            this->resets[q].push_back(reset);
+        }
+    }
+}
+
+std::size_t QubitLiveness::previousUse(Qubit q, std::size_t position) const {
+    const auto &list = this->uses[q];
+    auto it = std::lower_bound(list.begin(), list.end(), position);
+    return (it == list.begin()) ? NO_USE : *(it - 1);
+}
+
+std::size_t QubitLiveness::nextUse(Qubit q, std::size_t position) const {
+    const auto &list = this->uses[q];
+    auto it = std::upper_bound(list.begin(), list.end(), position);
+    return (it == list.end()) ? NO_USE : *it;
+}
+
+bool QubitLiveness::isUsedAt(Qubit q, std::size_t position) const {
+    const auto &list = this->uses[q];
+    return std::binary_search(list.begin(), list.end(), position);
+}
+
+bool QubitLiveness::isClean(Qubit q, std::size_t position) const {
+    const auto &list = this->uses[q];
+    auto it = std::lower_bound(list.begin(), list.end(), position);
+    return it == list.begin() || this->resets[q][static_cast<std::size_t>(it - list.begin()) - 1];
+}
+
+void QubitLiveness::ancillasAt(std::size_t position, QubitSet &dirty, QubitSet &clean) const {
+    dirty.clear();
+    clean.clear();
+
+    auto gaps = std::vector<std::pair<std::size_t, Qubit>>{};
+    for (Qubit q = 0; q < width(); ++q) {
+        if (isUsedAt(q, position)) {
+            continue;
+        }
+        if (isClean(q, position)) {
+            clean.push_back(q);
+            continue;
+        }
+        const std::size_t previous = previousUse(q, position), next = nextUse(q, position);
+        gaps.emplace_back(((next == NO_USE) ? this->gates : next) - previous, q);
+    }
+
+    std::stable_sort(gaps.begin(), gaps.end(), [](const auto &lhs, const auto &rhs) { return lhs.first > rhs.first; });
+    dirty.reserve(gaps.size());
+    for (const auto &gap : gaps) {
+        dirty.push_back(gap.second);
+    }
+}
+
+}  // namespace qcore
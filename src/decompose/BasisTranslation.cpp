@@ -0,0 +1,614 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   BasisTranslation.cpp
+ *  @brief  Instance Description for the Basis Translator to Native Gate Sets
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "decompose/BasisTranslation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+
+#include "Angle.hpp"
+#include "analysis/Liveness.hpp"
+#include "decompose/Clifford_T.hpp"
+#include "decompose/RotationSynthesis.hpp"
+
+namespace qcore {
+
+namespace {
+
+inline AngleForm constant(fp value) {
+    return AngleForm{value, {}};
+}
+
+// scale * (angle i) + offset
+inline AngleForm angle(std::size_t i, fp scale = 1, fp offset = 0) {
+    AngleForm form{offset, {}};
+    form.scale[i] = scale;
+    return form;
+}
+
+inline AngleForm sum(const AngleForm &lhs, const AngleForm &rhs, fp scale = 1) {
+    AngleForm form{lhs.offset + rhs.offset, {}};
+    for (std::size_t i = 0; i < MAX_ANGLES; ++i) {
+        form.scale[i] = scale * (lhs.scale[i] + rhs.scale[i]);
+    }
+    form.offset *= scale;
+    return form;
+}
+
+inline EquivalenceStep step(gate_t type, std::initializer_list<std::uint8_t> slots, std::initializer_list<AngleForm> angles = {}) {
+    EquivalenceStep s{};
+    s.type = type;
+    std::copy(slots.begin(), slots.end(), s.slots.begin());
+    std::copy(angles.begin(), angles.end(), s.angles.begin());
+    return s;
+}
+
+template <std::size_t N>
+std::vector<EquivalenceStep> fromTable(const DecompositionTable<N> &table) {
+    std::vector<EquivalenceStep> steps{};
+    steps.reserve(N);
+    for (const auto &s : table) {
+        if (s.control == NO_SLOT) {
+            steps.push_back(step(s.type, {s.target}));
+        } else {
+            steps.push_back(step(s.type, {s.control, s.target}));
+        }
+    }
+    return steps;
+}
+
+std::vector<EquivalenceRule> buildLibrary() {
+    const AngleForm a0 = angle(0), a1 = angle(1), a2 = angle(2), a3 = angle(3);
+    auto c = [](fp value) { return constant(value); };
+
+    std::vector<EquivalenceRule> library{
+        // single-qubit gates
+        {GateType::I, {}},
+        {GateType::X, {step(GateType::U3, {0}, {c(PI), c(0), c(PI)})}},
+        {GateType::Y, {step(GateType::U3, {0}, {c(PI), c(PI / 2), c(PI / 2)})}},
+        {GateType::Y, {step(GateType::Z, {0}), step(GateType::X, {0})}},
+        {GateType::Z, {step(GateType::RZ, {0}, {c(PI)})}},
+        {GateType::Z, {step(GateType::S, {0}), step(GateType::S, {0})}},
+        {GateType::H, {step(GateType::U3, {0}, {c(PI / 2), c(0), c(PI)})}},
+        {GateType::H, {step(GateType::RZ, {0}, {c(PI / 2)}), step(GateType::SX, {0}), step(GateType::RZ, {0}, {c(PI / 2)})}},
+        {GateType::S, {step(GateType::RZ, {0}, {c(PI / 2)})}},
+        {GateType::SDG, {step(GateType::RZ, {0}, {c(-PI / 2)})}},
+        {GateType::T, {step(GateType::RZ, {0}, {c(PI / 4)})}},
+        {GateType::TDG, {step(GateType::RZ, {0}, {c(-PI / 4)})}},
+        {GateType::SX, {step(GateType::U3, {0}, {c(PI / 2), c(-PI / 2), c(PI / 2)})}},
+        {GateType::SX, {step(GateType::H, {0}), step(GateType::S, {0}), step(GateType::H, {0})}},
+        {GateType::V, {step(GateType::SX, {0})}},
+        {GateType::SXDG, {step(GateType::U3, {0}, {c(PI / 2), c(PI / 2), c(-PI / 2)})}},
+        {GateType::SXDG, {step(GateType::H, {0}), step(GateType::SDG, {0}), step(GateType::H, {0})}},
+        {GateType::VDG, {step(GateType::SXDG, {0})}},
+        {GateType::RX, {step(GateType::U3, {0}, {a0, c(-PI / 2), c(PI / 2)})}},
+        {GateType::RX, {step(GateType::H, {0}), step(GateType::RZ, {0}, {a0}), step(GateType::H, {0})}},
+        {GateType::RY, {step(GateType::U3, {0}, {a0, c(0), c(0)})}},
+        {GateType::RY, {step(GateType::SDG, {0}), step(GateType::RX, {0}, {a0}), step(GateType::S, {0})}},
+        {GateType::RZ, {step(GateType::U3, {0}, {c(0), c(0), a0})}},
+        {GateType::P, {step(GateType::RZ, {0}, {a0})}},
+        {GateType::U1, {step(GateType::RZ, {0}, {a0})}},
+        {GateType::U2, {step(GateType::U3, {0}, {c(PI / 2), a0, a1})}},
+        {GateType::U, {step(GateType::U3, {0}, {a0, a1, a2})}},
+        {GateType::U3,
+         {step(GateType::RZ, {0}, {a2}), step(GateType::SX, {0}), step(GateType::RZ, {0}, {angle(0, 1, PI)}), step(GateType::SX, {0}),
+          step(GateType::RZ, {0}, {angle(1, 1, PI)})}},
+
+        // two-qubit gates (control, target)
+        {GateType::CY, {step(GateType::SDG, {1}), step(GateType::CX, {0, 1}), step(GateType::S, {1})}},
+        {GateType::CZ, {step(GateType::H, {1}), step(GateType::CX, {0, 1}), step(GateType::H, {1})}},
+        {GateType::CH,
+         {step(GateType::S, {1}), step(GateType::H, {1}), step(GateType::T, {1}), step(GateType::CX, {0, 1}), step(GateType::TDG, {1}),
+          step(GateType::H, {1}), step(GateType::SDG, {1})}},
+        {GateType::CS, {step(GateType::CP, {0, 1}, {c(PI / 2)})}},
+        {GateType::CSDG, {step(GateType::CP, {0, 1}, {c(-PI / 2)})}},
+        {GateType::CT, {step(GateType::CP, {0, 1}, {c(PI / 4)})}},
+        {GateType::CTDG, {step(GateType::CP, {0, 1}, {c(-PI / 4)})}},
+        {GateType::CSX, {step(GateType::H, {1}), step(GateType::CS, {0, 1}), step(GateType::H, {1})}},
+        {GateType::CV, {step(GateType::CSX, {0, 1})}},
+        {GateType::CSXDG, {step(GateType::H, {1}), step(GateType::CSDG, {0, 1}), step(GateType::H, {1})}},
+        {GateType::CVDG, {step(GateType::CSXDG, {0, 1})}},
+        {GateType::CRX, {step(GateType::H, {1}), step(GateType::CRZ, {0, 1}, {a0}), step(GateType::H, {1})}},
+        {GateType::CRY,
+         {step(GateType::RY, {1}, {angle(0, 0.5)}), step(GateType::CX, {0, 1}), step(GateType::RY, {1}, {angle(0, -0.5)}),
+          step(GateType::CX, {0, 1})}},
+        {GateType::CRZ,
+         {step(GateType::RZ, {1}, {angle(0, 0.5)}), step(GateType::CX, {0, 1}), step(GateType::RZ, {1}, {angle(0, -0.5)}),
+          step(GateType::CX, {0, 1})}},
+        {GateType::CP,
+         {step(GateType::RZ, {0}, {angle(0, 0.5)}), step(GateType::CX, {0, 1}), step(GateType::RZ, {1}, {angle(0, -0.5)}),
+          step(GateType::CX, {0, 1}), step(GateType::RZ, {1}, {angle(0, 0.5)})}},
+        {GateType::CU1, {step(GateType::CP, {0, 1}, {a0})}},
+        {GateType::CU2, {step(GateType::CU3, {0, 1}, {c(PI / 2), a0, a1})}},
+        {GateType::CU3,
+         {step(GateType::RZ, {0}, {sum(a2, a1, 0.5)}), step(GateType::RZ, {1}, {sum(a2, angle(1, -1), 0.5)}), step(GateType::CX, {0, 1}),
+          step(GateType::U3, {1}, {angle(0, -0.5), c(0), sum(a1, a2, -0.5)}), step(GateType::CX, {0, 1}),
+          step(GateType::U3, {1}, {angle(0, 0.5), a1, c(0)})}},
+        {GateType::CU, {step(GateType::RZ, {0}, {a3}), step(GateType::CU3, {0, 1}, {a0, a1, a2})}},
+        {GateType::SWAP, {step(GateType::CX, {0, 1}), step(GateType::CX, {1, 0}), step(GateType::CX, {0, 1})}},
+        {GateType::ISWAP,
+         {step(GateType::S, {0}), step(GateType::S, {1}), step(GateType::H, {0}), step(GateType::CX, {0, 1}), step(GateType::CX, {1, 0}),
+          step(GateType::H, {1})}},
+        {GateType::RXX,
+         {step(GateType::H, {0}), step(GateType::H, {1}), step(GateType::CX, {0, 1}), step(GateType::RZ, {1}, {a0}),
+          step(GateType::CX, {0, 1}), step(GateType::H, {0}), step(GateType::H, {1})}},
+        {GateType::RZZ, {step(GateType::CX, {0, 1}), step(GateType::RZ, {1}, {a0}), step(GateType::CX, {0, 1})}},
+
+        // three- and four-qubit gates
+        {GateType::CCX, fromTable(CCX_CLIFFORD_T)},
+        {GateType::RCCX, fromTable(RCCX_CLIFFORD_T)},
+        {GateType::SRCCX, fromTable(SRCCX_CLIFFORD_T)},
+        {GateType::SRCCXDG, fromTable(SRCCXDG_CLIFFORD_T)},
+        {GateType::SSRCCX, fromTable(SSRCCX_CLIFFORD_T)},
+        {GateType::SSRCCXDG, fromTable(SSRCCXDG_CLIFFORD_T)},
+        {GateType::RC3X, fromTable(RC3X_CLIFFORD_T)},
+        {GateType::SRC3X, fromTable(SRC3X_CLIFFORD_T)},
+        {GateType::SRC3XDG, fromTable(SRC3XDG_CLIFFORD_T)},
+        {GateType::LCCX, {step(GateType::CCX, {0, 1, 2})}},
+        {GateType::LCCXDG, {step(GateType::CCX, {0, 1, 2})}},
+        {GateType::PERES, {step(GateType::CCX, {0, 1, 2}), step(GateType::CX, {0, 1})}},
+        {GateType::PERESDG, {step(GateType::CX, {0, 1}), step(GateType::CCX, {0, 1, 2})}},
+        {GateType::CSWAP, {step(GateType::CX, {2, 1}), step(GateType::CCX, {0, 1, 2}), step(GateType::CX, {2, 1})}}};
+
+    return library;
+}
+
+// inner form with its angles replaced by the outer forms
+AngleForm substitute(const AngleForm &inner, const std::array<AngleForm, MAX_ANGLES> &outer) {
+    AngleForm form{inner.offset, {}};
+    for (std::size_t j = 0; j < MAX_ANGLES; ++j) {
+        if (inner.scale[j] == 0) {
+            continue;
+        }
+        form.offset += inner.scale[j] * outer[j].offset;
+        for (std::size_t i = 0; i < MAX_ANGLES; ++i) {
+            form.scale[i] += inner.scale[j] * outer[j].scale[i];
+        }
+    }
+    return form;
+}
+
+// operands in QASM order split like the reader does
+void splitOperands(const gate_t &type, const Qubit *qubits, std::size_t count, ControlSet &controls, TargetSet &targets) {
+    std::size_t split = count - 1;
+    if (type == GateType::SWAP || type == GateType::ISWAP || type == GateType::RXX || type == GateType::RZZ) {
+        split = 0;
+    } else if (type == GateType::CSWAP) {
+        split = 1;
+    }
+    controls.assign(qubits, qubits + split);
+    targets.assign(qubits + split, qubits + count);
+}
+
+// phase gates realizing RZ(k pi/4) up to a global phase
+constexpr std::array<std::array<gate_t, 2>, 8> RZ_CLIFFORD_T{{{GateType::NONE, GateType::NONE},
+                                                              {GateType::T, GateType::NONE},
+                                                              {GateType::S, GateType::NONE},
+                                                              {GateType::S, GateType::T},
+                                                              {GateType::S, GateType::S},
+                                                              {GateType::SDG, GateType::TDG},
+                                                              {GateType::SDG, GateType::NONE},
+                                                              {GateType::TDG, GateType::NONE}}};
+
+}  // namespace
+
+std::size_t operandCount(const gate_t &gateType) {
+    switch (gateType) {
+        case GateType::I:
+        case GateType::X:
+        case GateType::Y:
+        case GateType::Z:
+        case GateType::H:
+        case GateType::S:
+        case GateType::SDG:
+        case GateType::T:
+        case GateType::TDG:
+        case GateType::SX:
+        case GateType::SXDG:
+        case GateType::V:
+        case GateType::VDG:
+        case GateType::RX:
+        case GateType::RY:
+        case GateType::RZ:
+        case GateType::P:
+        case GateType::U1:
+        case GateType::U2:
+        case GateType::U3:
+        case GateType::U:
+        case GateType::RESET:
+        case GateType::MEASURE:
+            return 1;
+        case GateType::CX:
+        case GateType::CY:
+        case GateType::CZ:
+        case GateType::CH:
+        case GateType::CS:
+        case GateType::CSDG:
+        case GateType::CT:
+        case GateType::CTDG:
+        case GateType::CSX:
+        case GateType::CSXDG:
+        case GateType::CV:
+        case GateType::CVDG:
+        case GateType::CRX:
+        case GateType::CRY:
+        case GateType::CRZ:
+        case GateType::CP:
+        case GateType::CU1:
+        case GateType::CU2:
+        case GateType::CU3:
+        case GateType::CU:
+        case GateType::SWAP:
+        case GateType::ISWAP:
+        case GateType::RXX:
+        case GateType::RZZ:
+            return 2;
+        case GateType::CCX:
+        case GateType::RCCX:
+        case GateType::SRCCX:
+        case GateType::SRCCXDG:
+        case GateType::SSRCCX:
+        case GateType::SSRCCXDG:
+        case GateType::LCCX:
+        case GateType::LCCXDG:
+        case GateType::PERES:
+        case GateType::PERESDG:
+        case GateType::CSWAP:
+            return 3;
+        case GateType::RC3X:
+        case GateType::SRC3X:
+        case GateType::SRC3XDG:
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+std::size_t angleCount(const gate_t &gateType) {
+    switch (gateType) {
+        case GateType::RX:
+        case GateType::RY:
+        case GateType::RZ:
+        case GateType::P:
+        case GateType::U1:
+        case GateType::CRX:
+        case GateType::CRY:
+        case GateType::CRZ:
+        case GateType::CP:
+        case GateType::CU1:
+        case GateType::RXX:
+        case GateType::RZZ:
+            return 1;
+        case GateType::U2:
+        case GateType::CU2:
+            return 2;
+        case GateType::U3:
+        case GateType::U:
+        case GateType::CU3:
+            return 3;
+        case GateType::CU:
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+bool inBasis(const gate_t &gateType, const DecompositionBasis &basis) {
+    switch (basis) {
+        case DecompositionBasis::CLIFFORD_T:
+            return gateType == GateType::H || gateType == GateType::S || gateType == GateType::SDG || gateType == GateType::T ||
+                   gateType == GateType::TDG || gateType == GateType::X || gateType == GateType::CX || gateType == GateType::RZ;
+        case DecompositionBasis::RZ_SX_X_CX:
+            return gateType == GateType::RZ || gateType == GateType::SX || gateType == GateType::X || gateType == GateType::CX;
+        case DecompositionBasis::U3_CX:
+            return gateType == GateType::U3 || gateType == GateType::CX;
+        default:
+            return false;
+    }
+}
+
+const std::vector<EquivalenceRule> &equivalenceLibrary() {
+    static const std::vector<EquivalenceRule> library = buildLibrary();
+    return library;
+}
+
+BasisTranslator::BasisTranslator(const DecompositionBasis &basis) : basis(basis) {
+    const auto &library = equivalenceLibrary();
+    constexpr std::size_t UNREACHABLE = std::numeric_limits<std::size_t>::max();
+
+    // least cost of every gate type over the rules, to a fixed point
+    std::array<std::size_t, GateType::TYPECOUNT> cost{};
+    std::array<std::size_t, GateType::TYPECOUNT> choice{};
+    cost.fill(UNREACHABLE);
+    for (std::size_t t = 0; t < GateType::TYPECOUNT; ++t) {
+        if (inBasis(static_cast<gate_t>(t), basis)) {
+            cost[t] = 1;
+        }
+    }
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (std::size_t r = 0; r < library.size(); ++r) {
+            const auto &rule = library[r];
+            if (inBasis(rule.source, basis)) {
+                continue;
+            }
+            std::size_t total = 0;
+            for (const auto &s : rule.steps) {
+                total = (cost[s.type] == UNREACHABLE) ? UNREACHABLE : total + cost[s.type];
+                if (total == UNREACHABLE) {
+                    break;
+                }
+            }
+            if (total < cost[rule.source]) {
+                cost[rule.source] = total;
+                choice[rule.source] = r;
+                changed = true;
+            }
+        }
+    }
+
+    // expand the chosen rules into flat templates; a chosen step always costs less than
+    // its source or equals it through a single step rule chosen before, so this terminates
+    std::array<bool, GateType::TYPECOUNT> expanding{};
+    std::function<void(gate_t)> expand = [&](gate_t type) {
+        if (this->resolved[type]) {
+            return;
+        }
+        if (expanding[type]) {
+            throw QcoreException("[BasisTranslator] gate: " + toString(type) + " msg: cyclic equivalence");
+        }
+        expanding[type] = true;
+
+        auto &flat = this->templates[type];
+        if (inBasis(type, basis)) {
+            EquivalenceStep identity{};
+            identity.type = type;
+            for (std::size_t k = 0; k < MAX_OPERANDS; ++k) {
+                identity.slots[k] = static_cast<std::uint8_t>(k);
+            }
+            for (std::size_t k = 0; k < MAX_ANGLES; ++k) {
+                identity.angles[k] = angle(k);
+            }
+            flat.push_back(identity);
+        } else {
+            for (const auto &s : library[choice[type]].steps) {
+                expand(s.type);
+                for (const auto &inner : this->templates[s.type]) {
+                    EquivalenceStep composed{};
+                    composed.type = inner.type;
+                    for (std::size_t k = 0; k < operandCount(inner.type); ++k) {
+                        composed.slots[k] = s.slots[inner.slots[k]];
+                    }
+                    for (std::size_t k = 0; k < angleCount(inner.type); ++k) {
+                        composed.angles[k] = substitute(inner.angles[k], s.angles);
+                    }
+                    flat.push_back(composed);
+                }
+            }
+        }
+
+        expanding[type] = false;
+        this->resolved[type] = true;
+    };
+
+    for (std::size_t t = 0; t < GateType::TYPECOUNT; ++t) {
+        if (cost[t] != UNREACHABLE && operandCount(static_cast<gate_t>(t)) != 0) {
+            expand(static_cast<gate_t>(t));
+        }
+    }
+}
+
+const std::vector<EquivalenceStep> &BasisTranslator::templateOf(const gate_t &gateType) const {
+    if (!this->resolved[gateType]) {
+        throw QcoreException("[templateOf] gate: " + toString(gateType) + " msg: no equivalence into the basis");
+    }
+    return this->templates[gateType];
+}
+
+gcount_t BasisTranslator::translate(QCircuit &qc, fp epsilon) const {
+    const bool approximate = epsilon > 0 && this->basis == DecompositionBasis::CLIFFORD_T;
+    if (approximate && !(epsilon >= MIN_SYNTHESIS_EPSILON && epsilon < 1)) {
+        throw QcoreException("[translate] epsilon: " + std::to_string(epsilon) + " msg: must be in [" +
+                             std::to_string(MIN_SYNTHESIS_EPSILON) + ", 1)");
+    }
+
+    auto &gates = qc.getGates();
+    auto translated = QGateSet{};
+    translated.reserve(gates.size());
+    gcount_t count = 0;
+    gcount_t approximated = 0;
+
+    // kept gates are moved only once the whole circuit translated, so a throw leaves it intact
+    auto kept = std::vector<std::pair<std::size_t, std::size_t>>{};
+
+    std::unique_ptr<QubitLiveness> liveness{};
+    std::array<Qubit, MAX_OPERANDS> operands{};
+    std::array<fp, MAX_ANGLES> values{};
+
+    auto emit = [&](QGate &source, const gate_t &type, const Qubit *qubits, const fp *angles) {
+        const std::size_t n = operandCount(type);
+        auto controls = ControlSet{}, targets = TargetSet{};
+        splitOperands(type, qubits, n, controls, targets);
+
+        auto rotation = RotationMap{};
+        const RotationType keys[] = {RotationType::THETA, RotationType::PHI, RotationType::LAMBDA, RotationType::GAMMA};
+        for (std::size_t k = 0; k < angleCount(type); ++k) {
+            rotation[keys[k]] = angleString(angles[k]);
+        }
+
+        auto gate = std::make_unique<QGate>(type, n, source.getCbits(), rotation, controls, targets);
+        if (source.getIsClassical()) {
+            gate->setIsClassical(true);
+            gate->setExpression(source.setExpression());
+        }
+        translated.push_back(std::move(gate));
+    };
+
+    std::function<void(QGate &, const gate_t &, const Qubit *, const fp *)> lower = [&](QGate &source, const gate_t &type,
+                                                                                        const Qubit *qubits, const fp *angles) {
+        for (const auto &s : templateOf(type)) {
+            Qubit step_qubits[MAX_OPERANDS];
+            fp step_angles[MAX_ANGLES] = {0, 0, 0, 0};
+            for (std::size_t k = 0; k < operandCount(s.type); ++k) {
+                step_qubits[k] = qubits[s.slots[k]];
+            }
+            for (std::size_t k = 0; k < angleCount(s.type); ++k) {
+                step_angles[k] = s.angles[k].offset;
+                for (std::size_t i = 0; i < MAX_ANGLES; ++i) {
+                    step_angles[k] += s.angles[k].scale[i] * angles[i];
+                }
+            }
+
+            if (s.type == GateType::RZ) {
+                if (this->basis == DecompositionBasis::CLIFFORD_T) {
+                    const fp eighths = step_angles[0] / (PI / 4);
+                    const fp rounded = std::round(eighths);
+                    if (std::abs(eighths - rounded) * (PI / 4) > ANGLE_TOLERANCE) {
+                        if (approximate) {
+                            // left for synthesizeRotations
+                            emit(source, GateType::RZ, step_qubits, step_angles);
+                            ++approximated;
+                            continue;
+                        }
+                        throw QcoreException("[translate] gate: " + toString(source.getType()) + " msg: angle " +
+                                             angleString(step_angles[0]) + " is not a multiple of pi/4");
+                    }
+                    const auto k = static_cast<std::size_t>(((static_cast<long long>(rounded) % 8) + 8) % 8);
+                    for (auto phase : RZ_CLIFFORD_T[k]) {
+                        if (phase != GateType::NONE) {
+                            emit(source, phase, step_qubits, step_angles);
+                        }
+                    }
+                    continue;
+                }
+                if (normalizeAngle(step_angles[0]) == 0) {
+                    continue;
+                }
+            }
+            if (s.type == GateType::U3 && normalizeAngle(step_angles[0]) == 0 && normalizeAngle(step_angles[1] + step_angles[2]) == 0) {
+                continue;
+            }
+            emit(source, s.type, step_qubits, step_angles);
+        }
+    };
+
+    for (std::size_t i = 0; i < gates.size(); ++i) {
+        auto &gate = *gates[i];
+        const gate_t type = gate.getType();
+        if (type == GateType::RESET || type == GateType::MEASURE || type == GateType::BARRIER || type == GateType::IF ||
+            (inBasis(type, this->basis) && !(type == GateType::RZ && this->basis == DecompositionBasis::CLIFFORD_T))) {
+            kept.emplace_back(translated.size(), i);
+            translated.push_back(nullptr);
+            continue;
+        }
+
+        std::size_t a = 0;
+        values.fill(0);
+        for (const auto &entry : gate.getAngle()) {
+            if (a < MAX_ANGLES && !tryAngleValue(entry.second, values[a++])) {
+                throw QcoreException("[translate] gate: " + toString(type) + " msg: symbolic angle " + entry.second);
+            }
+        }
+
+        std::size_t n = 0;
+        for (auto q : gate.getControls()) {
+            operands[n++ % MAX_OPERANDS] = q;
+        }
+        for (auto q : gate.getTargets()) {
+            operands[n++ % MAX_OPERANDS] = q;
+        }
+
+        if (type == GateType::MCX && gate.getTargets().size() == 1) {
+            if (gate.getControls().size() <= 2) {
+                const gate_t direct[] = {GateType::X, GateType::CX, GateType::CCX};
+                lower(gate, direct[gate.getControls().size()], operands.data(), values.data());
+            } else {
+                if (!liveness) {
+                    liveness = std::make_unique<QubitLiveness>(qc);
+                }
+                auto dirty = QubitSet{}, clean = QubitSet{};
+                liveness->ancillasAt(i, dirty, clean);
+                // the plan steps are translated directly, no Clifford+T gate is constructed
+                auto translateStep = [&](const MCTPlanStep &step) {
+                    for (const DecompositionStep *g = step.steps; g != step.steps + step.count; ++g) {
+                        Qubit qubits[2];
+                        std::size_t m = 0;
+                        if (g->control != NO_SLOT) {
+                            qubits[m++] = step.qubits[g->control];
+                        }
+                        qubits[m] = step.qubits[g->target];
+                        lower(gate, g->type, qubits, values.data());
+                    }
+                };
+                planMCT(gate.getControls(), gate.getTargets()[0], dirty, clean, MCTPlanSink(translateStep));
+            }
+        } else {
+            if (n != operandCount(type)) {
+                throw QcoreException("[translate] gate: " + toString(type) + " msg: unexpected number of operands");
+            }
+            lower(gate, type, operands.data(), values.data());
+        }
+        ++count;
+    }
+
+    for (const auto &entry : kept) {
+        translated[entry.first] = std::move(gates[entry.second]);
+    }
+    gates.swap(translated);
+    qc.updateProperties();
+    if (approximated > 0) {
+        synthesizeRotations(qc, epsilon);
+    }
+    return count;
+}
+
+const BasisTranslator &basisTranslator(const DecompositionBasis &basis) {
+    switch (basis) {
+        case DecompositionBasis::CLIFFORD_T: {
+            static const BasisTranslator translator(DecompositionBasis::CLIFFORD_T);
+            return translator;
+        }
+        case DecompositionBasis::RZ_SX_X_CX: {
+            static const BasisTranslator translator(DecompositionBasis::RZ_SX_X_CX);
+            return translator;
+        }
+        default: {
+            static const BasisTranslator translator(DecompositionBasis::U3_CX);
+            return translator;
+        }
+    }
+}
+
+gcount_t translate(QCircuit &qc, const DecompositionBasis &basis, fp epsilon) {
+    return basisTranslator(basis).translate(qc, epsilon);
+}
+
+}  // namespace qcore
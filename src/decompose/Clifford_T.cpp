@@ -28,260 +28,426 @@
 
 #include "decompose/Clifford_T.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstdlib>
 #include <iostream>
+#include <iterator>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace qcore {
 
-QCircuit &decompose_CCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t, bool inverse) {
+// T-counts of the templates, checked at compile time
+static_assert(countSteps(CCX_CLIFFORD_T, GateType::T) + countSteps(CCX_CLIFFORD_T, GateType::TDG) == 7, "Toffoli T-count");
+static_assert(countSteps(RCCX_CLIFFORD_T, GateType::T) + countSteps(RCCX_CLIFFORD_T, GateType::TDG) == 4, "RCCX T-count");
+static_assert(countSteps(RC3X_CLIFFORD_T, GateType::T) + countSteps(RC3X_CLIFFORD_T, GateType::TDG) == 8, "RC3X T-count");
+
+void instantiate(const DecompositionStep *steps, std::size_t count, const Qubit *qubits, QGateSet &gates) {
+    gates.reserve(gates.size() + count);
+    for (const DecompositionStep *step = steps; step != steps + count; ++step) {
+        if (step->control == NO_SLOT) {
+            gates.push_back(std::make_unique<QGate>(step->type, 1, TargetSet{qubits[step->target]}));
+        } else {
+            gates.push_back(std::make_unique<QGate>(step->type, 2, ControlSet{qubits[step->control]}, TargetSet{qubits[step->target]}));
+        }
+    }
+}
+
+QCircuit decompose_CCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t, bool inverse) {
     auto qc = QCircuit{};
     qc.setQubits({c1, c2, t});
+    const Qubit qubits[] = {c1, c2, t};
     if (inverse == false) {
-        qc.addQGate(QGate(GateType::H, 1, {t}));
-        qc.addQGate(QGate(GateType::TDG, 1, {c1}));
-        qc.addQGate(QGate(GateType::TDG, 1, {c2}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){t}, {c1}));
-        qc.addQGate(QGate(GateType::T, 1, {c1}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c2}, {t}));
-        qc.addQGate(QGate(GateType::T, 1, {t}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c2}, {c1}));
-        qc.addQGate(QGate(GateType::TDG, 1, {c1}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c2}, {t}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){t}, {c1}));
-        qc.addQGate(QGate(GateType::T, 1, {c1}));
-        qc.addQGate(QGate(GateType::TDG, 1, {t}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c2}, {c1}));
-        qc.addQGate(QGate(GateType::H, 1, {t}));
+        instantiate(CCX_CLIFFORD_T, qubits, qc.getGates());
     } else {
-        qc.addQGate(QGate(GateType::H, 1, {t}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c2}, {c1}));
-        qc.addQGate(QGate(GateType::T, 1, {t}));
-        qc.addQGate(QGate(GateType::TDG, 1, {c1}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){t}, {c1}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c2}, {t}));
-        qc.addQGate(QGate(GateType::T, 1, {c1}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c2}, {c1}));
-        qc.addQGate(QGate(GateType::TDG, 1, {t}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c2}, {t}));
-        qc.addQGate(QGate(GateType::TDG, 1, {c1}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){t}, {c1}));
-        qc.addQGate(QGate(GateType::T, 1, {c2}));
-        qc.addQGate(QGate(GateType::T, 1, {c1}));
-        qc.addQGate(QGate(GateType::H, 1, {t}));
+        instantiate(CCXDG_CLIFFORD_T, qubits, qc.getGates());
     }
 
     return qc;
 }
 
-QCircuit &decompose_RCCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t) {
+QCircuit decompose_RCCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t) {
     auto qc = QCircuit{};
     qc.setQubits({c1, c2, t});
-
-    qc.addQGate(QGate(GateType::H, 1, {t}));
-    qc.addQGate(QGate(GateType::T, 1, {t}));
-    qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c2}, {t}));
-    qc.addQGate(QGate(GateType::TDG, 1, {t}));
-    qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c1}, {t}));
-    qc.addQGate(QGate(GateType::T, 1, {t}));
-    qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c2}, {t}));
-    qc.addQGate(QGate(GateType::TDG, 1, {t}));
-    qc.addQGate(QGate(GateType::H, 1, {t}));
+    const Qubit qubits[] = {c1, c2, t};
+    instantiate(RCCX_CLIFFORD_T, qubits, qc.getGates());
 
     return qc;
 }
 
-QCircuit &decompose_SRCCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t, bool inverse) {
+QCircuit decompose_SRCCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t, bool inverse) {
     auto qc = QCircuit{};
     qc.setQubits({c1, c2, t});
+    const Qubit qubits[] = {c1, c2, t};
     if (inverse == false) {
-        qc.addQGate(QGate(GateType::H, 1, {t}));
-        qc.addQGate(QGate(GateType::T, 1, {t}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c2}, {t}));
-        qc.addQGate(QGate(GateType::TDG, 1, {t}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c1}, {t}));
+        instantiate(SRCCX_CLIFFORD_T, qubits, qc.getGates());
     } else {
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c1}, {t}));
-        qc.addQGate(QGate(GateType::TDG, 1, {t}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c2}, {t}));
-        qc.addQGate(QGate(GateType::T, 1, {t}));
-        qc.addQGate(QGate(GateType::H, 1, {t}));
+        instantiate(SRCCXDG_CLIFFORD_T, qubits, qc.getGates());
     }
 
     return qc;
 }
 
-QCircuit &decompose_SSRCCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t, bool inverse) {
+QCircuit decompose_SSRCCX_Clifford_T(Qubit &c1, Qubit &c2, Qubit &t, bool inverse) {
     auto qc = QCircuit{};
     qc.setQubits({c1, c2, t});
+    const Qubit qubits[] = {c1, c2, t};
     if (inverse == false) {
-        qc.addQGate(QGate(GateType::H, 1, {t}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){t}, {c2}));
-        qc.addQGate(QGate(GateType::TDG, 1, {c2}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c1}, {c2}));
-        qc.addQGate(QGate(GateType::T, 1, {c2}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){t}, {c2}));
-        qc.addQGate(QGate(GateType::TDG, 1, {c2}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c1}, {c2}));
-        qc.addQGate(QGate(GateType::T, 1, {c2}));
+        instantiate(SSRCCX_CLIFFORD_T, qubits, qc.getGates());
     } else {
-        qc.addQGate(QGate(GateType::T, 1, {c2}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c1}, {c2}));
-        qc.addQGate(QGate(GateType::TDG, 1, {c2}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){t}, {c2}));
-        qc.addQGate(QGate(GateType::T, 1, {c2}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c1}, {c2}));
-        qc.addQGate(QGate(GateType::TDG, 1, {c2}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){t}, {c2}));
-        qc.addQGate(QGate(GateType::H, 1, {t}));
+        instantiate(SSRCCXDG_CLIFFORD_T, qubits, qc.getGates());
     }
 
     return qc;
 }
 
-QCircuit &decompose_RC3X_Clifford_T(Qubit &c1, Qubit &c2, Qubit &c3, Qubit &t) {
+QCircuit decompose_RC3X_Clifford_T(Qubit &c1, Qubit &c2, Qubit &c3, Qubit &t, bool inverse) {
     auto qc = QCircuit{};
     qc.setQubits({c1, c2, c3, t});
-
-    qc.addQGate(QGate(GateType::H, 1, {t}));
-    qc.addQGate(QGate(GateType::T, 1, {t}));
-    qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c3}, {t}));
-    qc.addQGate(QGate(GateType::TDG, 1, {t}));
-    qc.addQGate(QGate(GateType::H, 1, {t}));
-    qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c1}, {t}));
-    qc.addQGate(QGate(GateType::T, 1, {t}));
-    qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c2}, {t}));
-    qc.addQGate(QGate(GateType::TDG, 1, {t}));
-    qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c1}, {t}));
-    qc.addQGate(QGate(GateType::T, 1, {t}));
-    qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c2}, {t}));
-    qc.addQGate(QGate(GateType::TDG, 1, {t}));
-    qc.addQGate(QGate(GateType::H, 1, {t}));
-    qc.addQGate(QGate(GateType::T, 1, {t}));
-    qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c3}, {t}));
-    qc.addQGate(QGate(GateType::TDG, 1, {t}));
-    qc.addQGate(QGate(GateType::H, 1, {t}));
+    const Qubit qubits[] = {c1, c2, c3, t};
+    if (inverse == false) {
+        instantiate(RC3X_CLIFFORD_T, qubits, qc.getGates());
+    } else {
+        instantiate(RC3XDG_CLIFFORD_T, qubits, qc.getGates());
+    }
 
     return qc;
 }
 
-QCircuit &decompose_SRC3X_Clifford_T(Qubit &c1, Qubit &c2, Qubit &c3, Qubit &t, bool inverse) {
+QCircuit decompose_SRC3X_Clifford_T(Qubit &c1, Qubit &c2, Qubit &c3, Qubit &t, bool inverse) {
     auto qc = QCircuit{};
     qc.setQubits({c1, c2, c3, t});
-
+    const Qubit qubits[] = {c1, c2, c3, t};
     if (inverse == false) {
-        qc.addQGate(QGate(GateType::H, 1, {t}));
-        qc.addQGate(QGate(GateType::T, 1, {t}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c3}, {t}));
-        qc.addQGate(QGate(GateType::TDG, 1, {t}));
-        qc.addQGate(QGate(GateType::H, 1, {t}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c1}, {t}));
-        qc.addQGate(QGate(GateType::T, 1, {t}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c2}, {t}));
-        qc.addQGate(QGate(GateType::TDG, 1, {t}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c1}, {t}));
+        instantiate(SRC3X_CLIFFORD_T, qubits, qc.getGates());
     } else {
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c1}, {t}));
-        qc.addQGate(QGate(GateType::T, 1, {t}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c2}, {t}));
-        qc.addQGate(QGate(GateType::TDG, 1, {t}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c1}, {t}));
-        qc.addQGate(QGate(GateType::H, 1, {t}));
-        qc.addQGate(QGate(GateType::T, 1, {t}));
-        qc.addQGate(QGate(GateType::CX, 2, (ControlSet){c3}, {t}));
-        qc.addQGate(QGate(GateType::TDG, 1, {t}));
-        qc.addQGate(QGate(GateType::H, 1, {t}));
+        instantiate(SRC3XDG_CLIFFORD_T, qubits, qc.getGates());
     }
 
     return qc;
 }
 
-QCircuit &decompose_MCT_Clifford_T(QubitSet &controls, Qubit target, QubitSet &dirty, QubitSet &clean, bool inverse) {
-    auto qc = QCircuit{};
+DecompositionTemplate cliffordTTemplate(const gate_t &gateType) {
+    switch (gateType) {
+        case GateType::CCX:
+            return DecompositionTemplate{CCX_CLIFFORD_T.data(), CCX_CLIFFORD_T.size()};
+        case GateType::RCCX:
+            return DecompositionTemplate{RCCX_CLIFFORD_T.data(), RCCX_CLIFFORD_T.size()};
+        case GateType::SRCCX:
+            return DecompositionTemplate{SRCCX_CLIFFORD_T.data(), SRCCX_CLIFFORD_T.size()};
+        case GateType::SRCCXDG:
+            return DecompositionTemplate{SRCCXDG_CLIFFORD_T.data(), SRCCXDG_CLIFFORD_T.size()};
+        case GateType::SSRCCX:
+            return DecompositionTemplate{SSRCCX_CLIFFORD_T.data(), SSRCCX_CLIFFORD_T.size()};
+        case GateType::SSRCCXDG:
+            return DecompositionTemplate{SSRCCXDG_CLIFFORD_T.data(), SSRCCXDG_CLIFFORD_T.size()};
+        case GateType::RC3X:
+            return DecompositionTemplate{RC3X_CLIFFORD_T.data(), RC3X_CLIFFORD_T.size()};
+        case GateType::SRC3X:
+            return DecompositionTemplate{SRC3X_CLIFFORD_T.data(), SRC3X_CLIFFORD_T.size()};
+        case GateType::SRC3XDG:
+            return DecompositionTemplate{SRC3XDG_CLIFFORD_T.data(), SRC3XDG_CLIFFORD_T.size()};
+        default:
+            return DecompositionTemplate{};
+    }
+}
 
-    if (controls.size() == 2) {
-        qc = decompose_CCX_Clifford_T(controls[0], controls[1], target);
-    } 
-    else {
-        qcore::regsize_t ancilla_need = ((controls.size() - 2) / 2) + ((controls.size() - 2) % 2);
-        if (clean.size() + dirty.size() < ancilla_need) {
-            throw QcoreException("[decompose_MCT_Clifford_T] decomposition error msg: ancilla required (" + std::to_string(ancilla_need) + ") is higher than available (" + std::to_string(clean.size() + dirty.size()) + ").");
-        }
+bool isLoweredToCliffordT(QGate &gate) {
+    if (gate.getIsClassical()) {
+        return false;
+    }
+    const gsize_t operands = gate.getControls().size() + gate.getTargets().size();
+    if (cliffordTTemplate(gate.getType()).steps != nullptr) {
+        const std::size_t slots = (gate.getType() == GateType::RC3X || gate.getType() == GateType::SRC3X ||
+                                   gate.getType() == GateType::SRC3XDG)
+                                      ? 4
+                                      : 3;
+        return operands == slots && gate.getTargets().size() == 1;
+    }
+    return gate.getType() == GateType::MCX && gate.getTargets().size() == 1;
+}
 
-        qc.setQubits(mergeQubits({controls, {target}, dirty, clean}));
-        
-        //decompose using clean ancilla 
-        auto controls_covered = 0;
-        auto p_caq = clean[0];
-        for (auto & caq: clean){
-            if (controls.size() == 3 && controls_covered == 0){
-                qc.addQCircuit(decompose_RCCX_Clifford_T(controls[0], controls[1], caq));
-                controls_covered += 2; 
-            }
-            else if (controls.size() > 3 && controls_covered == 0){
-                qc.addQCircuit(decompose_RC3X_Clifford_T(controls[0], controls[1], controls[2], caq));
-                controls_covered += 3;
-            }
-            else if ((controls.size() - controls_covered) == 2) {
-                qc.addQCircuit(decompose_RCCX_Clifford_T(p_caq, controls[controls_covered], caq));
-                controls_covered += 1;
-            }
-            else if ((controls.size() - controls_covered) > 2) {
-                qc.addQCircuit(decompose_RC3X_Clifford_T(p_caq, controls[controls_covered], controls[controls_covered + 1], caq));
-                controls_covered += 2;
+namespace {
+
+constexpr DecompositionTable<1> X_CLIFFORD_T{{{GateType::X, NO_SLOT, 0}}};
+constexpr DecompositionTable<1> CX_CLIFFORD_T{{{GateType::CX, 0, 1}}};
+
+// qubits of two concatenated ranges, read in place instead of being copied together
+struct QubitSpan {
+    const Qubit *head = nullptr;
+    std::size_t head_size = 0;
+    const Qubit *tail = nullptr;
+    std::size_t tail_size = 0;
+
+    inline std::size_t size() const { return this->head_size + this->tail_size; }
+
+    inline Qubit operator[](std::size_t i) const { return (i < this->head_size) ? this->head[i] : this->tail[i - this->head_size]; }
+};
+
+// emits a template instance, or its inverse when the plan is mirrored
+template <std::size_t N, typename Sink>
+inline void emitStep(Sink &sink, const DecompositionTable<N> &table, const DecompositionTable<N> &inverse, bool mirrored,
+                     std::array<Qubit, 4> qubits) {
+    if (mirrored) {
+        sink(MCTPlanStep{inverse.data(), table.data(), N, qubits});
+    } else {
+        sink(MCTPlanStep{table.data(), inverse.data(), N, qubits});
+    }
+}
+
+// plans a Toffoli gate with at most two controls
+template <typename Sink>
+void planDirect(const QubitSpan &controls, Qubit target, bool mirrored, Sink &sink) {
+    if (controls.size() == 0) {
+        emitStep(sink, X_CLIFFORD_T, X_CLIFFORD_T, mirrored, {target});
+    } else if (controls.size() == 1) {
+        emitStep(sink, CX_CLIFFORD_T, CX_CLIFFORD_T, mirrored, {controls[0], target});
+    } else {
+        emitStep(sink, CCX_CLIFFORD_T, CCXDG_CLIFFORD_T, mirrored, {controls[0], controls[1], target});
+    }
+}
+
+// (k - 1) / 2 clean ancillas: compute the conjunction of k - 1 controls, flip the target, uncompute;
+// the mirrored plan differs only in the inverted target flip
+template <typename Sink>
+void planLadder(const QubitSpan &controls, Qubit target, const QubitSpan &ancillas, bool mirrored, Sink &sink) {
+    const std::size_t k = controls.size();
+    const std::size_t first = (k - 1 >= 3) ? 3 : 2;
+    const std::size_t rungs = 1 + (k - 1 - first + 1) / 2;
+
+    // rung j absorbs three (j = 0) or two controls, the last one possibly a single control
+    auto rung = [&](std::size_t j, bool inverted) {
+        if (j == 0) {
+            if (first == 3) {
+                emitStep(sink, RC3X_CLIFFORD_T, RC3XDG_CLIFFORD_T, inverted, {controls[0], controls[1], controls[2], ancillas[0]});
+            } else {
+                emitStep(sink, RCCX_CLIFFORD_T, RCCX_CLIFFORD_T, inverted, {controls[0], controls[1], ancillas[0]});
             }
-            
-            p_caq = caq;
-            
-            if ((controls.size() - controls_covered) == 1){
-                break;
+            return;
+        }
+        const std::size_t absorbed = first + 2 * (j - 1);
+        if (k - 1 - absorbed >= 2) {
+            emitStep(sink, RC3X_CLIFFORD_T, RC3XDG_CLIFFORD_T, inverted,
+                     {ancillas[j - 1], controls[absorbed], controls[absorbed + 1], ancillas[j]});
+        } else {
+            emitStep(sink, RCCX_CLIFFORD_T, RCCX_CLIFFORD_T, inverted, {ancillas[j - 1], controls[absorbed], ancillas[j]});
+        }
+    };
+
+    for (std::size_t j = 0; j < rungs; ++j) {
+        rung(j, false);
+    }
+    emitStep(sink, CCX_CLIFFORD_T, CCXDG_CLIFFORD_T, mirrored, {ancillas[rungs - 1], controls[k - 1], target});
+    for (std::size_t j = rungs; j-- > 0;) {
+        rung(j, true);
+    }
+}
+
+// k - 2 ancillas in any state: the ancilla ladder is a palindrome of self-inverse
+// relative phase Toffolis, so its phases cancel between the two target flips
+template <typename Sink>
+void planChain(const QubitSpan &controls, Qubit target, const QubitSpan &ancillas, bool mirrored, Sink &sink) {
+    const std::size_t k = controls.size();
+    if (k <= 2) {
+        planDirect(controls, target, mirrored, sink);
+        return;
+    }
+
+    auto ladder = [&]() {
+        for (std::size_t j = k - 3; j >= 1; --j) {
+            emitStep(sink, RCCX_CLIFFORD_T, RCCX_CLIFFORD_T, false, {controls[j + 1], ancillas[j - 1], ancillas[j]});
+        }
+        emitStep(sink, RCCX_CLIFFORD_T, RCCX_CLIFFORD_T, false, {controls[0], controls[1], ancillas[0]});
+        for (std::size_t j = 1; j <= k - 3; ++j) {
+            emitStep(sink, RCCX_CLIFFORD_T, RCCX_CLIFFORD_T, false, {controls[j + 1], ancillas[j - 1], ancillas[j]});
+        }
+    };
+    auto flip = [&]() { emitStep(sink, CCX_CLIFFORD_T, CCXDG_CLIFFORD_T, mirrored, {controls[k - 1], ancillas[k - 3], target}); };
+    for (int round = 0; round < 2; ++round) {
+        if (mirrored) {
+            ladder();
+            flip();
+        } else {
+            flip();
+            ladder();
+        }
+    }
+}
+
+// a single ancilla: controls c[0, h) are moved onto it borrowing c[h, k) and the target,
+// then c[h, k) and the ancilla control the target borrowing c[0, h)
+template <typename Sink>
+void planSplit(const QubitSpan &controls, Qubit target, Qubit ancilla, bool clean, bool mirrored, Sink &sink) {
+    const std::size_t k = controls.size(), h = (k + 1) / 2;
+
+    // controls is a single range at the top level
+    const QubitSpan lower{controls.head, h};
+    const QubitSpan lower_borrowed{controls.head + h, k - h, &target, 1};
+    const QubitSpan upper{controls.head + h, k - h, &ancilla, 1};
+
+    auto compute = [&]() { planChain(lower, ancilla, lower_borrowed, mirrored, sink); };
+    auto apply = [&]() { planChain(upper, target, lower, mirrored, sink); };
+
+    if (clean) {
+        compute();
+        apply();
+        compute();
+    } else if (mirrored) {
+        compute();
+        apply();
+        compute();
+        apply();
+    } else {
+        apply();
+        compute();
+        apply();
+        compute();
+    }
+}
+
+// accumulates T-count, then depth of the streamed steps; the depth levels are scratch
+// memory kept per thread, so costing a strategy allocates nothing once warm
+class CostSink {
+   private:
+    std::vector<std::pair<Qubit, std::size_t>> &levels;
+    std::size_t t_count = 0, depth = 0;
+
+    std::size_t &level(Qubit q) {
+        for (auto &entry : this->levels) {
+            if (entry.first == q) {
+                return entry.second;
             }
         }
-        auto qc_temp = qc; 
-        //decompose using dirty ancilla
-        if ((controls.size() - controls_covered) > 1){
-            auto p_daq = dirty[0];
-            auto qc2 = QCircuit{};
-            auto qc_temp2 = QCircuit{};
-            for (auto &daq: dirty){
-                if (daq == dirty[0]){
-                    qc2.addQCircuit(decompose_SSRCCX_Clifford_T(controls[controls_covered], daq, target));
-                    controls_covered += 1; 
-                }
-                else if ((controls.size() - controls_covered) == 1 ){
-                    qc_temp2 = qc2;
-                    qc2.addQCircuit(decompose_RCCX_Clifford_T(p_caq, controls[controls_covered], p_daq));
-                    break;
-                }
-                else if ((controls.size() - controls_covered) == 2) {
-                    qc_temp2 = qc2;
-                    qc2.addQCircuit(decompose_RC3X_Clifford_T(p_caq, controls[controls_covered] , controls[controls_covered + 1], p_daq));
-                    break;
-                }
-                else if ((controls.size() - controls_covered) > 3) {
-                    qc2.addQCircuit(decompose_SRC3X_Clifford_T(daq, controls[controls_covered], controls[controls_covered + 1], p_daq));
-                    controls_covered += 2;
-                }
-                else if ((controls.size() - controls_covered) > 2) {
-                    qc2.addQCircuit(decompose_SRCCX_Clifford_T(daq, controls[controls_covered], p_daq));
-                    controls_covered += 2;
-                }
-                p_caq = daq;            
-                if ((controls.size() - controls_covered) == 0){
-                    break;
-                }    
+        this->levels.emplace_back(q, 0);
+        return this->levels.back().second;
+    }
+
+   public:
+    explicit CostSink(std::vector<std::pair<Qubit, std::size_t>> &levels) : levels(levels) { this->levels.clear(); }
+
+    void operator()(const MCTPlanStep &step) {
+        for (const DecompositionStep *gate = step.steps; gate != step.steps + step.count; ++gate) {
+            this->t_count += (gate->type == GateType::T || gate->type == GateType::TDG) ? 1 : 0;
+            std::size_t &target = level(step.qubits[gate->target]);
+            if (gate->control == NO_SLOT) {
+                target += 1;
+            } else {
+                std::size_t &control = level(step.qubits[gate->control]);
+                target = control = std::max(target, control) + 1;
             }
-            qc2.addQCircuit(qc_temp2.inverse());
-            auto qc_temp3 = qc2;
-            qc2.addQCircuit(qc_temp3, 1, 1);
-            
+            this->depth = std::max(this->depth, target);
+        }
+    }
+
+    inline std::pair<std::size_t, std::size_t> cost() const { return {this->t_count, this->depth}; }
+};
+
+enum class MCTStrategy : std::uint8_t { LADDER, CHAIN, SPLIT };
+
+/**
+ * @brief Planning the decomposition of a k-control Toffoli gate
+ *
+ * @details Every strategy the ancillas allow is costed and the one with the lowest
+ *          T-count, then depth is emitted. A mirrored plan has the same cost, so both
+ *          directions choose the same strategy.
+ *
+ * @param controls The control qubits
+ * @param target The target qubit
+ * @param ancillas The ancilla qubits, the clean ones first
+ * @param clean The number of clean ancillas
+ * @param mirrored The flag for emitting the inverse plan
+ * @param sink The receiver of the plan steps
+ */
+template <typename Sink>
+void planMCT(const QubitSpan &controls, Qubit target, const QubitSpan &ancillas, std::size_t clean, bool mirrored, Sink &sink) {
+    const std::size_t k = controls.size(), a = ancillas.size();
+    if (k <= 2) {
+        planDirect(controls, target, mirrored, sink);
+        return;
+    }
+    if (a == 0) {
+        throw QcoreException("[decompose_MCT_Clifford_T] decomposition error msg: ancilla required (1) is higher than available (0).");
+    }
+
+    auto run = [&](MCTStrategy strategy, bool reverse, auto &receiver) {
+        switch (strategy) {
+            case MCTStrategy::LADDER:
+                planLadder(controls, target, ancillas, reverse, receiver);
+                break;
+            case MCTStrategy::CHAIN:
+                planChain(controls, target, ancillas, reverse, receiver);
+                break;
+            case MCTStrategy::SPLIT:
+                planSplit(controls, target, ancillas[0], clean > 0, reverse, receiver);
+                break;
         }
-        else{
-            qc.addQCircuit(decompose_CCX_Clifford_T(p_caq, controls[controls_covered], target));
+    };
+
+    thread_local auto levels = std::vector<std::pair<Qubit, std::size_t>>{};
+    bool found = false;
+    auto best = MCTStrategy::SPLIT;
+    auto best_cost = std::pair<std::size_t, std::size_t>{};
+    auto consider = [&](MCTStrategy strategy) {
+        auto counter = CostSink(levels);
+        run(strategy, false, counter);
+        if (!found || counter.cost() < best_cost) {
+            best = strategy;
+            best_cost = counter.cost();
+            found = true;
         }
-        qc.addQCircuit(qc_temp.inverse());
+    };
+
+    if (clean >= (k - 1) / 2) {
+        consider(MCTStrategy::LADDER);
     }
+    if (a >= k - 2) {
+        consider(MCTStrategy::CHAIN);
+    }
+    consider(MCTStrategy::SPLIT);
+
+    run(best, mirrored, sink);
+}
+
+}  // namespace
+
+void planMCT(const QubitSet &controls, Qubit target, const QubitSet &dirty, const QubitSet &clean, MCTPlanSink sink, bool inverse) {
+    const QubitSpan operands{controls.data(), controls.size()};
+    const QubitSpan ancillas{clean.data(), clean.size(), dirty.data(), dirty.size()};
+    planMCT(operands, target, ancillas, clean.size(), inverse, sink);
+}
+
+void instantiateMCT(const QubitSet &controls, Qubit target, const QubitSet &dirty, const QubitSet &clean, QGateSet &gates, bool inverse) {
+    gates.reserve(gates.size() + countMCT(controls, target, dirty, clean));
+    decompose_MCT_Clifford_T(controls, target, dirty, clean, std::back_inserter(gates), inverse);
+}
+
+std::size_t countMCT(const QubitSet &controls, Qubit target, const QubitSet &dirty, const QubitSet &clean) {
+    std::size_t count = 0;
+    auto counter = [&count](const MCTPlanStep &step) { count += step.count; };
+    planMCT(controls, target, dirty, clean, MCTPlanSink(counter));
+    return count;
+}
+
+QCircuit decompose_MCT_Clifford_T(QubitSet &controls, Qubit target, QubitSet &dirty, QubitSet &clean, bool inverse) {
+    auto qc = QCircuit{};
+    qc.setQubits(mergeQubits({controls, {target}, dirty, clean}));
+    instantiateMCT(controls, target, dirty, clean, qc.getGates(), inverse);
+
+    return qc;
+}
+
+QCircuit decompose_MCT_Clifford_T(QubitSet &controls, Qubit target, const QubitLiveness &liveness, std::size_t position, bool inverse) {
+    auto dirty = QubitSet{}, clean = QubitSet{};
+    liveness.ancillasAt(position, dirty, clean);
+
+    auto operand = [&controls, target](Qubit q) { return q == target || std::find(controls.begin(), controls.end(), q) != controls.end(); };
+    dirty.erase(std::remove_if(dirty.begin(), dirty.end(), operand), dirty.end());
+    clean.erase(std::remove_if(clean.begin(), clean.end(), operand), clean.end());
+
+    return decompose_MCT_Clifford_T(controls, target, dirty, clean, inverse);
 }
 
 }  // namespace qcore
\ No newline at end of file
@@ -0,0 +1,169 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Decompose.cpp
+ *  @brief  Instance Description for Whole-circuit Gate Decomposition
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "decompose/Decompose.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "analysis/Liveness.hpp"
+#include "decompose/Clifford_T.hpp"
+#include "parallel/ThreadPool.hpp"
+
+namespace qcore {
+
+namespace {
+
+// gates per lowered range
+constexpr std::size_t DECOMPOSE_GRAIN = 1024;
+
+std::size_t loweredSize(QGate &gate, const QubitLiveness &liveness, std::size_t position, QubitSet &dirty, QubitSet &clean) {
+    if (!isLoweredToCliffordT(gate)) {
+        return 1;
+    }
+    const DecompositionTemplate table = cliffordTTemplate(gate.getType());
+    if (table.steps != nullptr) {
+        return table.count;
+    }
+    dirty.clear();
+    clean.clear();
+    if (gate.getControls().size() >= 3) {
+        liveness.ancillasAt(position, dirty, clean);
+    }
+    return countMCT(gate.getControls(), gate.getTargets()[0], dirty, clean);
+}
+
+// dirty and clean are ancilla buffers reused across the gates of a range
+void lower(std::unique_ptr<QGate> &gate, const QubitLiveness &liveness, std::size_t position, QubitSet &dirty, QubitSet &clean,
+           QGateSet &gates) {
+    if (!isLoweredToCliffordT(*gate)) {
+        gates.push_back(std::move(gate));
+        return;
+    }
+
+    const DecompositionTemplate table = cliffordTTemplate(gate->getType());
+    if (table.steps != nullptr) {
+        Qubit qubits[4];
+        std::size_t slot = 0;
+        for (auto q : gate->getControls()) {
+            qubits[slot++] = q;
+        }
+        qubits[slot] = gate->getTargets()[0];
+        instantiate(table.steps, table.count, qubits, gates);
+        return;
+    }
+
+    dirty.clear();
+    clean.clear();
+    if (gate->getControls().size() >= 3) {
+        liveness.ancillasAt(position, dirty, clean);
+    }
+    decompose_MCT_Clifford_T(gate->getControls(), gate->getTargets()[0], dirty, clean, std::back_inserter(gates));
+}
+
+}  // namespace
+
+gcount_t decompose(QCircuit &qc, const DecompositionBasis &basis, std::size_t threads) {
+    if (basis != DecompositionBasis::CLIFFORD_T) {
+        throw QcoreException("[decompose] decomposition error msg: unsupported basis.");
+    }
+
+    auto &gates = qc.getGates();
+    const std::size_t n = gates.size();
+    if (n == 0) {
+        return 0;
+    }
+
+    // lowering preserves the state of every borrowed qubit, so the liveness of the
+    // input circuit holds for all ranges
+    const auto liveness = QubitLiveness(qc);
+
+    threads = resolveThreads(threads);
+    const std::size_t ranges = std::max<std::size_t>(1, std::min((n + DECOMPOSE_GRAIN - 1) / DECOMPOSE_GRAIN, 4 * threads));
+    const std::size_t span = (n + ranges - 1) / ranges;
+
+    auto pool = std::unique_ptr<ThreadPool>{};
+    if (ranges > 1 && threads > 1) {
+        pool = std::make_unique<ThreadPool>(std::min(threads, ranges));
+    }
+    auto forEachRange = [&](const std::function<void(std::size_t, std::size_t, std::size_t)> &func) {
+        auto run = [&](std::size_t first, std::size_t last) {
+            for (std::size_t r = first; r < last; ++r) {
+                func(r, std::min(r * span, n), std::min((r + 1) * span, n));
+            }
+        };
+        if (pool) {
+            parallelFor(*pool, ranges, run);
+        } else {
+            run(0, ranges);
+        }
+    };
+
+    // sizing throws before any gate is moved out of the circuit
+    auto offsets = std::vector<std::size_t>(ranges + 1, 0);
+    auto decomposed = std::vector<gcount_t>(ranges, 0);
+    forEachRange([&](std::size_t r, std::size_t begin, std::size_t end) {
+        auto dirty = QubitSet{}, clean = QubitSet{};
+        for (std::size_t i = begin; i < end; ++i) {
+            offsets[r + 1] += loweredSize(*gates[i], liveness, i, dirty, clean);
+            decomposed[r] += isLoweredToCliffordT(*gates[i]) ? 1 : 0;
+        }
+    });
+    for (std::size_t r = 0; r < ranges; ++r) {
+        offsets[r + 1] += offsets[r];
+    }
+
+    auto buffers = std::vector<QGateSet>(ranges);
+    forEachRange([&](std::size_t r, std::size_t begin, std::size_t end) {
+        buffers[r].reserve(offsets[r + 1] - offsets[r]);
+        auto dirty = QubitSet{}, clean = QubitSet{};
+        for (std::size_t i = begin; i < end; ++i) {
+            lower(gates[i], liveness, i, dirty, clean, buffers[r]);
+        }
+    });
+
+    auto result = QGateSet(offsets[ranges]);
+    forEachRange([&](std::size_t r, std::size_t, std::size_t) {
+        std::move(buffers[r].begin(), buffers[r].end(), result.begin() + static_cast<std::ptrdiff_t>(offsets[r]));
+        QGateSet{}.swap(buffers[r]);
+    });
+
+    gates.swap(result);
+    qc.updateProperties();
+
+    gcount_t count = 0;
+    for (auto d : decomposed) {
+        count += d;
+    }
+    return count;
+}
+
+}  // namespace qcore
@@ -0,0 +1,183 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   DecomposedView.cpp
+ *  @brief  Implementation of the Lazy Clifford+T Decomposition View
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "decompose/DecomposedView.hpp"
+
+#include <utility>
+
+namespace qcore {
+
+namespace {
+
+// the template instances a gate expands to, none if it is passed through
+void expand(QGate &gate, const QubitLiveness &liveness, std::size_t position, std::vector<MCTPlanStep> &plan) {
+    if (!isLoweredToCliffordT(gate)) {
+        return;
+    }
+
+    const DecompositionTemplate table = cliffordTTemplate(gate.getType());
+    if (table.steps != nullptr) {
+        MCTPlanStep step{table.steps, table.steps, table.count, {}};
+        std::size_t slot = 0;
+        for (auto q : gate.getControls()) {
+            step.qubits[slot++] = q;
+        }
+        step.qubits[slot] = gate.getTargets()[0];
+        plan.push_back(step);
+        return;
+    }
+
+    auto dirty = QubitSet{}, clean = QubitSet{};
+    if (gate.getControls().size() >= 3) {
+        liveness.ancillasAt(position, dirty, clean);
+    }
+    planMCT(gate.getControls(), gate.getTargets()[0], dirty, clean, plan);
+}
+
+}  // namespace
+
+DecomposedView::DecomposedView(QCircuit &qc) : qc(&qc), liveness(qc) {}
+
+DecomposedView::const_iterator::const_iterator(const DecomposedView *view, std::size_t position) : view(view), position(position) {
+    if (this->position < this->view->qc->getGates().size()) {
+        load();
+    }
+}
+
+void DecomposedView::const_iterator::load() {
+    QGate &gate = *this->view->qc->getGates()[this->position];
+    this->plan.clear();
+    this->step = 0;
+    this->offset = 0;
+    expand(gate, this->view->liveness, this->position, this->plan);
+    if (this->plan.empty()) {
+        this->current = DecomposedGate{gate.getType(), 0, 0, false, false, &gate};
+        return;
+    }
+    this->current.source = &gate;
+    settle();
+}
+
+void DecomposedView::const_iterator::settle() {
+    const MCTPlanStep &instance = this->plan[this->step];
+    const DecompositionStep &gate = instance.steps[this->offset];
+    const bool controlled = gate.control != NO_SLOT;
+    this->current = DecomposedGate{gate.type,       controlled ? instance.qubits[gate.control] : 0,
+                                   instance.qubits[gate.target], controlled, true, this->current.source};
+}
+
+DecomposedView::const_iterator &DecomposedView::const_iterator::operator++() {
+    if (!this->plan.empty() && ++this->offset == this->plan[this->step].count) {
+        this->offset = 0;
+        ++this->step;
+    }
+    if (!this->plan.empty() && this->step < this->plan.size()) {
+        settle();
+        return *this;
+    }
+
+    this->plan.clear();
+    this->step = 0;
+    this->offset = 0;
+    if (++this->position < this->view->qc->getGates().size()) {
+        load();
+    }
+    return *this;
+}
+
+gcount_t DecomposedView::size() const {
+    auto &gates = this->qc->getGates();
+    auto plan = std::vector<MCTPlanStep>{};
+    gcount_t count = 0;
+    for (std::size_t i = 0; i < gates.size(); ++i) {
+        plan.clear();
+        expand(*gates[i], this->liveness, i, plan);
+        if (plan.empty()) {
+            ++count;
+        }
+        for (const auto &step : plan) {
+            count += step.count;
+        }
+    }
+    return count;
+}
+
+std::array<gcount_t, GateType::TYPECOUNT> DecomposedView::histogram() const {
+    auto &gates = this->qc->getGates();
+    auto counts = std::array<gcount_t, GateType::TYPECOUNT>{};
+
+    // gate type counts per distinct template
+    auto tables = std::vector<std::pair<const DecompositionStep *, std::array<gcount_t, GateType::TYPECOUNT>>>{};
+    auto countsOf = [&tables](const MCTPlanStep &step) -> const std::array<gcount_t, GateType::TYPECOUNT> & {
+        for (const auto &table : tables) {
+            if (table.first == step.steps) {
+                return table.second;
+            }
+        }
+        tables.emplace_back(step.steps, std::array<gcount_t, GateType::TYPECOUNT>{});
+        for (std::size_t i = 0; i < step.count; ++i) {
+            ++tables.back().second[step.steps[i].type];
+        }
+        return tables.back().second;
+    };
+
+    auto plan = std::vector<MCTPlanStep>{};
+    for (std::size_t i = 0; i < gates.size(); ++i) {
+        plan.clear();
+        expand(*gates[i], this->liveness, i, plan);
+        if (plan.empty()) {
+            ++counts[gates[i]->getType()];
+        }
+        for (const auto &step : plan) {
+            const auto &table = countsOf(step);
+            for (std::size_t t = 0; t < GateType::TYPECOUNT; ++t) {
+                counts[t] += table[t];
+            }
+        }
+    }
+    return counts;
+}
+
+void DecomposedView::writeQASM(std::ostream &os) const {
+    os << "OPENQASM 2.0;\n"
+          "include \"qelib1.inc\";\n\n"
+          "qreg q["
+       << this->qc->getQregSize() << "];\ncreg c[" << this->qc->getCregSize() << "];";
+    for (const auto &gate : *this) {
+        if (!gate.lowered) {
+            os << "\n" << gate.source->toString(FileFormat::OpenQASM);
+        } else if (gate.controlled) {
+            os << "\n" << toString(gate.type) << " q[" << gate.control << "], q[" << gate.target << "];";
+        } else {
+            os << "\n" << toString(gate.type) << " q[" << gate.target << "];";
+        }
+    }
+}
+
+}  // namespace qcore
@@ -0,0 +1,885 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   RotationSynthesis.cpp
+ *  @brief  Implementation of the Approximate Clifford+T Synthesis of Z Rotations
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "decompose/RotationSynthesis.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+#include "Angle.hpp"
+#include "parallel/ThreadPool.hpp"
+
+namespace qcore {
+
+namespace {
+
+using int_t = __int128;
+using uint_t = unsigned __int128;
+using real_t = long double;
+using complex_t = std::complex<real_t>;
+
+const real_t SQRT2 = std::sqrt(static_cast<real_t>(2));
+const real_t LAMBDA = 1 + SQRT2;
+
+// largest denominator exponent searched, norms of candidates stay below 2^127
+constexpr int MAX_EXPONENT = 60;
+
+// slack of the search intervals, candidates are checked exactly afterwards
+constexpr real_t SLACK = 1e-9L;
+
+// candidates whose arithmetic leaves 128 bits are skipped
+struct Overflow {};
+
+inline int_t add(int_t x, int_t y) {
+    int_t r;
+    if (__builtin_add_overflow(x, y, &r)) {
+        throw Overflow{};
+    }
+    return r;
+}
+
+inline int_t sub(int_t x, int_t y) {
+    int_t r;
+    if (__builtin_sub_overflow(x, y, &r)) {
+        throw Overflow{};
+    }
+    return r;
+}
+
+inline int_t mul(int_t x, int_t y) {
+    int_t r;
+    if (__builtin_mul_overflow(x, y, &r)) {
+        throw Overflow{};
+    }
+    return r;
+}
+
+// a + b sqrt2
+struct ZRoot2 {
+    int_t a = 0;
+    int_t b = 0;
+};
+
+inline bool operator==(const ZRoot2 &x, const ZRoot2 &y) {
+    return x.a == y.a && x.b == y.b;
+}
+
+inline ZRoot2 operator-(const ZRoot2 &x, const ZRoot2 &y) {
+    return {sub(x.a, y.a), sub(x.b, y.b)};
+}
+
+inline ZRoot2 operator*(const ZRoot2 &x, const ZRoot2 &y) {
+    return {add(mul(x.a, y.a), mul(2, mul(x.b, y.b))), add(mul(x.a, y.b), mul(x.b, y.a))};
+}
+
+// sqrt2 -> -sqrt2
+inline ZRoot2 bullet(const ZRoot2 &x) {
+    return {x.a, -x.b};
+}
+
+inline int_t norm(const ZRoot2 &x) {
+    return sub(mul(x.a, x.a), mul(2, mul(x.b, x.b)));
+}
+
+inline real_t value(const ZRoot2 &x) {
+    return static_cast<real_t>(x.a) + static_cast<real_t>(x.b) * SQRT2;
+}
+
+// exact sign of a + b sqrt2
+int sign(const ZRoot2 &x) {
+    const int sa = (x.a > 0) - (x.a < 0), sb = (x.b > 0) - (x.b < 0);
+    if (sb == 0 || sa == sb) {
+        return sa;
+    }
+    if (sa == 0) {
+        return sb;
+    }
+    return (norm(x) > 0) ? sa : sb;
+}
+
+// a + b omega + c omega^2 + d omega^3, omega = exp(i pi / 4)
+struct ZOmega {
+    int_t a = 0;
+    int_t b = 0;
+    int_t c = 0;
+    int_t d = 0;
+};
+
+inline bool isZero(const ZOmega &x) {
+    return x.a == 0 && x.b == 0 && x.c == 0 && x.d == 0;
+}
+
+inline ZOmega operator+(const ZOmega &x, const ZOmega &y) {
+    return {add(x.a, y.a), add(x.b, y.b), add(x.c, y.c), add(x.d, y.d)};
+}
+
+inline ZOmega operator-(const ZOmega &x, const ZOmega &y) {
+    return {sub(x.a, y.a), sub(x.b, y.b), sub(x.c, y.c), sub(x.d, y.d)};
+}
+
+ZOmega operator*(const ZOmega &x, const ZOmega &y) {
+    // omega^4 = -1
+    return {sub(mul(x.a, y.a), add(add(mul(x.b, y.d), mul(x.c, y.c)), mul(x.d, y.b))),
+            sub(add(mul(x.a, y.b), mul(x.b, y.a)), add(mul(x.c, y.d), mul(x.d, y.c))),
+            sub(add(add(mul(x.a, y.c), mul(x.b, y.b)), mul(x.c, y.a)), mul(x.d, y.d)),
+            add(add(mul(x.a, y.d), mul(x.b, y.c)), add(mul(x.c, y.b), mul(x.d, y.a)))};
+}
+
+// complex conjugation, omega -> omega^7
+inline ZOmega dagger(const ZOmega &x) {
+    return {x.a, -x.d, -x.c, -x.b};
+}
+
+// sqrt2 -> -sqrt2, omega -> -omega
+inline ZOmega bullet(const ZOmega &x) {
+    return {x.a, -x.b, x.c, -x.d};
+}
+
+inline ZOmega omegaPower(ZOmega x, int power) {
+    for (int i = 0; i < ((power % 8) + 8) % 8; ++i) {
+        x = {-x.d, x.a, x.b, x.c};
+    }
+    return x;
+}
+
+inline ZOmega lift(const ZRoot2 &x) {
+    return {x.a, x.b, 0, -x.b};
+}
+
+inline complex_t value(const ZOmega &x) {
+    const real_t b = static_cast<real_t>(x.b), d = static_cast<real_t>(x.d);
+    return {static_cast<real_t>(x.a) + (b - d) / SQRT2, static_cast<real_t>(x.c) + (b + d) / SQRT2};
+}
+
+// x^dagger x, which lies in Z[sqrt2]
+inline ZRoot2 selfNorm(const ZOmega &x) {
+    const ZOmega p = dagger(x) * x;
+    return {p.a, p.b};
+}
+
+// x / sqrt2 if it lies in Z[omega], using sqrt2 = omega - omega^3
+bool divideSqrt2(ZOmega &x) {
+    const ZOmega y = x * ZOmega{0, 1, 0, -1};
+    if (y.a % 2 != 0 || y.b % 2 != 0 || y.c % 2 != 0 || y.d % 2 != 0) {
+        return false;
+    }
+    x = {y.a / 2, y.b / 2, y.c / 2, y.d / 2};
+    return true;
+}
+
+// Euclidean division rounding the quotient in both complex embeddings
+ZOmega quotient(const ZOmega &x, const ZOmega &y) {
+    const complex_t q = value(x) / value(y), r = value(bullet(x)) / value(bullet(y));
+    const complex_t even = (q + r) / static_cast<real_t>(2), odd = (q - r) / static_cast<real_t>(2);
+    // odd = b omega + d omega^3
+    return {static_cast<int_t>(std::round(even.real())), static_cast<int_t>(std::round((odd.real() + odd.imag()) / SQRT2)),
+            static_cast<int_t>(std::round(even.imag())), static_cast<int_t>(std::round((odd.imag() - odd.real()) / SQRT2))};
+}
+
+ZOmega gcd(ZOmega x, ZOmega y) {
+    for (int steps = 0; !isZero(y); ++steps) {
+        if (steps > 4 * MAX_EXPONENT) {
+            throw Overflow{};
+        }
+        const ZOmega r = x - quotient(x, y) * y;
+        x = y;
+        y = r;
+    }
+    return x;
+}
+
+// x, y < m < 2^127
+inline uint_t addMod(uint_t x, uint_t y, uint_t m) {
+    x += y;
+    return (x >= m) ? x - m : x;
+}
+
+uint_t mulMod(uint_t x, uint_t y, uint_t m) {
+    if ((x >> 64) == 0 && (y >> 64) == 0) {
+        return (x * y) % m;
+    }
+    uint_t r = 0;
+    for (x %= m; y != 0; y >>= 1) {
+        if (y & 1) {
+            r = addMod(r, x, m);
+        }
+        x = addMod(x, x, m);
+    }
+    return r;
+}
+
+uint_t powMod(uint_t x, uint_t e, uint_t m) {
+    uint_t r = 1 % m;
+    for (x %= m; e != 0; e >>= 1) {
+        if (e & 1) {
+            r = mulMod(r, x, m);
+        }
+        x = mulMod(x, x, m);
+    }
+    return r;
+}
+
+// Miller-Rabin, deterministic below 3.3e24
+bool isPrime(uint_t n) {
+    constexpr unsigned BASES[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+    if (n < 2) {
+        return false;
+    }
+    for (unsigned p : BASES) {
+        if (n % p == 0) {
+            return n == p;
+        }
+    }
+    uint_t d = n - 1;
+    int s = 0;
+    for (; (d & 1) == 0; d >>= 1) {
+        ++s;
+    }
+    for (unsigned a : BASES) {
+        uint_t x = powMod(a, d, n);
+        if (x == 1 || x == n - 1) {
+            continue;
+        }
+        bool composite = true;
+        for (int i = 1; i < s && composite; ++i) {
+            x = mulMod(x, x, n);
+            composite = (x != n - 1);
+        }
+        if (composite) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// h with h^2 = -1 mod p for a prime p = 1 mod 4
+bool sqrtMinusOne(uint_t p, uint_t &h) {
+    for (unsigned c = 2; c < 256; ++c) {
+        h = powMod(c, (p - 1) / 4, p);
+        if (mulMod(h, h, p) == p - 1) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// v with v^dagger v = unit for a doubly positive unit lambda^2m of Z[sqrt2]
+bool unitRoot(ZRoot2 unit, ZOmega &v) {
+    const ZRoot2 up{3, 2}, down{3, -2};
+    const ZOmega lambda = lift({1, 1}), inverse = lift({-1, 1});
+    v = ZOmega{1, 0, 0, 0};
+    for (int i = 0; i < 4 * MAX_EXPONENT && !(unit == ZRoot2{1, 0}); ++i) {
+        if (value(unit) > 1) {
+            unit = unit * down;
+            v = v * lambda;
+        } else {
+            unit = unit * up;
+            v = v * inverse;
+        }
+    }
+    return unit == ZRoot2{1, 0};
+}
+
+/*
+ * Solving t^dagger t = xi in Z[omega] for a doubly positive xi. Factors of
+ * 2 + sqrt2 = delta^dagger delta, delta = 1 + omega, are split off; the rest must be
+ * a unit or have a prime norm p = 1 mod 8, whose factor in Z[omega] is the gcd of xi
+ * and h - i with h^2 = -1 mod p.
+ */
+bool solveNormEquation(ZRoot2 xi, ZOmega &t) {
+    const ZRoot2 original = xi;
+    if (xi == ZRoot2{}) {
+        t = ZOmega{};
+        return true;
+    }
+    if (sign(xi) < 0 || sign(bullet(xi)) < 0) {
+        return false;
+    }
+
+    int deltas = 0;
+    while (xi.a % 2 == 0) {
+        const ZRoot2 y = xi * ZRoot2{2, -1};
+        xi = {y.a / 2, y.b / 2};
+        ++deltas;
+    }
+
+    const int_t n = norm(xi);
+    ZOmega v;
+    if (n == 1) {
+        if (!unitRoot(xi, v)) {
+            return false;
+        }
+    } else {
+        uint_t h = 0;
+        if (n <= 0 || n % 8 != 1 || !isPrime(static_cast<uint_t>(n)) || !sqrtMinusOne(static_cast<uint_t>(n), h)) {
+            return false;
+        }
+        const ZOmega g = gcd(ZOmega{static_cast<int_t>(h), 0, -1, 0}, lift(xi));
+
+        // g^dagger g = xi * unit, the unit is taken out with a root of its inverse
+        const ZRoot2 scaled = selfNorm(g) * bullet(xi);
+        if (scaled.a % n != 0 || scaled.b % n != 0) {
+            return false;
+        }
+        ZOmega root;
+        if (!unitRoot(bullet(ZRoot2{scaled.a / n, scaled.b / n}), root)) {
+            return false;
+        }
+        v = g * root;
+    }
+
+    for (int i = 0; i < deltas; ++i) {
+        v = v * ZOmega{1, 1, 0, 0};
+    }
+    t = v;
+    return selfNorm(t) == original;
+}
+
+/*
+ * Calling visit(alpha) for the alpha in Z[sqrt2] with alpha in [x0, x1] and alpha• in
+ * [y0, y1] until it returns false. Scaling by lambda^n, lambda = 1 + sqrt2, maps the
+ * conjugate by (-1/lambda)^n, which balances both intervals so that the enumeration
+ * costs about as much as there are solutions.
+ */
+bool gridPoints(real_t x0, real_t x1, real_t y0, real_t y1, const std::function<bool(const ZRoot2 &)> &visit) {
+    if (x1 < x0 || y1 < y0) {
+        return true;
+    }
+    const real_t dx = std::max(x1 - x0, SLACK), dy = std::max(y1 - y0, SLACK);
+    const int n = std::max(-30, std::min(30, static_cast<int>(std::lround(std::log(dy / dx) / (2 * std::log(LAMBDA))))));
+
+    const real_t scale = std::pow(LAMBDA, static_cast<real_t>(n));
+    x0 *= scale;
+    x1 *= scale;
+    y0 /= scale;
+    y1 /= scale;
+    if (n % 2 != 0) {
+        std::swap(y0, y1);
+        y0 = -y0;
+        y1 = -y1;
+    }
+    ZRoot2 unscale{1, 0};
+    for (int i = 0; i < std::abs(n); ++i) {
+        unscale = unscale * ((n > 0) ? ZRoot2{-1, 1} : ZRoot2{1, 1});
+    }
+
+    // beta = a + b sqrt2 with beta - beta• = 2 b sqrt2
+    const auto bmin = static_cast<int_t>(std::ceil((x0 - y1) / (2 * SQRT2)));
+    const auto bmax = static_cast<int_t>(std::floor((x1 - y0) / (2 * SQRT2)));
+    for (int_t b = bmin; b <= bmax; ++b) {
+        const real_t offset = static_cast<real_t>(b) * SQRT2;
+        const auto amin = static_cast<int_t>(std::ceil(std::max(x0 - offset, y0 + offset)));
+        const auto amax = static_cast<int_t>(std::floor(std::min(x1 - offset, y1 + offset)));
+        for (int_t a = amin; a <= amax; ++a) {
+            if (!visit(ZRoot2{a, b} * unscale)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// first column (u, t) / sqrt2^k of a unitary [[u, -det t^dagger], [t, det u^dagger]], det = omega^phase
+struct Column {
+    ZOmega u{};
+    ZOmega t{};
+    int k = 0;
+    int phase = 0;
+};
+
+// smallest denominator exponent of |u|^2
+int sde(const Column &column) {
+    ZRoot2 m = selfNorm(column.u);
+    if (m == ZRoot2{}) {
+        return 0;
+    }
+    int e = 2 * column.k;
+    for (; e > 0 && m.a % 2 == 0; --e) {
+        m = {m.b, m.a / 2};
+    }
+    return e;
+}
+
+// H T^j applied from the left
+Column step(const Column &column, int j) {
+    const ZOmega rotated = omegaPower(column.t, j);
+    Column next{column.u + rotated, column.u - rotated, column.k + 1, (column.phase + 4 + j) % 8};
+    while (next.k > 0) {
+        ZOmega u = next.u, t = next.t;
+        if (!divideSqrt2(u) || !divideSqrt2(t)) {
+            break;
+        }
+        next.u = u;
+        next.t = t;
+        --next.k;
+    }
+    return next;
+}
+
+bool reachIntegral(const Column &column, int depth, std::vector<int> &path, Column &last) {
+    if (column.k == 0) {
+        last = column;
+        return true;
+    }
+    for (int j = 0; j < 4 && depth > 0; ++j) {
+        path.push_back(j);
+        if (reachIntegral(step(column, j), depth - 1, path, last)) {
+            return true;
+        }
+        path.pop_back();
+    }
+    return false;
+}
+
+// e with x = omega^e, -1 if x is no power of omega
+int unitExponent(const ZOmega &x) {
+    const int_t coefficients[] = {x.a, x.b, x.c, x.d};
+    int exponent = -1;
+    for (int i = 0; i < 4; ++i) {
+        if (coefficients[i] == 0) {
+            continue;
+        }
+        if (exponent != -1 || (coefficients[i] != 1 && coefficients[i] != -1)) {
+            return -1;
+        }
+        exponent = (coefficients[i] == 1) ? i : i + 4;
+    }
+    return exponent;
+}
+
+// phase gates realizing diag(1, omega^k) up to a global phase
+constexpr std::array<std::array<gate_t, 2>, 8> PHASE_CLIFFORD_T{{{GateType::NONE, GateType::NONE},
+                                                                 {GateType::T, GateType::NONE},
+                                                                 {GateType::S, GateType::NONE},
+                                                                 {GateType::S, GateType::T},
+                                                                 {GateType::S, GateType::S},
+                                                                 {GateType::SDG, GateType::TDG},
+                                                                 {GateType::SDG, GateType::NONE},
+                                                                 {GateType::TDG, GateType::NONE}}};
+
+void appendPhase(CliffordTWord &word, int power) {
+    for (auto gate : PHASE_CLIFFORD_T[((power % 8) + 8) % 8]) {
+        if (gate != GateType::NONE) {
+            word.push_back(gate);
+        }
+    }
+}
+
+/*
+ * Kliuchnikov-Maslov-Mosca exact synthesis: while sde(|u|^2) >= 4 one of H T^j,
+ * j < 4, lowers it by one. The few unitaries left with small denominators are
+ * finished by a bounded search, then U = T^-j1 H ... T^-jn H U' with U' a
+ * (permuted) diagonal of powers of omega.
+ */
+bool exactSynthesis(Column column, CliffordTWord &word) {
+    auto steps = std::vector<int>{};
+    while (column.k > 0) {
+        Column best{};
+        int best_j = -1;
+        for (int j = 0; j < 4; ++j) {
+            const Column next = step(column, j);
+            if (best_j == -1 || sde(next) < sde(best) || (sde(next) == sde(best) && next.k < best.k)) {
+                best = next;
+                best_j = j;
+            }
+        }
+        if (sde(best) < sde(column)) {
+            steps.push_back(best_j);
+            column = best;
+            continue;
+        }
+        auto path = std::vector<int>{};
+        if (!reachIntegral(column, 6, path, column)) {
+            return false;
+        }
+        steps.insert(steps.end(), path.begin(), path.end());
+    }
+
+    word.clear();
+    int pending = 0;
+    if (isZero(column.t)) {
+        const int a = unitExponent(column.u);
+        if (a < 0) {
+            return false;
+        }
+        pending = column.phase - 2 * a;
+    } else if (isZero(column.u)) {
+        const int b = unitExponent(column.t);
+        if (b < 0) {
+            return false;
+        }
+        appendPhase(word, 4 + column.phase - 2 * b);
+        word.push_back(GateType::X);
+    } else {
+        return false;
+    }
+    for (auto it = steps.rbegin(); it != steps.rend(); ++it) {
+        appendPhase(word, pending);
+        word.push_back(GateType::H);
+        pending = 8 - *it;
+    }
+    appendPhase(word, pending);
+    return true;
+}
+
+// operator norm distance of a word to RZ(angle) up to a global phase
+real_t distance(const CliffordTWord &word, real_t angle) {
+    using matrix_t = std::array<complex_t, 4>;
+    const real_t h = 1 / SQRT2;
+    const complex_t w = std::polar(static_cast<real_t>(1), static_cast<real_t>(PI) / 4);
+    matrix_t m{1, 0, 0, 1};
+    for (auto type : word) {
+        matrix_t g{1, 0, 0, 1};
+        switch (type) {
+            case GateType::H:
+                g = {h, h, h, -h};
+                break;
+            case GateType::X:
+                g = {0, 1, 1, 0};
+                break;
+            case GateType::T:
+                g[3] = w;
+                break;
+            case GateType::TDG:
+                g[3] = std::conj(w);
+                break;
+            case GateType::S:
+                g[3] = w * w;
+                break;
+            default:
+                g[3] = std::conj(w * w);
+                break;
+        }
+        m = {g[0] * m[0] + g[1] * m[2], g[0] * m[1] + g[1] * m[3], g[2] * m[0] + g[3] * m[2], g[2] * m[1] + g[3] * m[3]};
+    }
+    // tr(M^dagger RZ)
+    const complex_t trace = std::conj(m[0]) * std::polar(static_cast<real_t>(1), -angle / 2) +
+                            std::conj(m[3]) * std::polar(static_cast<real_t>(1), angle / 2);
+    return std::sqrt(std::max(static_cast<real_t>(0), 2 - std::abs(trace)));
+}
+
+void checkEpsilon(const std::string &function, fp epsilon) {
+    if (!(epsilon >= MIN_SYNTHESIS_EPSILON && epsilon < 1)) {
+        throw QcoreException("[" + function + "] epsilon: " + std::to_string(epsilon) + " msg: must be in [" +
+                             std::to_string(MIN_SYNTHESIS_EPSILON) + ", 1)");
+    }
+}
+
+const std::array<gate_t, 6> WORD_GATES{GateType::H, GateType::S, GateType::SDG, GateType::T, GateType::TDG, GateType::X};
+
+std::string formatWord(const CliffordTWord &word) {
+    if (word.empty()) {
+        return "-";
+    }
+    std::string text;
+    for (auto type : word) {
+        text += (text.empty() ? "" : ",") + toString(type);
+    }
+    return text;
+}
+
+bool parseWord(const std::string &text, CliffordTWord &word) {
+    word.clear();
+    if (text == "-") {
+        return true;
+    }
+    std::istringstream names(text);
+    for (std::string name; std::getline(names, name, ',');) {
+        auto found = std::find_if(WORD_GATES.begin(), WORD_GATES.end(), [&](const gate_t &type) { return toString(type) == name; });
+        if (found == WORD_GATES.end()) {
+            return false;
+        }
+        word.push_back(*found);
+    }
+    return true;
+}
+
+inline fp fromBits(std::uint64_t bits) {
+    fp value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+}  // namespace
+
+CliffordTWord synthesizeRZ(fp angle, fp epsilon) {
+    checkEpsilon("synthesizeRZ", epsilon);
+
+    auto word = CliffordTWord{};
+    std::int64_t multiple = 0;
+    if (isAngleMultiple(angle, PI / 4, multiple)) {
+        appendPhase(word, static_cast<int>(multiple));
+        return word;
+    }
+
+    const real_t theta = normalizeAngle(angle);
+    const complex_t z = std::polar(static_cast<real_t>(1), -theta / 2);
+    const real_t threshold = 1 - static_cast<real_t>(epsilon) * epsilon / 2;
+
+    auto candidate = [&](const ZOmega &w, int k, real_t r) {
+        try {
+            if (std::real(value(w) / r * std::conj(z)) < threshold) {
+                return false;
+            }
+            ZOmega t;
+            if (!solveNormEquation(ZRoot2{static_cast<int_t>(1) << k, 0} - selfNorm(w), t)) {
+                return false;
+            }
+            return exactSynthesis(Column{w, t, k, 0}, word) && distance(word, theta) <= epsilon * (1 + 1e-6);
+        } catch (const Overflow &) {
+            return false;
+        }
+    };
+
+    for (int k = 0; k <= MAX_EXPONENT; ++k) {
+        // the epsilon region: |w| <= r and Re(w z*) >= c
+        const real_t r = std::sqrt(std::ldexp(static_cast<real_t>(1), k)), c = r * threshold;
+        const real_t chord = std::sqrt(std::max(static_cast<real_t>(0), r * r - c * c));
+        real_t x0 = std::min(c * z.real() - chord * z.imag(), c * z.real() + chord * z.imag());
+        real_t x1 = std::max(c * z.real() - chord * z.imag(), c * z.real() + chord * z.imag());
+        if (z.real() * r >= c) {
+            x1 = r;
+        }
+        if (-z.real() * r >= c) {
+            x0 = -r;
+        }
+
+        // w = alpha + i beta (+ omega) with alpha, beta in Z[sqrt2], w• = alpha• + i beta• (- omega)
+        for (int offset = 0; offset < 2; ++offset) {
+            const real_t s = offset ? 1 / SQRT2 : 0;
+            const ZOmega shift = offset ? ZOmega{0, 1, 0, 0} : ZOmega{};
+
+            auto column = [&](const ZRoot2 &alpha) {
+                const real_t x = value(alpha) + s, xc = value(bullet(alpha)) - s;
+                if (x * x > r * r || xc * xc > r * r) {
+                    return true;
+                }
+                real_t y0 = -std::sqrt(r * r - x * x), y1 = -y0;
+                const real_t bound = (c - x * z.real()) / z.imag();
+                if (z.imag() > 0) {
+                    y0 = std::max(y0, bound);
+                } else {
+                    y1 = std::min(y1, bound);
+                }
+                const real_t yc = std::sqrt(r * r - xc * xc);
+                return gridPoints(y0 - s - SLACK, y1 - s + SLACK, -yc + s - SLACK, yc + s + SLACK, [&](const ZRoot2 &beta) {
+                    return !candidate(lift(alpha) + omegaPower(lift(beta), 2) + shift, k, r);
+                });
+            };
+            if (!gridPoints(x0 - s - SLACK, x1 - s + SLACK, -r + s - SLACK, r + s + SLACK, column)) {
+                return word;
+            }
+        }
+    }
+    throw QcoreException("[synthesizeRZ] angle: " + angleString(angle) + " msg: no approximation up to sqrt2^" +
+                         std::to_string(MAX_EXPONENT));
+}
+
+std::size_t RZSynthesisCache::KeyHash::operator()(const key_t &key) const {
+    return static_cast<std::size_t>((key.first * 0x9E3779B97F4A7C15ULL) ^ key.second);
+}
+
+RZSynthesisCache::key_t RZSynthesisCache::keyOf(fp angle, fp epsilon) {
+    const fp normalized = normalizeAngle(angle);
+    key_t key;
+    std::memcpy(&key.first, &normalized, sizeof(normalized));
+    std::memcpy(&key.second, &epsilon, sizeof(epsilon));
+    return key;
+}
+
+RZSynthesisCache::RZSynthesisCache(const std::string &file) : file(file) {
+    if (file.empty()) {
+        return;
+    }
+    auto ifs = std::ifstream(file);
+    std::string line, text;
+    while (std::getline(ifs, line)) {
+        std::istringstream row(line);
+        fp angle, epsilon;
+        CliffordTWord word;
+        if (row >> angle >> epsilon >> text && parseWord(text, word)) {
+            this->words[keyOf(angle, epsilon)] = std::move(word);
+        }
+    }
+}
+
+const CliffordTWord &RZSynthesisCache::store(const std::vector<std::pair<key_t, CliffordTWord>> &entries) {
+    std::unique_lock<std::shared_mutex> guard(this->lock);
+    auto ofs = std::ofstream{};
+    if (!this->file.empty()) {
+        ofs.open(this->file, std::ios::app);
+        if (!ofs.good()) {
+            throw QcoreException("[RZSynthesisCache] unable to open file " + this->file);
+        }
+        ofs.precision(17);
+    }
+
+    const CliffordTWord *first = nullptr;
+    for (const auto &entry : entries) {
+        const auto inserted = this->words.emplace(entry.first, entry.second);
+        if (inserted.second && ofs.is_open()) {
+            ofs << fromBits(entry.first.first) << ' ' << fromBits(entry.first.second) << ' ' << formatWord(entry.second) << '\n';
+        }
+        if (first == nullptr) {
+            first = &inserted.first->second;
+        }
+    }
+    return *first;
+}
+
+const CliffordTWord &RZSynthesisCache::lookup(fp angle, fp epsilon) {
+    const key_t key = keyOf(angle, epsilon);
+    {
+        std::shared_lock<std::shared_mutex> guard(this->lock);
+        auto found = this->words.find(key);
+        if (found != this->words.end()) {
+            return found->second;
+        }
+    }
+    return store({{key, synthesizeRZ(fromBits(key.first), epsilon)}});
+}
+
+std::size_t RZSynthesisCache::prefetch(const std::vector<fp> &angles, fp epsilon, std::size_t threads) {
+    auto entries = std::vector<std::pair<key_t, CliffordTWord>>{};
+    {
+        std::shared_lock<std::shared_mutex> guard(this->lock);
+        for (auto angle : angles) {
+            const key_t key = keyOf(angle, epsilon);
+            if (this->words.find(key) == this->words.end()) {
+                entries.emplace_back(key, CliffordTWord{});
+            }
+        }
+    }
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+    if (entries.empty()) {
+        return 0;
+    }
+
+    auto run = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            entries[i].second = synthesizeRZ(fromBits(entries[i].first.first), epsilon);
+        }
+    };
+    threads = std::min(resolveThreads(threads), entries.size());
+    if (threads > 1) {
+        ThreadPool pool(threads);
+        parallelFor(pool, entries.size(), run);
+    } else {
+        run(0, entries.size());
+    }
+    store(entries);
+    return entries.size();
+}
+
+bool RZSynthesisCache::contains(fp angle, fp epsilon) const {
+    std::shared_lock<std::shared_mutex> guard(this->lock);
+    return this->words.find(keyOf(angle, epsilon)) != this->words.end();
+}
+
+std::size_t RZSynthesisCache::size() const {
+    std::shared_lock<std::shared_mutex> guard(this->lock);
+    return this->words.size();
+}
+
+RZSynthesisCache &defaultSynthesisCache() {
+    static RZSynthesisCache cache;
+    return cache;
+}
+
+gcount_t synthesizeRotations(QCircuit &qc, fp epsilon, RZSynthesisCache &cache, std::size_t threads) {
+    checkEpsilon("synthesizeRotations", epsilon);
+    auto &gates = qc.getGates();
+
+    auto isRotation = [](QGate &gate) {
+        const gate_t type = gate.getType();
+        return (type == GateType::RZ || type == GateType::P || type == GateType::U1) && gate.getAngle().size() == 1;
+    };
+    auto angleOf = [](QGate &gate) {
+        fp value = 0;
+        if (!tryAngleValue(gate.getAngle().begin()->second, value)) {
+            throw QcoreException("[synthesizeRotations] gate: " + toString(gate.getType()) + " msg: symbolic angle " +
+                                 gate.getAngle().begin()->second);
+        }
+        return value;
+    };
+
+    // the distinct approximated angles are synthesized up front, so a throw leaves the circuit intact
+    auto angles = std::vector<fp>{};
+    for (const auto &gate : gates) {
+        std::int64_t multiple = 0;
+        if (isRotation(*gate) && !isAngleMultiple(angleOf(*gate), PI / 4, multiple)) {
+            angles.push_back(angleOf(*gate));
+        }
+    }
+    cache.prefetch(angles, epsilon, threads);
+
+    auto synthesized = QGateSet{};
+    synthesized.reserve(gates.size());
+    gcount_t count = 0;
+    for (auto &gate : gates) {
+        if (!isRotation(*gate)) {
+            synthesized.push_back(std::move(gate));
+            continue;
+        }
+        std::int64_t multiple = 0;
+        const fp angle = angleOf(*gate);
+        const bool exact = isAngleMultiple(angle, PI / 4, multiple);
+        auto phase = CliffordTWord{};
+        if (exact) {
+            appendPhase(phase, static_cast<int>(multiple));
+        }
+        for (auto type : exact ? phase : cache.lookup(angle, epsilon)) {
+            auto replacement = std::make_unique<QGate>(type, 1, gate->getCbits(), RotationMap{}, ControlSet{}, gate->getTargets());
+            if (gate->getIsClassical()) {
+                replacement->setIsClassical(true);
+                replacement->setExpression(gate->setExpression());
+            }
+            synthesized.push_back(std::move(replacement));
+        }
+        ++count;
+    }
+    gates.swap(synthesized);
+    qc.updateProperties();
+    return count;
+}
+
+gcount_t synthesizeRotations(QCircuit &qc, fp epsilon, std::size_t threads) {
+    return synthesizeRotations(qc, epsilon, defaultSynthesisCache(), threads);
+}
+
+}  // namespace qcore
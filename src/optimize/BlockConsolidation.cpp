@@ -0,0 +1,337 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   BlockConsolidation.cpp
+ *  @brief  Instance Description for the Two-Qubit Block Consolidation Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "optimize/BlockConsolidation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+#include "optimize/SingleQubitFusion.hpp"
+#include "parallel/ThreadPool.hpp"
+
+namespace qcore {
+
+static constexpr std::size_t NO_BLOCK = std::numeric_limits<std::size_t>::max();
+
+// tolerance for vanishing canonical coordinates
+static constexpr fp COORDINATE_TOLERANCE = static_cast<fp>(1e-9);
+
+gcount_t cxCost(QGate &gate) {
+    switch (gate.getType()) {
+        case GateType::CX:
+        case GateType::CY:
+        case GateType::CZ:
+            return 1;
+        case GateType::CH:
+        case GateType::CS:
+        case GateType::CSDG:
+        case GateType::CT:
+        case GateType::CTDG:
+        case GateType::CSX:
+        case GateType::CV:
+        case GateType::CSXDG:
+        case GateType::CVDG:
+        case GateType::CRX:
+        case GateType::CRY:
+        case GateType::CRZ:
+        case GateType::CP:
+        case GateType::CU1:
+        case GateType::CU2:
+        case GateType::CU3:
+        case GateType::CU:
+        case GateType::RXX:
+        case GateType::RZZ:
+        case GateType::ISWAP:
+            return 2;
+        case GateType::SWAP:
+            return 3;
+        default:
+            return 0;
+    }
+}
+
+static Matrix2 rxMatrix(fp theta) {
+    const fp c = std::cos(theta / 2), s = std::sin(theta / 2);
+    return {Complex{c, 0}, Complex{0, -s}, Complex{0, -s}, Complex{c, 0}};
+}
+
+static Matrix2 rzMatrix(fp theta) {
+    return {std::polar(1.0, -theta / 2), Complex{0, 0}, Complex{0, 0}, std::polar(1.0, theta / 2)};
+}
+
+// local operations between two CX gates (control low, target high)
+struct LocalLayer {
+    Matrix2 low = IDENTITY2;
+    Matrix2 high = IDENTITY2;
+};
+
+// layers of CX-based circuits for Can(x, y, z) = exp(i (x XX + y YY + z ZZ)), the
+// circuit is layers[0], CX, layers[1], ..., CX, layers.back()
+static std::vector<LocalLayer> canonicalLayers(std::size_t cx_count, fp x, fp y, fp z) {
+    const Matrix2 h = fixedMatrix(GateType::H);
+    const Matrix2 s = fixedMatrix(GateType::S);
+    switch (cx_count) {
+        case 0:
+            return {LocalLayer{}};
+        case 1:
+            // Can(pi/4, 0, 0) = H_low Rz_low(-pi/2) Rx_high(-pi/2) CX H_low
+            return {LocalLayer{h, IDENTITY2}, LocalLayer{multiply(h, rzMatrix(-PI / 2)), rxMatrix(-PI / 2)}};
+        case 2:
+            // CX maps XX to X_low and ZZ to Z_high
+            return {LocalLayer{}, LocalLayer{rxMatrix(-2 * x), rzMatrix(-2 * z)}, LocalLayer{}};
+        default:
+            // conjugation by CX leaves exp(i (x X_low - y X_low Z_high + z Z_high)), whose
+            // X_low Z_high part is CZ Rx_low CZ, and CZ CX = S_low CY
+            return {LocalLayer{IDENTITY2, fixedMatrix(GateType::SDG)}, LocalLayer{multiply(rxMatrix(2 * y), s), multiply(h, s)},
+                    LocalLayer{rxMatrix(-2 * x), multiply(rzMatrix(-2 * z), h)}, LocalLayer{}};
+    }
+}
+
+QGateSet synthesizeTwoQubitUnitary(const Matrix4 &matrix, const Qubit &low, const Qubit &high) {
+    auto kak = kakDecomposition(matrix);
+
+    // exp(i pi/2 PP) = i PP, so the coordinates are reduced into (-pi/4, pi/4]
+    const std::array<Matrix2, 3> paulis{fixedMatrix(GateType::X), fixedMatrix(GateType::Y), fixedMatrix(GateType::Z)};
+    std::array<fp, 3> coordinates{kak.a, kak.b, kak.c};
+    Matrix2 correction = IDENTITY2;
+    std::size_t nonzero = 0;
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        const fp turns = std::floor((coordinates[axis] + PI / 4 - COORDINATE_TOLERANCE) / (PI / 2));
+        coordinates[axis] -= turns * (PI / 2);
+        if (std::fmod(std::abs(turns), 2) > 0.5) {
+            correction = multiply(paulis[axis], correction);
+        }
+        if (std::abs(coordinates[axis]) > COORDINATE_TOLERANCE) {
+            ++nonzero;
+        }
+    }
+    const fp a = coordinates[0], b = coordinates[1], c = coordinates[2];
+
+    // Can(a, b, c) = (W (x) W) Can(x, y, z) (W (x) W)^dagger
+    const Matrix2 s = fixedMatrix(GateType::S);
+    const Matrix2 h = fixedMatrix(GateType::H);
+    Matrix2 frame = IDENTITY2;
+    std::size_t cx_count = 3;
+    fp x = a, y = b, z = c;
+
+    if (nonzero == 0) {
+        cx_count = 0;
+    } else if (nonzero == 1 && std::abs(a + b + c - PI / 4) < COORDINATE_TOLERANCE) {
+        cx_count = 1;
+        if (std::abs(b) > COORDINATE_TOLERANCE) {
+            frame = s;  // swaps XX and YY
+        } else if (std::abs(c) > COORDINATE_TOLERANCE) {
+            frame = h;  // swaps XX and ZZ
+        }
+    } else if (nonzero < 3) {
+        cx_count = 2;
+        if (std::abs(a) <= COORDINATE_TOLERANCE) {
+            frame = s;
+            x = b, y = a, z = c;
+        } else if (std::abs(c) <= COORDINATE_TOLERANCE) {
+            frame = multiply(h, s);  // XX -> YY, YY -> ZZ, ZZ -> XX
+            x = b, y = c, z = a;
+        }
+    }
+
+    auto layers = canonicalLayers(cx_count, x, y, z);
+    const Matrix2 frame_dagger = adjoint(frame);
+    auto &first = layers.front();
+    first.low = multiply(first.low, multiply(frame_dagger, multiply(correction, kak.before_low)));
+    first.high = multiply(first.high, multiply(frame_dagger, multiply(correction, kak.before_high)));
+    auto &last = layers.back();
+    last.low = multiply(kak.after_low, multiply(frame, last.low));
+    last.high = multiply(kak.after_high, multiply(frame, last.high));
+
+    QGateSet gates{};
+    for (std::size_t i = 0; i < layers.size(); ++i) {
+        if (i > 0) {
+            gates.push_back(std::make_unique<QGate>(GateType::CX, 2, ControlSet{low}, TargetSet{high}));
+        }
+        if (!isIdentityUpToPhase(layers[i].low)) {
+            gates.push_back(std::make_unique<QGate>(u3Gate(layers[i].low, low)));
+        }
+        if (!isIdentityUpToPhase(layers[i].high)) {
+            gates.push_back(std::make_unique<QGate>(u3Gate(layers[i].high, high)));
+        }
+    }
+    return gates;
+}
+
+struct TwoQubitBlock {
+    Qubit low = 0;
+    Qubit high = 0;
+    std::vector<std::size_t> gates{};
+    QGateSet replacement{};
+    gcount_t reduction = 0;
+};
+
+gcount_t consolidateTwoQubitBlocks(QCircuit &qc, std::size_t threads) {
+    auto &gates = qc.getGates();
+    const std::size_t n = gates.size();
+
+    Qubit max_qubit = 0;
+    for (auto &g : gates) {
+        for (auto q : g->getControls()) {
+            max_qubit = std::max(max_qubit, q);
+        }
+        for (auto q : g->getTargets()) {
+            max_qubit = std::max(max_qubit, q);
+        }
+    }
+
+    std::vector<TwoQubitBlock> blocks{};
+    std::vector<std::size_t> open(max_qubit + 1, NO_BLOCK);
+    std::vector<std::vector<std::size_t>> pending(max_qubit + 1);
+
+    auto close = [&](const Qubit &q) {
+        if (open[q] != NO_BLOCK) {
+            const auto &block = blocks[open[q]];
+            open[block.low] = open[block.high] = NO_BLOCK;
+        }
+    };
+
+    for (std::size_t i = 0; i < n; ++i) {
+        auto &g = *gates[i];
+
+        Matrix2 single{};
+        if (trySingleQubitMatrix(g, single)) {
+            const Qubit q = g.getTargets().front();
+            if (open[q] != NO_BLOCK) {
+                blocks[open[q]].gates.push_back(i);
+            } else {
+                pending[q].push_back(i);
+            }
+            continue;
+        }
+
+        QubitSet operands(g.getControls());
+        operands.insert(operands.end(), g.getTargets().begin(), g.getTargets().end());
+
+        Matrix4 pair{};
+        if (operands.size() == 2 && operands[0] != operands[1] &&
+            tryTwoQubitMatrix(g, std::min(operands[0], operands[1]), std::max(operands[0], operands[1]), pair)) {
+            const Qubit low = std::min(operands[0], operands[1]), high = std::max(operands[0], operands[1]);
+            if (open[low] != NO_BLOCK && open[low] == open[high]) {
+                blocks[open[low]].gates.push_back(i);
+                continue;
+            }
+            close(low);
+            close(high);
+
+            TwoQubitBlock block{};
+            block.low = low;
+            block.high = high;
+            std::merge(pending[low].begin(), pending[low].end(), pending[high].begin(), pending[high].end(), std::back_inserter(block.gates));
+            block.gates.push_back(i);
+            pending[low].clear();
+            pending[high].clear();
+
+            open[low] = open[high] = blocks.size();
+            blocks.push_back(std::move(block));
+            continue;
+        }
+
+        for (auto q : operands) {
+            close(q);
+            pending[q].clear();
+        }
+    }
+
+    if (blocks.empty()) {
+        return 0;
+    }
+
+    auto pool = ThreadPool(std::min(resolveThreads(threads), blocks.size()));
+    parallelFor(pool, blocks.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t b = begin; b < end; ++b) {
+            auto &block = blocks[b];
+            Matrix4 unitary{};
+            for (std::size_t k = 0; k < 4; ++k) {
+                unitary[5 * k] = Complex{1, 0};
+            }
+
+            gcount_t cost = 0;
+            for (auto i : block.gates) {
+                Matrix4 matrix{};
+                tryTwoQubitMatrix(*gates[i], block.low, block.high, matrix);
+                unitary = multiply(matrix, unitary);
+                cost += cxCost(*gates[i]);
+            }
+
+            auto replacement = synthesizeTwoQubitUnitary(unitary, block.low, block.high);
+            gcount_t resynthesized = 0;
+            for (auto &g : replacement) {
+                resynthesized += cxCost(*g);
+            }
+            if (resynthesized < cost) {
+                block.replacement = std::move(replacement);
+                block.reduction = cost - resynthesized;
+            }
+        }
+    });
+
+    // a block is emitted at its last gate, no gate outside the block touches its
+    // qubits between the first two-qubit gate and the last gate of the block
+    std::vector<std::size_t> owner(n, NO_BLOCK);
+    gcount_t reduction = 0;
+    for (std::size_t b = 0; b < blocks.size(); ++b) {
+        if (blocks[b].reduction == 0) {
+            continue;
+        }
+        for (auto i : blocks[b].gates) {
+            owner[i] = b;
+        }
+        reduction += blocks[b].reduction;
+    }
+
+    if (reduction == 0) {
+        return 0;
+    }
+
+    QGateSet consolidated{};
+    consolidated.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        if (owner[i] == NO_BLOCK) {
+            consolidated.push_back(std::move(gates[i]));
+        } else if (blocks[owner[i]].gates.back() == i) {
+            for (auto &g : blocks[owner[i]].replacement) {
+                consolidated.push_back(std::move(g));
+            }
+        }
+    }
+    gates = std::move(consolidated);
+    qc.updateProperties();
+
+    return reduction;
+}
+
+}  // namespace qcore
@@ -0,0 +1,316 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   CliffordSynthesis.cpp
+ *  @brief  Instance Description for the Tableau-based Clifford Resynthesis Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "optimize/CliffordSynthesis.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "optimize/BlockConsolidation.hpp"
+#include "optimize/InverseCancellation.hpp"
+#include "optimize/RotationMerging.hpp"
+
+namespace qcore {
+
+static constexpr std::size_t NO_REGION = std::numeric_limits<std::size_t>::max();
+
+// a reducing gate on tableau qubits, second operand unused for single-qubit gates
+struct CliffordOperation {
+    gate_t type;
+    std::size_t first;
+    std::size_t second;
+};
+
+// applies the operation to the tableau and records it
+static void reduce(CliffordTableau &tableau, std::vector<CliffordOperation> &operations, gate_t type, std::size_t first, std::size_t second = 0) {
+    switch (type) {
+        case GateType::H:
+            tableau.h(first);
+            break;
+        case GateType::S:
+            tableau.s(first);
+            break;
+        case GateType::X:
+            tableau.x(first);
+            break;
+        case GateType::Z:
+            tableau.z(first);
+            break;
+        case GateType::CX:
+            tableau.cx(first, second);
+            break;
+        default:
+            tableau.swap(first, second);
+            break;
+    }
+    operations.push_back({type, first, second});
+}
+
+QGateSet synthesizeClifford(CliffordTableau tableau, const QubitSet &qubits) {
+    const std::size_t n = tableau.size();
+    if (qubits.size() != n) {
+        throw QcoreException("[synthesizeClifford] qubits: " + std::to_string(qubits.size()) + " msg: expected " + std::to_string(n) + " qubits");
+    }
+
+    std::vector<CliffordOperation> operations{};
+    auto apply = [&](gate_t type, std::size_t first, std::size_t second = 0) { reduce(tableau, operations, type, first, second); };
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t stabilizer = n + i;
+
+        // make the X part of destabilizer i nonzero on qubit i
+        if (!tableau.xBit(i, i)) {
+            std::size_t k = i + 1;
+            while (k < n && !tableau.xBit(i, k)) {
+                ++k;
+            }
+            if (k < n) {
+                apply(GateType::SWAP, i, k);
+            } else {
+                k = i;
+                while (k < n && !tableau.zBit(i, k)) {
+                    ++k;
+                }
+                apply(GateType::H, k);
+                if (k != i) {
+                    apply(GateType::SWAP, i, k);
+                }
+            }
+        }
+
+        // clear destabilizer i outside of X on qubit i
+        for (std::size_t k = i + 1; k < n; ++k) {
+            if (tableau.xBit(i, k)) {
+                apply(GateType::CX, i, k);
+            }
+        }
+        bool z_part = false;
+        for (std::size_t k = i; k < n; ++k) {
+            z_part = z_part || tableau.zBit(i, k);
+        }
+        if (z_part) {
+            if (!tableau.zBit(i, i)) {
+                apply(GateType::S, i);
+            }
+            for (std::size_t k = i + 1; k < n; ++k) {
+                if (tableau.zBit(i, k)) {
+                    apply(GateType::CX, k, i);
+                }
+            }
+            apply(GateType::S, i);
+        }
+
+        // clear stabilizer i outside of Z on qubit i
+        for (std::size_t k = i + 1; k < n; ++k) {
+            if (tableau.zBit(stabilizer, k)) {
+                apply(GateType::CX, k, i);
+            }
+        }
+        bool x_part = false;
+        for (std::size_t k = i; k < n; ++k) {
+            x_part = x_part || tableau.xBit(stabilizer, k);
+        }
+        if (x_part) {
+            apply(GateType::H, i);
+            for (std::size_t k = i + 1; k < n; ++k) {
+                if (tableau.xBit(stabilizer, k)) {
+                    apply(GateType::CX, i, k);
+                }
+            }
+            if (tableau.zBit(stabilizer, i)) {
+                apply(GateType::S, i);
+            }
+            apply(GateType::H, i);
+        }
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        if (tableau.sign(i)) {
+            apply(GateType::Z, i);
+        }
+        if (tableau.sign(n + i)) {
+            apply(GateType::X, i);
+        }
+    }
+
+    // the operations reduce the tableau to the identity, so their inverse realizes it
+    QGateSet gates{};
+    gates.reserve(operations.size());
+    for (auto it = operations.rbegin(); it != operations.rend(); ++it) {
+        const Qubit first = qubits[it->first], second = qubits[it->second];
+        switch (it->type) {
+            case GateType::S:
+                gates.push_back(std::make_unique<QGate>(GateType::SDG, 1, TargetSet{first}));
+                break;
+            case GateType::CX:
+                gates.push_back(std::make_unique<QGate>(GateType::CX, 2, ControlSet{first}, TargetSet{second}));
+                break;
+            case GateType::SWAP:
+                gates.push_back(std::make_unique<QGate>(GateType::SWAP, 2, TargetSet{first, second}));
+                break;
+            default:
+                gates.push_back(std::make_unique<QGate>(it->type, 1, TargetSet{first}));
+                break;
+        }
+    }
+    return gates;
+}
+
+// (CNOT cost, gate count) of a gate sequence, compared lexicographically
+static std::pair<gcount_t, gcount_t> cliffordCost(QGateSet &gates) {
+    gcount_t cx = 0;
+    for (auto &g : gates) {
+        cx += cxCost(*g);
+    }
+    return {cx, gates.size()};
+}
+
+gcount_t resynthesizeCliffordRegions(QCircuit &qc) {
+    auto &gates = qc.getGates();
+    const std::size_t n = gates.size();
+
+    Qubit max_qubit = 0;
+    for (auto &g : gates) {
+        for (auto q : g->getControls()) {
+            max_qubit = std::max(max_qubit, q);
+        }
+        for (auto q : g->getTargets()) {
+            max_qubit = std::max(max_qubit, q);
+        }
+    }
+
+    // a qubit is blocked for the current region once a gate outside of it touched the qubit
+    std::vector<std::vector<std::size_t>> regions{};
+    std::vector<std::size_t> blocked(max_qubit + 1, NO_REGION);
+    std::vector<std::size_t> region{};
+
+    for (std::size_t i = 0; i < n; ++i) {
+        auto &g = *gates[i];
+        if (isTableauGate(g)) {
+            bool split = false;
+            for (auto *operands : {&g.getControls(), &g.getTargets()}) {
+                for (auto q : *operands) {
+                    split = split || blocked[q] == regions.size();
+                }
+            }
+            if (split) {
+                regions.push_back(std::move(region));
+                region.clear();
+            }
+            region.push_back(i);
+            continue;
+        }
+
+        for (auto *operands : {&g.getControls(), &g.getTargets()}) {
+            for (auto q : *operands) {
+                blocked[q] = regions.size();
+            }
+        }
+    }
+    regions.push_back(std::move(region));
+
+    std::vector<bool> removed(n, false);
+    std::vector<QGateSet> replacements(n);
+    gcount_t reduction = 0;
+    bool replaced = false;
+
+    for (auto &clifford : regions) {
+        if (clifford.size() < 3) {
+            continue;
+        }
+
+        QubitSet qubits{};
+        for (auto i : clifford) {
+            for (auto *operands : {&gates[i]->getControls(), &gates[i]->getTargets()}) {
+                qubits.insert(qubits.end(), operands->begin(), operands->end());
+            }
+        }
+        std::sort(qubits.begin(), qubits.end());
+        qubits.erase(std::unique(qubits.begin(), qubits.end()), qubits.end());
+        auto local = [&](const Qubit &q) { return static_cast<Qubit>(std::lower_bound(qubits.begin(), qubits.end(), q) - qubits.begin()); };
+
+        CliffordTableau tableau(qubits.size());
+        QGateSet original{};
+        for (auto i : clifford) {
+            auto &g = *gates[i];
+            ControlSet controls{};
+            TargetSet targets{};
+            for (auto q : g.getControls()) {
+                controls.push_back(local(q));
+            }
+            for (auto q : g.getTargets()) {
+                targets.push_back(local(q));
+            }
+            QGate mapped(g);
+            mapped.updateBits(controls, targets);
+            tableau.apply(mapped);
+            original.push_back(std::make_unique<QGate>(g));
+        }
+
+        QCircuit synthesized(max_qubit + 1, 0);
+        synthesized.getGates() = synthesizeClifford(tableau, qubits);
+        cancelInversePairs(synthesized);
+        mergeRotations(synthesized, true);
+        cancelInversePairs(synthesized);
+
+        const auto before = cliffordCost(original);
+        const auto after = cliffordCost(synthesized.getGates());
+        if (after >= before) {
+            continue;
+        }
+
+        // a replacement may trade extra single-qubit gates for fewer CNOTs
+        reduction += before.first - after.first;
+        replaced = true;
+        for (auto i : clifford) {
+            removed[i] = true;
+        }
+        moveQGates(replacements[clifford.front()], synthesized.getGates());
+    }
+
+    if (!replaced) {
+        return 0;
+    }
+
+    QGateSet result{};
+    result.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        moveQGates(result, replacements[i]);
+        if (!removed[i]) {
+            result.push_back(std::move(gates[i]));
+        }
+    }
+    gates = std::move(result);
+    qc.updateProperties();
+
+    return reduction;
+}
+
+}  // namespace qcore
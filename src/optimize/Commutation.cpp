@@ -0,0 +1,207 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   Commutation.cpp
+ *  @brief  Instance Description for Gate Commutation Rules and the Commutation-Aware Rescheduling Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "optimize/Commutation.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace qcore {
+
+// role of a qubit in a gate: 0 = control, 1 = target, -1 = not an operand
+static int roleOf(QGate &gate, const Qubit &qubit) {
+    auto &controls = gate.getControls();
+    if (std::find(controls.begin(), controls.end(), qubit) != controls.end()) {
+        return 0;
+    }
+    auto &targets = gate.getTargets();
+    return (std::find(targets.begin(), targets.end(), qubit) != targets.end()) ? 1 : -1;
+}
+
+bool commute(QGate &lhs, QGate &rhs) {
+    const bool classical = lhs.getIsClassical() || rhs.getIsClassical();
+    const auto mask = COMMUTATION_TABLE[lhs.getType()][rhs.getType()];
+
+    for (auto *operands : {&lhs.getControls(), &lhs.getTargets()}) {
+        for (auto q : *operands) {
+            const int rhs_role = roleOf(rhs, q);
+            if (rhs_role < 0) {
+                continue;
+            }
+            const int lhs_role = (operands == &lhs.getControls()) ? 0 : 1;
+            if (classical || (mask & (1u << (2 * lhs_role + rhs_role))) == 0) {
+                return false;
+            }
+        }
+    }
+
+    for (auto c : lhs.getCbits()) {
+        auto &cbits = rhs.getCbits();
+        if (std::find(cbits.begin(), cbits.end(), c) != cbits.end()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static Qubit maxQubit(QGateSet &gates) {
+    Qubit max_qubit = 0;
+    for (auto &g : gates) {
+        for (auto q : g->getControls()) {
+            max_qubit = std::max(max_qubit, q);
+        }
+        for (auto q : g->getTargets()) {
+            max_qubit = std::max(max_qubit, q);
+        }
+    }
+    return max_qubit;
+}
+
+depth_t layeredDepth(QCircuit &qc) {
+    auto &gates = qc.getGates();
+    std::vector<depth_t> top(maxQubit(gates) + 1, 0);
+    depth_t depth = 0;
+
+    for (auto &g : gates) {
+        depth_t layer = 0;
+        for (auto *operands : {&g->getControls(), &g->getTargets()}) {
+            for (auto q : *operands) {
+                layer = std::max(layer, top[q]);
+            }
+        }
+        layer += 1;
+        for (auto *operands : {&g->getControls(), &g->getTargets()}) {
+            for (auto q : *operands) {
+                top[q] = layer;
+            }
+        }
+        depth = std::max(depth, layer);
+    }
+
+    return depth;
+}
+
+// a scheduled gate on a qubit
+struct Placement {
+    depth_t layer = 0;
+    std::size_t gate = 0;
+};
+
+depth_t reorderCommutingGates(QCircuit &qc, std::size_t lookahead) {
+    auto &gates = qc.getGates();
+    const std::size_t n = gates.size();
+    const depth_t depth = layeredDepth(qc);
+
+    // per qubit the scheduled gates, sorted by layer
+    std::vector<std::vector<Placement>> scheduled(maxQubit(gates) + 1);
+    std::vector<depth_t> layers(n, 0);
+    depth_t fence = 0;
+    depth_t classical_fence = 0;
+    depth_t highest = 0;
+
+    auto occupied = [&](const Qubit &q, depth_t layer) {
+        auto &placements = scheduled[q];
+        auto it = std::lower_bound(placements.begin(), placements.end(), layer,
+                                   [](const Placement &placement, depth_t value) { return placement.layer < value; });
+        return it != placements.end() && it->layer == layer;
+    };
+
+    for (std::size_t i = 0; i < n; ++i) {
+        auto &g = *gates[i];
+        QubitSet operands(g.getControls());
+        operands.insert(operands.end(), g.getTargets().begin(), g.getTargets().end());
+
+        // gates without operands act as a fence for everything after them
+        if (operands.empty()) {
+            layers[i] = fence = highest = highest + 1;
+            continue;
+        }
+
+        const bool classical = g.getIsClassical() || !g.getCbits().empty();
+        depth_t barrier = classical ? std::max(fence, classical_fence) : fence;
+
+        for (auto q : operands) {
+            std::size_t inspected = 0;
+            auto &placements = scheduled[q];
+            for (auto it = placements.rbegin(); it != placements.rend() && it->layer > barrier; ++it) {
+                if (inspected == lookahead || !commute(g, *gates[it->gate])) {
+                    barrier = it->layer;
+                    break;
+                }
+                ++inspected;
+            }
+        }
+
+        depth_t layer = barrier + 1;
+        while (std::any_of(operands.begin(), operands.end(), [&](const Qubit &q) { return occupied(q, layer); })) {
+            ++layer;
+        }
+
+        for (auto q : operands) {
+            auto &placements = scheduled[q];
+            auto it = std::upper_bound(placements.begin(), placements.end(), layer,
+                                       [](depth_t value, const Placement &placement) { return value < placement.layer; });
+            placements.insert(it, Placement{layer, i});
+        }
+
+        layers[i] = layer;
+        highest = std::max(highest, layer);
+        if (classical) {
+            classical_fence = std::max(classical_fence, layer);
+        }
+    }
+
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) { return layers[lhs] < layers[rhs]; });
+
+    QGateSet rescheduled{};
+    rescheduled.reserve(n);
+    for (auto i : order) {
+        rescheduled.push_back(std::move(gates[i]));
+    }
+    gates = std::move(rescheduled);
+    qc.updateProperties();
+
+    // the classical fence may serialize gates the original order ran side by side
+    const depth_t reordered = layeredDepth(qc);
+    if (reordered > depth) {
+        QGateSet original(n);
+        for (std::size_t k = 0; k < n; ++k) {
+            original[order[k]] = std::move(gates[k]);
+        }
+        gates = std::move(original);
+        qc.updateProperties();
+        return 0;
+    }
+    return depth - reordered;
+}
+
+}  // namespace qcore
@@ -0,0 +1,171 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   InverseCancellation.cpp
+ *  @brief  Instance Description for the Inverse Gate Pair Cancellation Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "optimize/InverseCancellation.hpp"
+
+#include <limits>
+
+namespace qcore {
+
+static constexpr std::size_t NO_GATE = std::numeric_limits<std::size_t>::max();
+
+// gates that may take part in a cancellation at all
+static bool isCancellable(QGate &g) {
+    if (g.getIsClassical() || !g.getAngle().empty()) {
+        return false;  // parameterized gates are left to rotation merging
+    }
+
+    switch (g.getType()) {
+        case GateType::NONE:
+        case GateType::ISWAP:  // not self inverse although inverseGateType says so
+        case GateType::RC3X:   // its relative phases of +-i do not cancel either
+        case GateType::RESET:
+        case GateType::MEASURE:
+        case GateType::IF:
+        case GateType::BARRIER:
+            return false;
+        default:
+            return true;
+    }
+}
+
+// controls of these gates can be permuted freely
+static bool hasSymmetricControls(const gate_t &gateType) {
+    switch (gateType) {
+        case GateType::CCX:
+        case GateType::MCX:
+        case GateType::CSWAP:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool sameSet(QubitSet lhs, QubitSet rhs) {
+    std::sort(lhs.begin(), lhs.end());
+    std::sort(rhs.begin(), rhs.end());
+    return lhs == rhs;
+}
+
+bool isInversePair(QGate &first, QGate &second) {
+    if (!isCancellable(first) || !isCancellable(second)) {
+        return false;
+    }
+
+    if (inverseGateType(first.getType()) != second.getType()) {
+        return false;
+    }
+
+    if (first.getCbits() != second.getCbits()) {
+        return false;
+    }
+
+    if (first.getType() == GateType::SWAP || first.getType() == GateType::CSWAP) {
+        if (!sameSet(first.getTargets(), second.getTargets())) {
+            return false;
+        }
+    } else if (first.getTargets() != second.getTargets()) {
+        return false;
+    }
+
+    if (hasSymmetricControls(first.getType())) {
+        return sameSet(first.getControls(), second.getControls());
+    }
+    return first.getControls() == second.getControls();
+}
+
+gcount_t cancelInversePairs(QCircuit &qc) {
+    auto &gates = qc.getGates();
+    const std::size_t n = gates.size();
+
+    Qubit max_qubit = 0;
+    for (auto &g : gates) {
+        for (auto q : g->getControls()) {
+            max_qubit = std::max(max_qubit, q);
+        }
+        for (auto q : g->getTargets()) {
+            max_qubit = std::max(max_qubit, q);
+        }
+    }
+
+    // last surviving gate per qubit, and for every kept gate the value the table
+    // held for each of its operands before the gate was placed (for roll back)
+    std::vector<std::size_t> last(max_qubit + 1, NO_GATE);
+    std::vector<std::size_t> offset(n, 0);
+    std::vector<std::size_t> previous{};
+    previous.reserve(2 * n);
+
+    gcount_t removed = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        auto &g = *gates[i];
+
+        std::size_t candidate = NO_GATE;
+        bool adjacent = isCancellable(g);
+        bool first = true;
+        for (auto *operands : {&g.getControls(), &g.getTargets()}) {
+            for (auto q : *operands) {
+                if (first) {
+                    candidate = last[q];
+                    first = false;
+                } else if (last[q] != candidate) {
+                    adjacent = false;
+                }
+            }
+        }
+
+        if (adjacent && candidate != NO_GATE && isInversePair(*gates[candidate], g)) {
+            auto &p = *gates[candidate];
+            std::size_t k = offset[candidate];
+            for (auto *operands : {&p.getControls(), &p.getTargets()}) {
+                for (auto q : *operands) {
+                    last[q] = previous[k++];
+                }
+            }
+
+            gates[candidate].reset();
+            gates[i].reset();
+            removed += 2;
+            continue;
+        }
+
+        offset[i] = previous.size();
+        for (auto *operands : {&g.getControls(), &g.getTargets()}) {
+            for (auto q : *operands) {
+                previous.push_back(last[q]);
+                last[q] = i;
+            }
+        }
+    }
+
+    removeEmptyQGates(gates);
+    qc.updateProperties();
+
+    return removed;
+}
+
+}  // namespace qcore
@@ -0,0 +1,249 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   LinearSynthesis.cpp
+ *  @brief  Instance Description for GF(2) Matrices and the CNOT Resynthesis Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "optimize/LinearSynthesis.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace qcore {
+
+static constexpr std::size_t NO_ROW = std::numeric_limits<std::size_t>::max();
+
+// section patterns are looked up in a table of 2^section entries
+static constexpr std::size_t MAX_SECTION = 16;
+
+GF2Matrix::GF2Matrix(std::size_t dimension) : dimension(dimension), words((dimension + 63) / 64), bits(dimension * ((dimension + 63) / 64), 0) {
+    for (std::size_t i = 0; i < dimension; ++i) {
+        flip(i, i);
+    }
+}
+
+std::uint64_t GF2Matrix::bitsOf(std::size_t r, std::size_t begin, std::size_t count) const {
+    const std::uint64_t *words = row(r);
+    const std::size_t word = begin >> 6, offset = begin & 63;
+    std::uint64_t value = words[word] >> offset;
+    if (offset != 0 && offset + count > 64 && word + 1 < this->words) {
+        value |= words[word + 1] << (64 - offset);
+    }
+    return (count < 64) ? (value & ((std::uint64_t{1} << count) - 1)) : value;
+}
+
+GF2Matrix GF2Matrix::transpose() const {
+    GF2Matrix result(this->dimension);
+    std::fill(result.bits.begin(), result.bits.end(), 0);
+    for (std::size_t r = 0; r < this->dimension; ++r) {
+        for (std::size_t c = 0; c < this->dimension; ++c) {
+            if (get(r, c)) {
+                result.flip(c, r);
+            }
+        }
+    }
+    return result;
+}
+
+bool GF2Matrix::operator==(const GF2Matrix &other) const {
+    return this->dimension == other.dimension && this->bits == other.bits;
+}
+
+// reduces the matrix to upper triangular form, recording every row addition as (source, destination)
+static void lowerSynthesis(GF2Matrix &matrix, std::size_t section, std::vector<CNOT> &operations) {
+    const std::size_t n = matrix.size();
+    std::vector<std::size_t> first(std::size_t{1} << section, NO_ROW);
+
+    for (std::size_t start = 0; start < n; start += section) {
+        const std::size_t end = std::min(start + section, n);
+        const std::size_t width = end - start;
+
+        // rows with a repeated section pattern are cleared by one addition
+        std::fill(first.begin(), first.begin() + (std::size_t{1} << width), NO_ROW);
+        for (std::size_t r = start; r < n; ++r) {
+            const auto pattern = matrix.bitsOf(r, start, width);
+            if (pattern == 0) {
+                continue;
+            }
+            if (first[pattern] == NO_ROW) {
+                first[pattern] = r;
+            } else {
+                matrix.addRow(first[pattern], r);
+                operations.emplace_back(first[pattern], r);
+            }
+        }
+
+        // Gaussian elimination of the remaining entries below the diagonal
+        for (std::size_t c = start; c < end; ++c) {
+            bool diagonal = matrix.get(c, c);
+            for (std::size_t r = c + 1; r < n; ++r) {
+                if (!matrix.get(r, c)) {
+                    continue;
+                }
+                if (!diagonal) {
+                    matrix.addRow(r, c);
+                    operations.emplace_back(r, c);
+                    diagonal = true;
+                }
+                matrix.addRow(c, r);
+                operations.emplace_back(c, r);
+            }
+            if (!diagonal) {
+                throw QcoreException("[pmhSynthesis] column: " + std::to_string(c) + " msg: matrix is singular");
+            }
+        }
+    }
+}
+
+std::vector<CNOT> pmhSynthesis(GF2Matrix matrix, std::size_t section) {
+    const std::size_t n = matrix.size();
+    if (section == 0) {
+        section = 1;
+        while ((std::size_t{2} << section) <= n) {
+            ++section;  // floor(log2(n))
+        }
+    }
+    section = std::min(section, MAX_SECTION);
+
+    std::vector<CNOT> lower{};
+    lowerSynthesis(matrix, section, lower);
+
+    auto upper_matrix = matrix.transpose();
+    std::vector<CNOT> upper{};
+    lowerSynthesis(upper_matrix, section, upper);
+
+    // A = E^-1 (F^-1)^T: the additions on the transpose run first with swapped roles,
+    // then the additions of the first pass in reverse order
+    std::vector<CNOT> circuit{};
+    circuit.reserve(lower.size() + upper.size());
+    for (const auto &operation : upper) {
+        circuit.emplace_back(operation.second, operation.first);
+    }
+    for (auto it = lower.rbegin(); it != lower.rend(); ++it) {
+        circuit.push_back(*it);
+    }
+    return circuit;
+}
+
+static bool isPlainCX(QGate &gate) {
+    return gate.getType() == GateType::CX && !gate.getIsClassical() && gate.getControls().size() == 1 && gate.getTargets().size() == 1;
+}
+
+gcount_t resynthesizeCNOTRegions(QCircuit &qc) {
+    auto &gates = qc.getGates();
+    const std::size_t n = gates.size();
+
+    Qubit max_qubit = 0;
+    for (auto &g : gates) {
+        for (auto q : g->getControls()) {
+            max_qubit = std::max(max_qubit, q);
+        }
+        for (auto q : g->getTargets()) {
+            max_qubit = std::max(max_qubit, q);
+        }
+    }
+
+    // a qubit is blocked for the current region once a gate outside of it touched the qubit
+    std::vector<std::vector<std::size_t>> regions{};
+    std::vector<std::size_t> blocked(max_qubit + 1, NO_ROW);
+    std::vector<std::size_t> region{};
+
+    for (std::size_t i = 0; i < n; ++i) {
+        auto &g = *gates[i];
+        if (isPlainCX(g)) {
+            const Qubit c = g.getControls().front(), t = g.getTargets().front();
+            if (blocked[c] == regions.size() || blocked[t] == regions.size()) {
+                regions.push_back(std::move(region));
+                region.clear();
+            }
+            region.push_back(i);
+            continue;
+        }
+
+        for (auto *operands : {&g.getControls(), &g.getTargets()}) {
+            for (auto q : *operands) {
+                blocked[q] = regions.size();
+            }
+        }
+    }
+    regions.push_back(std::move(region));
+
+    std::vector<bool> removed(n, false);
+    std::vector<QGateSet> replacements(n);
+    gcount_t reduction = 0;
+
+    for (auto &cx : regions) {
+        if (cx.size() < 3) {
+            continue;  // two CNOTs on distinct pairs are already optimal
+        }
+
+        QubitSet qubits{};
+        for (auto i : cx) {
+            qubits.push_back(gates[i]->getControls().front());
+            qubits.push_back(gates[i]->getTargets().front());
+        }
+        std::sort(qubits.begin(), qubits.end());
+        qubits.erase(std::unique(qubits.begin(), qubits.end()), qubits.end());
+        auto local = [&](const Qubit &q) { return static_cast<std::size_t>(std::lower_bound(qubits.begin(), qubits.end(), q) - qubits.begin()); };
+
+        GF2Matrix parity(qubits.size());
+        for (auto i : cx) {
+            parity.addRow(local(gates[i]->getControls().front()), local(gates[i]->getTargets().front()));
+        }
+
+        auto circuit = pmhSynthesis(parity);
+        if (circuit.size() >= cx.size()) {
+            continue;
+        }
+
+        reduction += cx.size() - circuit.size();
+        for (auto i : cx) {
+            removed[i] = true;
+        }
+        for (const auto &operation : circuit) {
+            replacements[cx.front()].push_back(std::make_unique<QGate>(GateType::CX, 2, ControlSet{qubits[operation.first]}, TargetSet{qubits[operation.second]}));
+        }
+    }
+
+    if (reduction == 0) {
+        return 0;
+    }
+
+    QGateSet result{};
+    result.reserve(n - reduction);
+    for (std::size_t i = 0; i < n; ++i) {
+        moveQGates(result, replacements[i]);
+        if (!removed[i]) {
+            result.push_back(std::move(gates[i]));
+        }
+    }
+    gates = std::move(result);
+    qc.updateProperties();
+
+    return reduction;
+}
+
+}  // namespace qcore
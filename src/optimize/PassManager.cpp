@@ -0,0 +1,222 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   PassManager.cpp
+ *  @brief  Instance Description for the Pass Manager for Circuit Compilation Pipelines
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "optimize/PassManager.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+#include "decompose/BasisTranslation.hpp"
+#include "decompose/Decompose.hpp"
+#include "decompose/RotationSynthesis.hpp"
+#include "optimize/BlockConsolidation.hpp"
+#include "optimize/CliffordSynthesis.hpp"
+#include "optimize/Commutation.hpp"
+#include "optimize/InverseCancellation.hpp"
+#include "optimize/LinearSynthesis.hpp"
+#include "optimize/PhaseFolding.hpp"
+#include "optimize/RotationMerging.hpp"
+#include "optimize/SingleQubitFusion.hpp"
+#include "optimize/TemplateRewriting.hpp"
+#include "optimize/ZXSimplification.hpp"
+#include "parallel/ThreadPool.hpp"
+
+namespace qcore {
+
+using Clock = std::chrono::steady_clock;
+
+static fp secondsSince(const Clock::time_point &start) {
+    return std::chrono::duration<fp>(Clock::now() - start).count();
+}
+
+std::size_t peakResidentMemory() {
+#if defined(__APPLE__)
+    struct rusage usage {};
+    return (getrusage(RUSAGE_SELF, &usage) == 0) ? static_cast<std::size_t>(usage.ru_maxrss) : 0;
+#elif defined(__unix__)
+    struct rusage usage {};
+    return (getrusage(RUSAGE_SELF, &usage) == 0) ? static_cast<std::size_t>(usage.ru_maxrss) * 1024 : 0;
+#else
+    return 0;
+#endif
+}
+
+std::size_t residentMemory() {
+#if defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    std::size_t pages = 0, resident = 0;
+    if (statm >> pages >> resident) {
+        return resident * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return 0;
+}
+
+const std::map<std::string, pass_t> &builtinPasses() {
+    static const std::map<std::string, pass_t> passes{
+        {"cancel_inverse_pairs", [](QCircuit &qc) { return cancelInversePairs(qc); }},
+        {"merge_rotations", [](QCircuit &qc) { return mergeRotations(qc); }},
+        {"merge_rotations_clifford_t", [](QCircuit &qc) { return mergeRotations(qc, true); }},
+        {"fuse_single_qubit_runs", [](QCircuit &qc) { return fuseSingleQubitRuns(qc); }},
+        {"consolidate_two_qubit_blocks", [](QCircuit &qc) { return consolidateTwoQubitBlocks(qc, 1); }},
+        {"fold_phase_polynomial", [](QCircuit &qc) { return foldPhasePolynomial(qc); }},
+        {"reorder_commuting_gates", [](QCircuit &qc) { return reorderCommutingGates(qc); }},
+        {"resynthesize_cnot_regions", [](QCircuit &qc) { return resynthesizeCNOTRegions(qc); }},
+        {"resynthesize_clifford_regions", [](QCircuit &qc) { return resynthesizeCliffordRegions(qc); }},
+        {"zx_simplify", [](QCircuit &qc) { return simplifyWithZX(qc); }},
+        {"apply_templates", [](QCircuit &qc) { return applyTemplates(qc); }},
+        {"decompose_clifford_t", [](QCircuit &qc) { return decompose(qc, DecompositionBasis::CLIFFORD_T, 1); }},
+        {"translate_clifford_t", [](QCircuit &qc) { return translate(qc, DecompositionBasis::CLIFFORD_T); }},
+        {"translate_rz_sx_x_cx", [](QCircuit &qc) { return translate(qc, DecompositionBasis::RZ_SX_X_CX); }},
+        {"translate_u3_cx", [](QCircuit &qc) { return translate(qc, DecompositionBasis::U3_CX); }},
+        {"synthesize_rotations", [](QCircuit &qc) { return synthesizeRotations(qc, DEFAULT_SYNTHESIS_EPSILON, 1); }}};
+    return passes;
+}
+
+PassManager::PassManager(bool fixed_point, std::size_t max_iterations)
+    : fixed_point(fixed_point), max_iterations(std::max<std::size_t>(max_iterations, 1)) {}
+
+PassManager &PassManager::addPass(const std::string &name, pass_t pass) {
+    if (!pass) {
+        throw QcoreException("[PassManager::addPass] pass: " + name + " msg: empty pass");
+    }
+    this->passes.emplace_back(name, std::move(pass));
+    return *this;
+}
+
+PassManager &PassManager::addPass(const std::string &name) {
+    auto pass = builtinPasses().find(name);
+    if (pass == builtinPasses().end()) {
+        throw QcoreException("[PassManager::addPass] pass: " + name + " msg: unknown built-in pass");
+    }
+    return addPass(name, pass->second);
+}
+
+PipelineReport PassManager::run(QCircuit &qc) const {
+    PipelineReport report{};
+    const auto start = Clock::now();
+    report.initial_gates = qc.getGates().size();
+
+    gcount_t gates = report.initial_gates;
+    for (std::size_t iteration = 1; iteration <= this->max_iterations; ++iteration) {
+        const gcount_t iteration_start = gates;
+
+        for (const auto &pass : this->passes) {
+            PassRecord record{};
+            record.name = pass.first;
+            record.iteration = iteration;
+            record.gates_before = gates;
+
+            const std::size_t peak_before = peakResidentMemory();
+            record.memory_before = residentMemory();
+            const auto pass_start = Clock::now();
+            pass.second(qc);
+            record.seconds = secondsSince(pass_start);
+            record.memory_after = residentMemory();
+            const std::size_t peak_after = peakResidentMemory();
+            record.peak_memory = std::max({record.memory_before, record.memory_after, (peak_after > peak_before) ? peak_after : 0});
+
+            gates = qc.getGates().size();
+            record.gates_after = gates;
+            report.passes.push_back(std::move(record));
+        }
+
+        report.iterations = iteration;
+        if (!this->fixed_point || gates >= iteration_start) {
+            break;
+        }
+    }
+
+    report.final_gates = gates;
+    report.seconds = secondsSince(start);
+    return report;
+}
+
+std::vector<PipelineReport> PassManager::run(std::vector<std::unique_ptr<QCircuit>> &circuits, std::size_t threads) const {
+    std::vector<PipelineReport> reports(circuits.size());
+    if (circuits.empty()) {
+        return reports;
+    }
+
+    auto pool = ThreadPool(std::min(resolveThreads(threads), circuits.size()));
+    parallelFor(pool, circuits.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            if (!circuits[i]) {
+                reports[i].valid = false;
+                reports[i].error = "no circuit";
+                continue;
+            }
+            try {
+                reports[i] = run(*circuits[i]);
+            } catch (const std::exception &ex) {
+                reports[i] = PipelineReport{};
+                reports[i].valid = false;
+                reports[i].error = ex.what();
+            }
+        }
+    });
+
+    return reports;
+}
+
+nlohmann::json toJSON(const PipelineReport &report) {
+    nlohmann::json result{};
+
+    if (!report.valid) {
+        result["Error"] = report.error;
+        return result;
+    }
+
+    result["Iterations"] = report.iterations;
+    result["InitialGateCount"] = report.initial_gates;
+    result["FinalGateCount"] = report.final_gates;
+    result["WallTime"] = report.seconds;
+
+    nlohmann::json passes = nlohmann::json::array();
+    for (const auto &record : report.passes) {
+        passes.push_back({{"Name", record.name},
+                          {"Iteration", record.iteration},
+                          {"WallTime", record.seconds},
+                          {"PeakMemory", record.peak_memory},
+                          {"MemoryDelta", record.memoryDelta()},
+                          {"GateDelta", record.gateDelta()}});
+    }
+    result["Passes"] = passes;
+
+    return result;
+}
+
+}  // namespace qcore
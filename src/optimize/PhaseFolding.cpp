@@ -0,0 +1,263 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   PhaseFolding.cpp
+ *  @brief  Instance Description for the Phase Polynomial T-Count Optimization Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "optimize/PhaseFolding.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <unordered_map>
+
+#include "Angle.hpp"
+#include "optimize/Commutation.hpp"
+#include "optimize/RotationMerging.hpp"
+
+namespace qcore {
+
+static constexpr std::size_t NO_GATE = std::numeric_limits<std::size_t>::max();
+
+gcount_t tCount(QCircuit &qc) {
+    gcount_t count = 0;
+    for (auto &g : qc.getGates()) {
+        if (g->getType() == GateType::T || g->getType() == GateType::TDG) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+// sorted set of path variables whose sum (mod 2) a qubit holds
+using Parity = std::vector<std::uint32_t>;
+
+struct ParityHash {
+    std::size_t operator()(const Parity &parity) const {
+        std::size_t hash = 14695981039346656037ULL;
+        for (auto variable : parity) {
+            hash = (hash ^ variable) * 1099511628211ULL;
+        }
+        return hash;
+    }
+};
+
+static Parity parityXor(const Parity &lhs, const Parity &rhs) {
+    Parity result{};
+    result.reserve(lhs.size() + rhs.size());
+    std::set_symmetric_difference(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(result));
+    return result;
+}
+
+static bool isDiagonal(const gate_t &gateType) {
+    switch (gateType) {
+        case GateType::I:
+        case GateType::Z:
+        case GateType::CZ:
+        case GateType::S:
+        case GateType::CS:
+        case GateType::SDG:
+        case GateType::CSDG:
+        case GateType::T:
+        case GateType::CT:
+        case GateType::TDG:
+        case GateType::CTDG:
+        case GateType::P:
+        case GateType::CP:
+        case GateType::RZ:
+        case GateType::CRZ:
+        case GateType::RZZ:
+        case GateType::U1:
+        case GateType::CU1:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// angle of an unconditioned single-qubit phase gate
+static bool asPhase(QGate &gate, fp &angle) {
+    if (gate.getIsClassical() || !gate.getControls().empty() || gate.getTargets().size() != 1) {
+        return false;
+    }
+
+    switch (gate.getType()) {
+        case GateType::Z:
+            angle = PI;
+            return true;
+        case GateType::S:
+            angle = PI / 2;
+            return true;
+        case GateType::SDG:
+            angle = -PI / 2;
+            return true;
+        case GateType::T:
+            angle = PI / 4;
+            return true;
+        case GateType::TDG:
+            angle = -PI / 4;
+            return true;
+        case GateType::RZ:
+        case GateType::P:
+        case GateType::U1:
+            return gate.getAngle().size() == 1 && tryAngleValue(gate.getAngle().begin()->second, angle);
+        default:
+            return false;
+    }
+}
+
+// phase terms are stored relative to the parity without its affine constant
+struct PhaseTerm {
+    std::size_t leader = NO_GATE;
+    Qubit qubit = 0;
+    bool negated = false;
+    fp angle = 0;
+    gcount_t count = 0;
+};
+
+gcount_t foldPhasePolynomial(QCircuit &qc) {
+    auto &gates = qc.getGates();
+    const std::size_t n = gates.size();
+
+    Qubit max_qubit = 0;
+    for (auto &g : gates) {
+        for (auto q : g->getControls()) {
+            max_qubit = std::max(max_qubit, q);
+        }
+        for (auto q : g->getTargets()) {
+            max_qubit = std::max(max_qubit, q);
+        }
+    }
+
+    std::vector<Parity> parities(max_qubit + 1);
+    std::vector<bool> constants(max_qubit + 1, false);
+    std::uint32_t variables = 0;
+    for (auto &parity : parities) {
+        parity = Parity{variables++};
+    }
+
+    std::unordered_map<Parity, std::size_t, ParityHash> polynomial{};
+    std::vector<PhaseTerm> terms{};
+    std::vector<bool> removed(n, false);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        auto &g = *gates[i];
+        auto &controls = g.getControls();
+        auto &targets = g.getTargets();
+
+        fp angle = 0;
+        if (asPhase(g, angle)) {
+            const Qubit q = targets.front();
+            const fp contribution = constants[q] ? -angle : angle;
+            auto term = polynomial.find(parities[q]);
+            if (term == polynomial.end()) {
+                polynomial.emplace(parities[q], terms.size());
+                terms.push_back(PhaseTerm{i, q, constants[q], contribution, 1});
+            } else {
+                auto &phase = terms[term->second];
+                phase.angle += contribution;
+                phase.count += 1;
+                removed[i] = true;
+            }
+            continue;
+        }
+
+        if (!g.getIsClassical()) {
+            if (g.getType() == GateType::CX && controls.size() == 1 && targets.size() == 1) {
+                parities[targets[0]] = parityXor(parities[targets[0]], parities[controls[0]]);
+                constants[targets[0]] = constants[targets[0]] ^ constants[controls[0]];
+                continue;
+            }
+            if (g.getType() == GateType::X && controls.empty() && targets.size() == 1) {
+                constants[targets[0]] = !constants[targets[0]];
+                continue;
+            }
+            if (g.getType() == GateType::SWAP && controls.empty() && targets.size() == 2) {
+                std::swap(parities[targets[0]], parities[targets[1]]);
+                bool constant = constants[targets[0]];
+                constants[targets[0]] = constants[targets[1]];
+                constants[targets[1]] = constant;
+                continue;
+            }
+        }
+
+        // diagonal gates keep the basis state, pure controls keep their value
+        if (isDiagonal(g.getType())) {
+            continue;
+        }
+        for (auto q : targets) {
+            parities[q] = Parity{variables++};
+            constants[q] = false;
+        }
+        if (controlAxis(g.getType()) != RotationAxis::AXISZ) {
+            for (auto q : controls) {
+                parities[q] = Parity{variables++};
+                constants[q] = false;
+            }
+        }
+    }
+
+    std::unordered_map<std::size_t, QGateSet> replaced{};
+    for (auto &term : terms) {
+        if (term.count < 2) {
+            continue;  // a lone phase gate keeps its original form
+        }
+
+        auto &leader = *gates[term.leader];
+        fp angle = normalizeAngle(term.negated ? -term.angle : term.angle);
+        std::int64_t k = 0;
+        if (angle == 0) {
+            removed[term.leader] = true;
+        } else if (isAngleMultiple(angle, PI / 4, k)) {
+            replaced[term.leader] = phaseGates(k, term.qubit);
+        } else if (leader.getType() != GateType::RZ && leader.getType() != GateType::P && leader.getType() != GateType::U1) {
+            QGateSet rotation{};
+            rotation.push_back(std::make_unique<QGate>(GateType::RZ, 1, RotationMap{{RotationType::THETA, angleString(angle)}}, TargetSet{term.qubit}));
+            replaced[term.leader] = std::move(rotation);
+        } else {
+            leader.getAngle().begin()->second = angleString(angle);
+        }
+    }
+
+    auto result = QGateSet{};
+    result.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        auto replacement = replaced.find(i);
+        if (replacement != replaced.end()) {
+            moveQGates(result, replacement->second);
+        } else if (!removed[i]) {
+            result.push_back(std::move(gates[i]));
+        }
+    }
+
+    const gcount_t reduction = n - result.size();
+    gates = std::move(result);
+    qc.updateProperties();
+
+    return reduction;
+}
+
+}  // namespace qcore
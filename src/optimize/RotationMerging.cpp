@@ -0,0 +1,248 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   RotationMerging.cpp
+ *  @brief  Instance Description for the Rotation Merging and Constant Folding Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "optimize/RotationMerging.hpp"
+
+#include <limits>
+#include <unordered_map>
+
+#include "Angle.hpp"
+
+namespace qcore {
+
+static constexpr std::size_t NO_GATE = std::numeric_limits<std::size_t>::max();
+
+RotationAxis commutingAxis(QGate &gate, const Qubit &qubit) {
+    if (gate.getIsClassical()) {
+        return RotationAxis::AXISNONE;
+    }
+
+    auto &controls = gate.getControls();
+    if (std::find(controls.begin(), controls.end(), qubit) != controls.end()) {
+        return controlAxis(gate.getType());
+    }
+
+    auto &targets = gate.getTargets();
+    if (std::find(targets.begin(), targets.end(), qubit) == targets.end()) {
+        return RotationAxis::AXISNONE;
+    }
+
+    return targetAxis(gate.getType());
+}
+
+// a single-qubit rotation that can take part in merging
+struct Rotation {
+    RotationAxis axis = RotationAxis::AXISNONE;
+    fp angle = 0;
+    bool parameterized = false;
+};
+
+static bool asRotation(QGate &gate, Rotation &rotation) {
+    if (gate.getIsClassical() || !gate.getControls().empty() || gate.getTargets().size() != 1) {
+        return false;
+    }
+
+    switch (gate.getType()) {
+        case GateType::RZ:
+        case GateType::P:
+        case GateType::U1:
+        case GateType::RX:
+        case GateType::RY: {
+            if (gate.getAngle().size() != 1 || !tryAngleValue(gate.getAngle().begin()->second, rotation.angle)) {
+                return false;  // symbolic or malformed parameters stay untouched
+            }
+            rotation.parameterized = true;
+            rotation.axis = (gate.getType() == GateType::RX)   ? RotationAxis::AXISX
+                            : (gate.getType() == GateType::RY) ? RotationAxis::AXISY
+                                                               : RotationAxis::AXISZ;
+            return true;
+        }
+        case GateType::Z:
+            rotation = {RotationAxis::AXISZ, PI, false};
+            return true;
+        case GateType::S:
+            rotation = {RotationAxis::AXISZ, PI / 2, false};
+            return true;
+        case GateType::SDG:
+            rotation = {RotationAxis::AXISZ, -PI / 2, false};
+            return true;
+        case GateType::T:
+            rotation = {RotationAxis::AXISZ, PI / 4, false};
+            return true;
+        case GateType::TDG:
+            rotation = {RotationAxis::AXISZ, -PI / 4, false};
+            return true;
+        case GateType::X:
+            rotation = {RotationAxis::AXISX, PI, false};
+            return true;
+        case GateType::SX:
+        case GateType::V:
+            rotation = {RotationAxis::AXISX, PI / 2, false};
+            return true;
+        case GateType::SXDG:
+        case GateType::VDG:
+            rotation = {RotationAxis::AXISX, -PI / 2, false};
+            return true;
+        case GateType::Y:
+            rotation = {RotationAxis::AXISY, PI, false};
+            return true;
+        default:
+            return false;
+    }
+}
+
+QGateSet phaseGates(std::int64_t k, const Qubit &qubit) {
+    static const std::vector<std::vector<gate_t>> sequences{
+        {}, {GateType::T}, {GateType::S}, {GateType::S, GateType::T},
+        {GateType::Z}, {GateType::Z, GateType::T}, {GateType::SDG}, {GateType::TDG}};
+
+    QGateSet gates{};
+    for (auto type : sequences[((k % 8) + 8) % 8]) {
+        gates.push_back(std::make_unique<QGate>(type, 1, TargetSet{qubit}));
+    }
+    return gates;
+}
+
+struct PendingRotation {
+    std::size_t leader = NO_GATE;
+    RotationAxis axis = RotationAxis::AXISNONE;
+    fp angle = 0;
+    gcount_t merged = 0;
+    bool parameterized = false;
+};
+
+gcount_t mergeRotations(QCircuit &qc, bool clifford_t) {
+    auto &gates = qc.getGates();
+    const std::size_t n = gates.size();
+
+    Qubit max_qubit = 0;
+    for (auto &g : gates) {
+        for (auto q : g->getControls()) {
+            max_qubit = std::max(max_qubit, q);
+        }
+        for (auto q : g->getTargets()) {
+            max_qubit = std::max(max_qubit, q);
+        }
+    }
+
+    std::vector<PendingRotation> pending(max_qubit + 1);
+    std::vector<bool> removed(n, false);
+    std::unordered_map<std::size_t, QGateSet> replaced{};
+
+    auto flush = [&](const Qubit &q) {
+        auto run = pending[q];
+        pending[q] = PendingRotation{};
+        if (run.leader == NO_GATE) {
+            return;
+        }
+
+        fp angle = normalizeAngle(run.angle);
+        std::int64_t k = 0;
+        bool clifford = clifford_t && run.axis == RotationAxis::AXISZ && isAngleMultiple(angle, PI / 4, k);
+
+        if (angle == 0) {
+            removed[run.leader] = true;
+        } else if (clifford && (run.merged > 1 || run.parameterized)) {
+            replaced[run.leader] = phaseGates(k, q);
+        } else if (run.merged == 1) {
+            return;  // a lone rotation keeps its original form
+        } else if (run.parameterized && gates[run.leader]->getAngle().size() == 1) {
+            gates[run.leader]->getAngle().begin()->second = angleString(angle);
+        } else {
+            // fixed phase gates merged with a non pi/4 rotation
+            gate_t type = (run.axis == RotationAxis::AXISX)   ? GateType::RX
+                          : (run.axis == RotationAxis::AXISY) ? GateType::RY
+                                                              : GateType::RZ;
+            QGateSet rotation{};
+            rotation.push_back(std::make_unique<QGate>(type, 1, RotationMap{{RotationType::THETA, angleString(angle)}}, TargetSet{q}));
+            replaced[run.leader] = std::move(rotation);
+        }
+    };
+
+    for (std::size_t i = 0; i < n; ++i) {
+        auto &g = *gates[i];
+
+        Rotation rotation{};
+        if (asRotation(g, rotation)) {
+            const Qubit q = g.getTargets().front();
+            auto &run = pending[q];
+
+            if (run.leader != NO_GATE && run.axis == rotation.axis && (rotation.parameterized || run.parameterized || clifford_t)) {
+                run.angle += rotation.angle;
+                run.merged += 1;
+                run.parameterized |= rotation.parameterized;
+                removed[i] = true;
+                continue;
+            }
+
+            if (run.leader != NO_GATE && commutingAxis(g, q) != run.axis) {
+                flush(q);
+            }
+
+            // fixed gates only open a run when they can be folded back into phase gates
+            if (run.leader == NO_GATE && (rotation.parameterized || (clifford_t && rotation.axis == RotationAxis::AXISZ))) {
+                run = PendingRotation{i, rotation.axis, rotation.angle, 1, rotation.parameterized};
+            }
+            continue;
+        }
+
+        if (g.getType() == GateType::I) {
+            continue;
+        }
+
+        for (auto *operands : {&g.getControls(), &g.getTargets()}) {
+            for (auto q : *operands) {
+                if (pending[q].leader != NO_GATE && commutingAxis(g, q) != pending[q].axis) {
+                    flush(q);
+                }
+            }
+        }
+    }
+
+    for (Qubit q = 0; q < pending.size(); ++q) {
+        flush(q);
+    }
+
+    auto result = QGateSet{};
+    result.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        auto replacement = replaced.find(i);
+        if (replacement != replaced.end()) {
+            moveQGates(result, replacement->second);
+        } else if (!removed[i]) {
+            result.push_back(std::move(gates[i]));
+        }
+    }
+
+    gates = std::move(result);
+    qc.updateProperties();
+
+    return static_cast<gcount_t>(std::count(removed.begin(), removed.end(), true));
+}
+
+}  // namespace qcore
@@ -0,0 +1,125 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   SingleQubitFusion.cpp
+ *  @brief  Instance Description for the Single-Qubit Gate Run Fusion Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "optimize/SingleQubitFusion.hpp"
+
+#include <limits>
+
+#include "Angle.hpp"
+
+namespace qcore {
+
+static constexpr std::size_t NO_GATE = std::numeric_limits<std::size_t>::max();
+
+QGate u3Gate(const Matrix2 &matrix, const Qubit &qubit) {
+    auto euler = zyzDecomposition(matrix);
+    RotationMap angles{
+        {RotationType::THETA, angleString(euler.theta)},
+        {RotationType::PHI, angleString(euler.phi)},
+        {RotationType::LAMBDA, angleString(euler.lambda)}};
+    return QGate(GateType::U3, 1, angles, TargetSet{qubit});
+}
+
+struct SingleQubitRun {
+    std::size_t leader = NO_GATE;
+    gcount_t length = 0;
+    Matrix2 matrix = IDENTITY2;
+};
+
+gcount_t fuseSingleQubitRuns(QCircuit &qc) {
+    auto &gates = qc.getGates();
+    const std::size_t n = gates.size();
+
+    Qubit max_qubit = 0;
+    for (auto &g : gates) {
+        for (auto q : g->getControls()) {
+            max_qubit = std::max(max_qubit, q);
+        }
+        for (auto q : g->getTargets()) {
+            max_qubit = std::max(max_qubit, q);
+        }
+    }
+
+    std::vector<SingleQubitRun> runs(max_qubit + 1);
+    std::vector<bool> removed(n, false);
+
+    auto flush = [&](const Qubit &q) {
+        auto run = runs[q];
+        runs[q] = SingleQubitRun{};
+        if (run.length < 2) {
+            return;
+        }
+
+        if (isIdentityUpToPhase(run.matrix)) {
+            removed[run.leader] = true;
+        } else {
+            gates[run.leader] = std::make_unique<QGate>(u3Gate(run.matrix, q));
+        }
+    };
+
+    for (std::size_t i = 0; i < n; ++i) {
+        auto &g = *gates[i];
+
+        Matrix2 matrix{};
+        if (trySingleQubitMatrix(g, matrix)) {
+            const Qubit q = g.getTargets().front();
+            auto &run = runs[q];
+            if (run.leader == NO_GATE) {
+                run.leader = i;
+            } else {
+                removed[i] = true;
+            }
+            run.matrix = multiply(matrix, run.matrix);
+            run.length += 1;
+            continue;
+        }
+
+        for (auto *operands : {&g.getControls(), &g.getTargets()}) {
+            for (auto q : *operands) {
+                flush(q);
+            }
+        }
+    }
+
+    for (Qubit q = 0; q < runs.size(); ++q) {
+        flush(q);
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        if (removed[i]) {
+            gates[i].reset();
+        }
+    }
+
+    gcount_t reduction = removeEmptyQGates(gates);
+    qc.updateProperties();
+
+    return reduction;
+}
+
+}  // namespace qcore
@@ -0,0 +1,497 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   TemplateRewriting.cpp
+ *  @brief  Implementation of the Template-Matching Rewrite Engine
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "optimize/TemplateRewriting.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <map>
+
+namespace qcore {
+
+static constexpr std::size_t NO_POSITION = std::numeric_limits<std::size_t>::max();
+
+// k-th operand, counting the controls first
+static inline Qubit operandAt(const TemplateGate &gate, std::size_t k) {
+    return (k < gate.controls.size()) ? gate.controls[k] : gate.targets[k - gate.controls.size()];
+}
+
+static inline Qubit operandAt(QGate &gate, std::size_t k) {
+    return (k < gate.getControls().size()) ? gate.getControls()[k] : gate.getTargets()[k - gate.getControls().size()];
+}
+
+// the first two operands of these gate types can be exchanged
+static bool hasExchangeableOperands(const gate_t &gateType) {
+    switch (gateType) {
+        case GateType::CZ:
+        case GateType::SWAP:
+        case GateType::CCX:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static void checkTemplateGate(const std::string &rule, const TemplateGate &gate) {
+    switch (gate.type) {
+        case GateType::NONE:
+        case GateType::RESET:
+        case GateType::MEASURE:
+        case GateType::IF:
+        case GateType::BARRIER:
+            throw QcoreException("[TemplateMatcher] rule: " + rule + " gate: " + toString(gate.type) + " msg: gate type not allowed in templates");
+        default:
+            break;
+    }
+
+    const std::size_t arity = gate.controls.size() + gate.targets.size();
+    for (std::size_t a = 0; a < arity; ++a) {
+        for (std::size_t b = a + 1; b < arity; ++b) {
+            if (operandAt(gate, a) == operandAt(gate, b)) {
+                throw QcoreException("[TemplateMatcher] rule: " + rule + " gate: " + toString(gate.type) + " msg: repeated slot");
+            }
+        }
+    }
+}
+
+static bool operator==(const TemplateGate &lhs, const TemplateGate &rhs) {
+    return lhs.type == rhs.type && lhs.controls == rhs.controls && lhs.targets == rhs.targets;
+}
+
+TemplateMatcher::TemplateMatcher(std::vector<RewriteRule> rules) : rules{}, states(1) {
+    for (auto &rule : rules) {
+        const std::size_t m = rule.pattern.size();
+        if (m == 0) {
+            throw QcoreException("[TemplateMatcher] rule: " + rule.name + " msg: empty pattern");
+        }
+        for (auto *gates : {&rule.pattern, &rule.replacement}) {
+            for (auto &g : *gates) {
+                checkTemplateGate(rule.name, g);
+            }
+        }
+
+        // wire neighbours of every pattern gate, per operand
+        std::vector<std::vector<std::size_t>> previous(m), following(m);
+        std::map<Qubit, std::pair<std::size_t, std::size_t>> last_on{};  // slot -> (gate, operand)
+        for (std::size_t j = 0; j < m; ++j) {
+            auto &g = rule.pattern[j];
+            const std::size_t arity = g.controls.size() + g.targets.size();
+            previous[j].assign(arity, NO_POSITION);
+            following[j].assign(arity, NO_POSITION);
+            for (std::size_t k = 0; k < arity; ++k) {
+                auto it = last_on.find(operandAt(g, k));
+                if (it != last_on.end()) {
+                    previous[j][k] = it->second.first;
+                    following[it->second.first][it->second.second] = j;
+                }
+                last_on[operandAt(g, k)] = {j, k};
+            }
+        }
+
+        // breadth-first order over the wire neighbours
+        std::vector<std::size_t> order{0};
+        std::vector<std::size_t> depth(m, NO_POSITION);
+        depth[0] = 0;
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            const std::size_t j = order[i];
+            for (std::size_t k = 0; k < previous[j].size(); ++k) {
+                for (auto neighbour : {previous[j][k], following[j][k]}) {
+                    if (neighbour != NO_POSITION && depth[neighbour] == NO_POSITION) {
+                        depth[neighbour] = order.size();
+                        order.push_back(neighbour);
+                    }
+                }
+            }
+        }
+        if (order.size() != m) {
+            throw QcoreException("[TemplateMatcher] rule: " + rule.name + " msg: pattern is not connected");
+        }
+
+        // slots renumbered in order of first use
+        std::map<Qubit, Qubit> slot_of{};
+        for (auto j : order) {
+            auto &g = rule.pattern[j];
+            for (std::size_t k = 0; k < previous[j].size(); ++k) {
+                slot_of.emplace(operandAt(g, k), slot_of.size());
+            }
+        }
+        if (slot_of.size() > MAX_SLOTS) {
+            throw QcoreException("[TemplateMatcher] rule: " + rule.name + " msg: more than " + std::to_string(MAX_SLOTS) + " slots");
+        }
+        auto renumber = [&](TemplateGate g) {
+            for (auto *operands : {&g.controls, &g.targets}) {
+                for (auto &q : *operands) {
+                    auto it = slot_of.find(q);
+                    if (it == slot_of.end()) {
+                        throw QcoreException("[TemplateMatcher] rule: " + rule.name + " msg: replacement uses a slot outside the pattern");
+                    }
+                    q = it->second;
+                }
+            }
+            return g;
+        };
+
+        RewriteRule compiled{rule.name, {}, {}};
+        std::size_t state = 0;
+        for (std::size_t d = 0; d < m; ++d) {
+            const std::size_t j = order[d];
+            Transition transition{};
+            transition.gate = renumber(rule.pattern[j]);
+            transition.before.assign(previous[j].size(), NO_POSITION);
+            transition.after.assign(previous[j].size(), NO_POSITION);
+            for (std::size_t k = 0; k < previous[j].size(); ++k) {
+                if (previous[j][k] != NO_POSITION && depth[previous[j][k]] < d) {
+                    transition.before[k] = depth[previous[j][k]];
+                }
+                if (following[j][k] != NO_POSITION && depth[following[j][k]] < d) {
+                    transition.after[k] = depth[following[j][k]];
+                }
+            }
+            while (transition.anchor < previous[j].size() && transition.before[transition.anchor] == NO_POSITION &&
+                   transition.after[transition.anchor] == NO_POSITION) {
+                ++transition.anchor;
+            }
+            compiled.pattern.push_back(transition.gate);
+
+            // follow a shared prefix or branch off into a new state
+            auto &transitions = this->states[state].transitions;
+            auto it = std::find_if(transitions.begin(), transitions.end(), [&](const Transition &t) {
+                return t.gate == transition.gate && t.before == transition.before && t.after == transition.after;
+            });
+            if (it != transitions.end()) {
+                state = it->next;
+                continue;
+            }
+
+            State successor{};
+            successor.bound = this->states[state].bound;
+            for (std::size_t k = 0; k < previous[j].size(); ++k) {
+                successor.bound = std::max<std::size_t>(successor.bound, operandAt(transition.gate, k) + 1);
+            }
+            transition.next = this->states.size();
+            this->states.push_back(std::move(successor));
+            this->states[state].transitions.push_back(std::move(transition));
+            state = this->states.size() - 1;
+        }
+
+        for (auto &g : rule.replacement) {
+            compiled.replacement.push_back(renumber(g));
+        }
+        this->states[state].accepted.push_back(this->rules.size());
+        this->rules.push_back(std::move(compiled));
+    }
+}
+
+namespace {
+
+// wire neighbours of the gates of a circuit
+class WireGraph {
+   private:
+    std::vector<std::size_t> offset;
+    QubitSet operands{};
+    std::vector<std::size_t> previous{};
+    std::vector<std::size_t> following{};
+    Qubit qubits = 0;
+
+    inline std::size_t neighbour(const std::vector<std::size_t> &links, std::size_t g, const Qubit &q) const {
+        for (std::size_t k = this->offset[g]; k < this->offset[g + 1]; ++k) {
+            if (this->operands[k] == q) {
+                return links[k];
+            }
+        }
+        return NO_POSITION;
+    }
+
+   public:
+    explicit WireGraph(QGateSet &gates) : offset(gates.size() + 1, 0) {
+        for (std::size_t i = 0; i < gates.size(); ++i) {
+            for (auto *qubits : {&gates[i]->getControls(), &gates[i]->getTargets()}) {
+                for (auto q : *qubits) {
+                    this->operands.push_back(q);
+                    this->qubits = std::max<Qubit>(this->qubits, q + 1);
+                }
+            }
+            this->offset[i + 1] = this->operands.size();
+        }
+
+        this->previous.assign(this->operands.size(), NO_POSITION);
+        this->following.assign(this->operands.size(), NO_POSITION);
+        std::vector<std::size_t> last_gate(this->qubits, NO_POSITION), last_operand(this->qubits, NO_POSITION);
+        for (std::size_t i = 0; i < gates.size(); ++i) {
+            for (std::size_t k = this->offset[i]; k < this->offset[i + 1]; ++k) {
+                const Qubit q = this->operands[k];
+                if (last_gate[q] != NO_POSITION) {
+                    this->previous[k] = last_gate[q];
+                    this->following[last_operand[q]] = i;
+                }
+                last_gate[q] = i;
+                last_operand[q] = k;
+            }
+        }
+    }
+
+    inline std::size_t successor(std::size_t g, const Qubit &q) const { return neighbour(this->following, g, q); }
+
+    inline std::size_t predecessor(std::size_t g, const Qubit &q) const { return neighbour(this->previous, g, q); }
+
+    inline const Qubit *begin(std::size_t g) const { return this->operands.data() + this->offset[g]; }
+
+    inline const Qubit *end(std::size_t g) const { return this->operands.data() + this->offset[g + 1]; }
+
+    inline Qubit qubitCount() const { return this->qubits; }
+};
+
+struct PartialMatch {
+    std::size_t state = 0;
+    std::size_t rule = 0;
+    std::array<Qubit, TemplateMatcher::MAX_SLOTS> qubits{};
+    std::vector<std::size_t> gates{};  // in the order of the transitions
+};
+
+}  // namespace
+
+gcount_t TemplateMatcher::rewrite(QCircuit &qc, std::size_t max_rounds) const {
+    auto &gates = qc.getGates();
+    auto gain = [&](std::size_t r) {
+        return static_cast<std::int64_t>(this->rules[r].pattern.size()) - static_cast<std::int64_t>(this->rules[r].replacement.size());
+    };
+
+    gcount_t rewrites = 0;
+    for (std::size_t round = 0; round < max_rounds; ++round) {
+        const std::size_t n = gates.size();
+        const WireGraph wires(gates);
+        std::vector<bool> used(n, false);
+        std::vector<std::size_t> replaced_at(n, NO_POSITION);
+        std::vector<PartialMatch> accepted{};
+
+        auto usable = [&](std::size_t i) {
+            auto &g = *gates[i];
+            return !used[i] && !g.getIsClassical() && g.getAngle().empty() && g.getCbits().empty();
+        };
+
+        // candidate gate taking a transition, once per admissible operand order
+        std::vector<PartialMatch> stack{};
+        auto extend = [&](const PartialMatch &partial, const Transition &transition, std::size_t candidate) {
+            auto &g = *gates[candidate];
+            if (!usable(candidate) || g.getType() != transition.gate.type || g.getControls().size() != transition.gate.controls.size() ||
+                g.getTargets().size() != transition.gate.targets.size()) {
+                return;
+            }
+
+            const std::size_t bound = this->states[partial.state].bound;
+            const std::size_t arity = transition.before.size();
+            const std::size_t orders = (hasExchangeableOperands(g.getType()) && arity >= 2) ? 2 : 1;
+            for (std::size_t exchange = 0; exchange < orders; ++exchange) {
+                PartialMatch next = partial;
+                std::size_t fresh = bound;
+                bool matches = true;
+                for (std::size_t k = 0; k < arity && matches; ++k) {
+                    const Qubit slot = operandAt(transition.gate, k);
+                    const Qubit qubit = operandAt(g, (exchange != 0 && k < 2) ? (k ^ 1) : k);
+                    if (slot < bound) {
+                        matches = next.qubits[slot] == qubit;
+                    } else {
+                        matches = std::find(next.qubits.begin(), next.qubits.begin() + fresh, qubit) == next.qubits.begin() + fresh;
+                        next.qubits[fresh++] = qubit;
+                    }
+                    if (matches && transition.before[k] != NO_POSITION) {
+                        matches = wires.successor(next.gates[transition.before[k]], qubit) == candidate;
+                    }
+                    if (matches && transition.after[k] != NO_POSITION) {
+                        matches = wires.predecessor(next.gates[transition.after[k]], qubit) == candidate;
+                    }
+                }
+                if (matches) {
+                    next.state = transition.next;
+                    next.gates.push_back(candidate);
+                    stack.push_back(std::move(next));
+                }
+            }
+        };
+
+        // every contracted dependency must lead from a smaller to a larger position, where a
+        // match takes the position of the gate its replacement is put at
+        std::vector<std::size_t> match_of(n, NO_POSITION), positions{}, in_match(n, 0);
+        std::size_t stamp = 0;
+        auto position = [&](std::size_t g) { return (match_of[g] == NO_POSITION) ? g : positions[match_of[g]]; };
+        auto placeable = [&](const PartialMatch &match, std::size_t at) {
+            for (auto g : match.gates) {
+                for (const Qubit *q = wires.begin(g); q != wires.end(g); ++q) {
+                    const std::size_t before = wires.predecessor(g, *q), after = wires.successor(g, *q);
+                    if (before != NO_POSITION && in_match[before] != stamp && position(before) > at) {
+                        return false;
+                    }
+                    if (after != NO_POSITION && in_match[after] != stamp && position(after) < at) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+
+        std::vector<PartialMatch> found{};
+        for (std::size_t i = 0; i < n; ++i) {
+            if (!usable(i)) {
+                continue;
+            }
+
+            found.clear();
+            for (auto &transition : this->states[0].transitions) {
+                extend(PartialMatch{}, transition, i);
+            }
+            while (!stack.empty()) {
+                PartialMatch partial = std::move(stack.back());
+                stack.pop_back();
+
+                auto &state = this->states[partial.state];
+                for (auto r : state.accepted) {
+                    found.push_back(partial);
+                    found.back().rule = r;
+                }
+                for (auto &transition : state.transitions) {
+                    const std::size_t k = transition.anchor;
+                    const Qubit qubit = partial.qubits[operandAt(transition.gate, k)];
+                    const std::size_t candidate = (transition.before[k] != NO_POSITION) ? wires.successor(partial.gates[transition.before[k]], qubit)
+                                                                                        : wires.predecessor(partial.gates[transition.after[k]], qubit);
+                    if (candidate != NO_POSITION) {
+                        extend(partial, transition, candidate);
+                    }
+                }
+            }
+
+            std::stable_sort(found.begin(), found.end(), [&](const PartialMatch &lhs, const PartialMatch &rhs) {
+                return gain(lhs.rule) > gain(rhs.rule) || (gain(lhs.rule) == gain(rhs.rule) && lhs.rule < rhs.rule);
+            });
+            for (auto &match : found) {
+                ++stamp;
+                for (auto g : match.gates) {
+                    in_match[g] = stamp;
+                }
+                const auto bounds = std::minmax_element(match.gates.begin(), match.gates.end());
+                std::size_t at = *bounds.second;
+                if (!placeable(match, at)) {
+                    at = *bounds.first;
+                    if (!placeable(match, at)) {
+                        continue;
+                    }
+                }
+
+                for (auto g : match.gates) {
+                    used[g] = true;
+                    match_of[g] = accepted.size();
+                }
+                replaced_at[at] = accepted.size();
+                positions.push_back(at);
+                accepted.push_back(std::move(match));
+                break;
+            }
+        }
+
+        if (accepted.empty()) {
+            break;
+        }
+
+        QGateSet result{};
+        result.reserve(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (!used[i]) {
+                result.push_back(std::move(gates[i]));
+            } else if (replaced_at[i] != NO_POSITION) {
+                auto &match = accepted[replaced_at[i]];
+                for (auto &g : this->rules[match.rule].replacement) {
+                    ControlSet controls{};
+                    TargetSet targets{};
+                    for (auto q : g.controls) {
+                        controls.push_back(match.qubits[q]);
+                    }
+                    for (auto q : g.targets) {
+                        targets.push_back(match.qubits[q]);
+                    }
+                    const auto size = static_cast<gsize_t>(controls.size() + targets.size());
+                    result.push_back(std::make_unique<QGate>(g.type, size, controls, targets));
+                }
+            }
+        }
+        gates = std::move(result);
+        rewrites += accepted.size();
+    }
+
+    if (rewrites != 0) {
+        qc.updateProperties();
+    }
+    return rewrites;
+}
+
+const std::vector<RewriteRule> &builtinTemplates() {
+    static const std::vector<RewriteRule> rules{
+        {"reversed_cx",
+         {{GateType::H, {}, {0}}, {GateType::H, {}, {1}}, {GateType::CX, {0}, {1}}, {GateType::H, {}, {0}}, {GateType::H, {}, {1}}},
+         {{GateType::CX, {1}, {0}}}},
+        {"h_cx_h", {{GateType::H, {}, {1}}, {GateType::CX, {0}, {1}}, {GateType::H, {}, {1}}}, {{GateType::CZ, {0}, {1}}}},
+        {"h_cz_h", {{GateType::H, {}, {1}}, {GateType::CZ, {0}, {1}}, {GateType::H, {}, {1}}}, {{GateType::CX, {0}, {1}}}},
+        {"h_x_h", {{GateType::H, {}, {0}}, {GateType::X, {}, {0}}, {GateType::H, {}, {0}}}, {{GateType::Z, {}, {0}}}},
+        {"h_z_h", {{GateType::H, {}, {0}}, {GateType::Z, {}, {0}}, {GateType::H, {}, {0}}}, {{GateType::X, {}, {0}}}},
+        {"toffoli",
+         {{GateType::H, {}, {2}},
+          {GateType::CX, {1}, {2}},
+          {GateType::TDG, {}, {2}},
+          {GateType::CX, {0}, {2}},
+          {GateType::T, {}, {2}},
+          {GateType::CX, {1}, {2}},
+          {GateType::TDG, {}, {2}},
+          {GateType::CX, {0}, {2}},
+          {GateType::T, {}, {1}},
+          {GateType::T, {}, {2}},
+          {GateType::H, {}, {2}},
+          {GateType::CX, {0}, {1}},
+          {GateType::T, {}, {0}},
+          {GateType::TDG, {}, {1}},
+          {GateType::CX, {0}, {1}}},
+         {{GateType::CCX, {0, 1}, {2}}}},
+        {"relative_phase_toffoli",
+         {{GateType::H, {}, {2}},
+          {GateType::T, {}, {2}},
+          {GateType::CX, {1}, {2}},
+          {GateType::TDG, {}, {2}},
+          {GateType::CX, {0}, {2}},
+          {GateType::T, {}, {2}},
+          {GateType::CX, {1}, {2}},
+          {GateType::TDG, {}, {2}},
+          {GateType::H, {}, {2}}},
+         {{GateType::RCCX, {0, 1}, {2}}}},
+    };
+    return rules;
+}
+
+gcount_t applyTemplates(QCircuit &qc) {
+    static const TemplateMatcher matcher(builtinTemplates());
+    return matcher.rewrite(qc);
+}
+
+}  // namespace qcore
@@ -0,0 +1,137 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ *  @file   ZXSimplification.cpp
+ *  @brief  Instance Description for the ZX-Calculus Circuit Simplification Pass
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "optimize/ZXSimplification.hpp"
+
+#include <tuple>
+
+#include "Angle.hpp"
+#include "optimize/BlockConsolidation.hpp"
+#include "optimize/InverseCancellation.hpp"
+#include "optimize/RotationMerging.hpp"
+#include "zx/Extraction.hpp"
+#include "zx/Simplify.hpp"
+#include "zx/ZXDiagram.hpp"
+
+namespace qcore {
+
+static bool isNonClifford(QGate &gate) {
+    switch (gate.getType()) {
+        case GateType::T:
+        case GateType::TDG:
+            return true;
+        case GateType::RX:
+        case GateType::RZ:
+        case GateType::P:
+        case GateType::U1: {
+            auto &angles = gate.getAngle();
+            fp angle = 0;
+            std::int64_t k = 0;
+            return angles.size() != 1 || !tryAngleValue(angles.begin()->second, angle) || !isAngleMultiple(angle, PI / 2, k);
+        }
+        default:
+            return false;
+    }
+}
+
+gcount_t nonCliffordCount(QCircuit &qc) {
+    gcount_t count = 0;
+    for (auto &g : qc.getGates()) {
+        count += isNonClifford(*g) ? 1 : 0;
+    }
+    return count;
+}
+
+// (non-Clifford gates, CNOT cost, gates) compared lexicographically
+static std::tuple<gcount_t, gcount_t, gcount_t> zxCost(QCircuit &qc) {
+    gcount_t cx = 0;
+    for (auto &g : qc.getGates()) {
+        cx += cxCost(*g);
+    }
+    return std::make_tuple(nonCliffordCount(qc), cx, qc.getGates().size());
+}
+
+// simplifies a circuit made of isZXGate gates only, returning the non-Clifford reduction
+static gcount_t simplifySegment(QCircuit &segment) {
+    auto diagram = circuitToZX(segment);
+    fullReduce(diagram);
+
+    QCircuit extracted(segment.getQregSize(), segment.getCregSize());
+    try {
+        extracted.getGates() = extractCircuit(std::move(diagram));
+    } catch (const QcoreException &) {
+        return 0;
+    }
+    extracted.updateProperties();
+    cancelInversePairs(extracted);
+    mergeRotations(extracted, true);
+    cancelInversePairs(extracted);
+
+    const auto before = zxCost(segment), after = zxCost(extracted);
+    if (after >= before) {
+        return 0;
+    }
+
+    segment.getGates() = std::move(extracted.getGates());
+    return std::get<0>(before) - std::get<0>(after);
+}
+
+gcount_t simplifyWithZX(QCircuit &qc) {
+    auto &gates = qc.getGates();
+    QGateSet result{};
+    result.reserve(gates.size());
+    QCircuit segment(qc.getQregSize(), qc.getCregSize());
+    gcount_t reduction = 0;
+
+    auto flush = [&]() {
+        if (!segment.getGates().empty()) {
+            reduction += simplifySegment(segment);
+            moveQGates(result, segment.getGates());
+            segment.getGates().clear();
+        }
+    };
+
+    // gates without a ZX translation fence the segments around them
+    for (auto &g : gates) {
+        if (isZXGate(*g)) {
+            segment.getGates().push_back(std::move(g));
+            continue;
+        }
+        flush();
+        result.push_back(std::move(g));
+    }
+    flush();
+
+    gates = std::move(result);
+    qc.updateProperties();
+
+    return reduction;
+}
+
+}  // namespace qcore
@@ -0,0 +1,210 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   ThreadPool.cpp
+ *  @brief  Instance Description for the Work-Stealing Thread Pool
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "parallel/ThreadPool.hpp"
+
+#include <algorithm>
+#include <exception>
+
+namespace qcore {
+
+// worker identity of the calling thread, used to keep nested submissions local
+static thread_local ThreadPool *current_pool = nullptr;
+static thread_local std::size_t current_index = 0;
+
+std::size_t resolveThreads(std::size_t threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    return std::max<std::size_t>(threads, 1);
+}
+
+ThreadPool::ThreadPool(std::size_t threads, std::size_t capacity) {
+    threads = resolveThreads(threads);
+
+    this->capacity = (capacity == 0) ? 4 * threads : capacity;
+    this->queued = 0;
+    this->pending = 0;
+    this->next_queue = 0;
+    this->stopping = false;
+
+    this->queues.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        this->queues.push_back(std::make_unique<TaskQueue>());
+    }
+
+    this->workers.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        this->workers.emplace_back(&ThreadPool::run, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> state(this->state_lock);
+        this->stopping = true;
+    }
+    this->work_available.notify_all();
+
+    for (auto &worker : this->workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::push(task_t task) {
+    const bool from_worker = (current_pool == this);
+    {
+        std::unique_lock<std::mutex> state(this->state_lock);
+
+        if (this->stopping) {
+            throw QcoreException("[ThreadPool] submit error msg: pool is shutting down");
+        }
+
+        // workers never block on the bound, otherwise a full pool could deadlock itself
+        if (!from_worker) {
+            this->slot_available.wait(state, [this] { return this->queued < this->capacity; });
+        }
+
+        std::size_t index = from_worker ? current_index : (this->next_queue++ % this->queues.size());
+        {
+            std::lock_guard<std::mutex> queue(this->queues[index]->lock);
+            this->queues[index]->tasks.push_back(std::move(task));
+        }
+
+        ++this->queued;
+        ++this->pending;
+    }
+    this->work_available.notify_one();
+}
+
+bool ThreadPool::pop(std::size_t index, task_t &task) {
+    bool found = false;
+    {
+        // own queue is used as a stack for locality
+        std::lock_guard<std::mutex> queue(this->queues[index]->lock);
+        if (!this->queues[index]->tasks.empty()) {
+            task = std::move(this->queues[index]->tasks.back());
+            this->queues[index]->tasks.pop_back();
+            found = true;
+        }
+    }
+
+    // steal the oldest task of another worker
+    for (std::size_t i = 1; !found && i < this->queues.size(); ++i) {
+        auto &victim = this->queues[(index + i) % this->queues.size()];
+        std::lock_guard<std::mutex> queue(victim->lock);
+        if (!victim->tasks.empty()) {
+            task = std::move(victim->tasks.front());
+            victim->tasks.pop_front();
+            found = true;
+        }
+    }
+
+    if (found) {
+        {
+            std::lock_guard<std::mutex> state(this->state_lock);
+            --this->queued;
+        }
+        this->slot_available.notify_one();
+    }
+
+    return found;
+}
+
+void ThreadPool::run(std::size_t index) {
+    current_pool = this;
+    current_index = index;
+
+    while (true) {
+        task_t task;
+
+        if (pop(index, task)) {
+            // tasks report their own failures, an escaping exception must not end the worker
+            try {
+                task();
+            } catch (...) {
+            }
+
+            std::lock_guard<std::mutex> state(this->state_lock);
+            if (--this->pending == 0) {
+                this->all_done.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> state(this->state_lock);
+        this->work_available.wait(state, [this] { return this->stopping || this->queued > 0; });
+        if (this->stopping && this->queued == 0) {
+            return;
+        }
+    }
+}
+
+void ThreadPool::wait() {
+    if (current_pool == this) {
+        throw QcoreException("[ThreadPool] wait error msg: a worker cannot wait on its own pool");
+    }
+
+    std::unique_lock<std::mutex> state(this->state_lock);
+    this->all_done.wait(state, [this] { return this->pending == 0; });
+}
+
+void parallelFor(ThreadPool &pool, std::size_t n, const std::function<void(std::size_t, std::size_t)> &func, std::size_t grain) {
+    if (n == 0) {
+        return;
+    }
+
+    grain = std::max<std::size_t>(grain, 1);
+    std::size_t chunks = std::min(n / grain + ((n % grain) != 0), 4 * pool.size());
+    std::size_t chunk = n / chunks + ((n % chunks) != 0);
+
+    std::exception_ptr error = nullptr;
+    std::mutex error_lock;
+
+    for (std::size_t begin = 0; begin < n; begin += chunk) {
+        std::size_t end = std::min(begin + chunk, n);
+        pool.submit([&func, &error, &error_lock, begin, end] {
+            try {
+                func(begin, end);
+            } catch (...) {
+                std::lock_guard<std::mutex> guard(error_lock);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        });
+    }
+
+    pool.wait();
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}  // namespace qcore
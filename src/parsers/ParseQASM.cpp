@@ -127,6 +127,17 @@ void QCircuit::readQASM(std::istream& is) {
         {GateGroup::FOUR, std::regex("^\\s*([a-z]*[0-9]*)\\(\\s*(pi\\s*/?\\s*[0-9]*?|[0-9]*\\.[0-9]+)\\s*,\\s*(pi\\s*/?\\s*[0-9]*?|[0-9]*\\.[0-9]+)\\s*,\\s*(pi\\s*/?\\s*[0-9]*?|[0-9]*\\.[0-9]+)\\s*,\\s*(pi\\s*/?\\s*[0-9]*?|[0-9]*\\.[0-9]+)\\s*\\)(.*);\\s*$")},
         {GateGroup::MEASURE, std::regex("^\\s*(measure)\\s*([A-Za-z][A-Za-z0-9]*\\[[0-9]\\])\\s*->\\s*[A-Za-z][A-Za-z0-9]*(\\[[0-9]+\\])\\s*;\\s*$")}};
 
+    // read-only lookups into the shared tables, readQASM may run on several threads at once
+    auto headerKeyOf = [](const std::string& token) {
+        auto it = header_map.find(token);
+        return (it == header_map.end()) ? HeaderKey::NONE : it->second;
+    };
+
+    auto gateTypeOf = [](const std::string& token) {
+        auto it = gateType_map.find(token);
+        return (it == gateType_map.end()) ? GateType::NONE : it->second;
+    };
+
     std::smatch gateTokens;
     std::string nextToken;
     int line = 0;
@@ -134,6 +145,9 @@ void QCircuit::readQASM(std::istream& is) {
         line++;
 
         if (!static_cast<bool>(is >> nextToken)) {
+            if (is.eof()) {
+                break;  // only trailing whitespace was left
+            }
             throw QcoreException("[readQASM] l:" + std::to_string(line) + " msg: Failed to read content");
         }
 
@@ -142,7 +156,7 @@ void QCircuit::readQASM(std::istream& is) {
             continue;  // skip comments lines
         }
 
-        else if (header_map[nextToken] == HeaderKey::OPENQASM) {
+        else if (headerKeyOf(nextToken) == HeaderKey::OPENQASM) {
             if (!static_cast<bool>(std::getline(is, nextToken))) {
                 throw QcoreException("[readQASM] l:" + std::to_string(line) + " msg: Failed to read gate");
             }
@@ -157,12 +171,12 @@ void QCircuit::readQASM(std::istream& is) {
             continue;  // version
         }
 
-        else if (header_map[nextToken] == HeaderKey::INCLUDE) {
+        else if (headerKeyOf(nextToken) == HeaderKey::INCLUDE) {
             is.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
             continue;  // skip include file
         }
 
-        else if (header_map[nextToken] == HeaderKey::QREG) {
+        else if (headerKeyOf(nextToken) == HeaderKey::QREG) {
             if (!static_cast<bool>(std::getline(is, nextToken))) {
                 throw QcoreException("[readQASM] l:" + std::to_string(line) + " msg: Failed to read gate");
             }
@@ -172,7 +186,7 @@ void QCircuit::readQASM(std::istream& is) {
             continue;  // quantum register length
         }
 
-        else if (header_map[nextToken] == HeaderKey::CREG) {
+        else if (headerKeyOf(nextToken) == HeaderKey::CREG) {
             if (!static_cast<bool>(std::getline(is, nextToken))) {
                 throw QcoreException("[readQASM] l:" + std::to_string(line) + " msg: Failed to read gate");
             }
@@ -187,7 +201,7 @@ void QCircuit::readQASM(std::istream& is) {
             std::string qgate{};
             is_classical classical = false;
             expression_t expression{};
-            if (gateType_map[ltrim(rtrim(nextToken))] == GateType::IF) {
+            if (gateTypeOf(ltrim(rtrim(nextToken))) == GateType::IF) {
                 classical = true;
             }
 
@@ -212,8 +226,8 @@ void QCircuit::readQASM(std::istream& is) {
             RotationMap angles{};
             CbitSet cbits{};
 
-            if (std::regex_match(qgate, gateTokens, gateGroup_map[GateGroup::MEASURE])) {
-                gate_type = gateType_map[ltrim(rtrim(gateTokens[1]))];
+            if (std::regex_match(qgate, gateTokens, gateGroup_map.at(GateGroup::MEASURE))) {
+                gate_type = gateTypeOf(ltrim(rtrim(gateTokens[1])));
 
                 QubitSet qubits{};
                 if (var_indices.find(gateTokens[2]) == var_indices.end()) {                    
@@ -240,8 +254,8 @@ void QCircuit::readQASM(std::istream& is) {
 
             }
 
-            else if (std::regex_match(qgate, gateTokens, gateGroup_map[GateGroup::ZERO])) {
-                gate_type = gateType_map[ltrim(rtrim(gateTokens[1]))];
+            else if (std::regex_match(qgate, gateTokens, gateGroup_map.at(GateGroup::ZERO))) {
+                gate_type = gateTypeOf(ltrim(rtrim(gateTokens[1])));
 
                 if (gate_type == GateType::NONE) {
                     throw QcoreException("[readQASM] l:" + std::to_string(line) + " msg: Unrecognized gate type " + ltrim(rtrim(gateTokens[1])));
@@ -280,8 +294,8 @@ void QCircuit::readQASM(std::istream& is) {
 
             }
 
-            else if (std::regex_match(qgate, gateTokens, gateGroup_map[GateGroup::ONE])) {
-                gate_type = gateType_map[ltrim(rtrim(gateTokens[1]))];
+            else if (std::regex_match(qgate, gateTokens, gateGroup_map.at(GateGroup::ONE))) {
+                gate_type = gateTypeOf(ltrim(rtrim(gateTokens[1])));
 
                 if (gate_type == GateType::NONE) {
                     throw QcoreException("[readQASM] l:" + std::to_string(line) + " msg: Unrecognized gate type " + ltrim(rtrim(gateTokens[1])));
@@ -322,8 +336,8 @@ void QCircuit::readQASM(std::istream& is) {
 
             }
 
-            else if (std::regex_match(qgate, gateTokens, gateGroup_map[GateGroup::TWO])) {
-                gate_type = gateType_map[ltrim(rtrim(gateTokens[1]))];
+            else if (std::regex_match(qgate, gateTokens, gateGroup_map.at(GateGroup::TWO))) {
+                gate_type = gateTypeOf(ltrim(rtrim(gateTokens[1])));
 
                 if (gate_type == GateType::NONE) {
                     throw QcoreException("[readQASM] l:" + std::to_string(line) + " msg: Unrecognized gate type " + ltrim(rtrim(gateTokens[1])));
@@ -360,8 +374,8 @@ void QCircuit::readQASM(std::istream& is) {
 
             }
 
-            else if (std::regex_match(qgate, gateTokens, gateGroup_map[GateGroup::THREE])) {
-                gate_type = gateType_map[ltrim(rtrim(gateTokens[1]))];
+            else if (std::regex_match(qgate, gateTokens, gateGroup_map.at(GateGroup::THREE))) {
+                gate_type = gateTypeOf(ltrim(rtrim(gateTokens[1])));
 
                 if (gate_type == GateType::NONE) {
                     throw QcoreException("[readQASM] l:" + std::to_string(line) + " msg: Unrecognized gate type " + ltrim(rtrim(gateTokens[1])));
@@ -392,8 +406,8 @@ void QCircuit::readQASM(std::istream& is) {
 
             }
 
-            else if (std::regex_match(qgate, gateTokens, gateGroup_map[GateGroup::FOUR])) {
-                gate_type = gateType_map[ltrim(rtrim(gateTokens[1]))];
+            else if (std::regex_match(qgate, gateTokens, gateGroup_map.at(GateGroup::FOUR))) {
+                gate_type = gateTypeOf(ltrim(rtrim(gateTokens[1])));
 
                 if (gate_type == GateType::NONE) {
                     throw QcoreException("[readQASM] l:" + std::to_string(line) + " msg: Unrecognized gate type " + ltrim(rtrim(gateTokens[1])));
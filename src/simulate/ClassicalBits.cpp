@@ -0,0 +1,59 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   ClassicalBits.cpp
+ *  @brief  Instance Description for the Classical Register Handling Shared by the Simulators
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "simulate/ClassicalBits.hpp"
+
+#include <string>
+
+namespace qcore {
+
+bool conditionHolds(QGate &gate, const std::vector<std::uint8_t> &cbits, const std::string &func) {
+    std::uint64_t expected = 0;
+    try {
+        expected = std::stoull(gate.setExpression());
+    } catch (const std::exception &) {
+        throw QcoreException("[" + func + "] gate: " + toString(gate.getType()) + " msg: unsupported condition " + gate.setExpression());
+    }
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < cbits.size() && i < 64; ++i) {
+        value |= static_cast<std::uint64_t>(cbits[i]) << i;
+    }
+    return value == expected;
+}
+
+void storeOutcome(std::vector<std::uint8_t> &cbits, QGate &gate, std::size_t i, bool outcome) {
+    auto &bits = gate.getCbits();
+    if (i < bits.size()) {
+        if (bits[i] >= cbits.size()) {
+            cbits.resize(bits[i] + 1, 0);
+        }
+        cbits[bits[i]] = outcome ? 1 : 0;
+    }
+}
+
+}  // namespace qcore
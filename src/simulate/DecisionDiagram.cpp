@@ -0,0 +1,728 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   DecisionDiagram.cpp
+ *  @brief  Instance Description for the Decision-Diagram (QMDD) Simulation Backend
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "simulate/DecisionDiagram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <string>
+
+#include "decompose/Clifford_T.hpp"
+#include "simulate/ClassicalBits.hpp"
+#include "simulate/StateVector.hpp"
+
+namespace qcore {
+
+namespace {
+
+// roles of the levels of a gate operator, targets being numbered from 0
+constexpr std::int32_t IDLE = -1;
+constexpr std::int32_t CONTROL = -2;
+
+std::uint64_t mix(std::uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    return h ^ (h >> 33);
+}
+
+std::uint64_t hashWeight(const Complex &w) {
+    std::uint64_t re = 0, im = 0;
+    const fp real = w.real(), imag = w.imag();
+    std::memcpy(&re, &real, sizeof(re));
+    std::memcpy(&im, &imag, sizeof(im));
+    return mix(re ^ mix(im));
+}
+
+// cell of the tolerance grid, or EMPTY for weights too large to be canonicalized
+std::uint64_t cellKey(std::int64_t re, std::int64_t im) {
+    const std::uint64_t key = mix(static_cast<std::uint64_t>(re) ^ mix(static_cast<std::uint64_t>(im)));
+    return (key == FlatHashMap<std::uint64_t, Complex>::EMPTY) ? 0 : key;
+}
+
+template <std::size_t N>
+DDEdge<N> terminal(const Complex &w) {
+    return (std::abs(w) < DD_TOLERANCE) ? DDEdge<N>{} : DDEdge<N>{0, w};
+}
+
+template <std::size_t N>
+DDEdge<N> scale(const DDEdge<N> &edge, const Complex &w) {
+    return edge.isZero() ? edge : ((std::abs(edge.weight * w) < DD_TOLERANCE) ? DDEdge<N>{} : DDEdge<N>{edge.node, edge.weight * w});
+}
+
+}  // namespace
+
+template <std::size_t N>
+DDPackage::NodeTable<N> &DDPackage::table() {
+    if constexpr (N == 2) {
+        return this->vectors;
+    } else {
+        return this->matrices;
+    }
+}
+
+template <std::size_t N>
+const DDPackage::NodeTable<N> &DDPackage::table() const {
+    if constexpr (N == 2) {
+        return this->vectors;
+    } else {
+        return this->matrices;
+    }
+}
+
+template <std::size_t N>
+std::vector<DDPackage::AddEntry<N>> &DDPackage::additions() {
+    if constexpr (N == 2) {
+        return this->vector_additions;
+    } else {
+        return this->matrix_additions;
+    }
+}
+
+template <std::size_t N>
+std::vector<DDPackage::MultiplyEntry<N>> &DDPackage::products() {
+    if constexpr (N == 2) {
+        return this->vector_products;
+    } else {
+        return this->matrix_products;
+    }
+}
+
+DDPackage::DDPackage(std::size_t qubits, std::size_t gc_limit)
+    : qubits(qubits),
+      vector_additions(COMPUTE_TABLE_SIZE),
+      matrix_additions(COMPUTE_TABLE_SIZE),
+      vector_products(COMPUTE_TABLE_SIZE),
+      matrix_products(COMPUTE_TABLE_SIZE) {
+    if (qubits == 0) {
+        throw QcoreException("[DDPackage] simulation error msg: a register of 0 qubits.");
+    }
+    rebuildWeights();
+    std::size_t buckets = 1024;
+    while (buckets < gc_limit / 2) {
+        buckets <<= 1;
+    }
+    // node 0 of both tables is the terminal
+    this->vectors.nodes.resize(1);
+    this->vectors.buckets.assign(buckets, 0);
+    this->vectors.limit = std::max<std::size_t>(gc_limit, 1);
+    this->matrices.nodes.resize(1);
+    this->matrices.buckets.assign(buckets, 0);
+    this->matrices.limit = std::max<std::size_t>(gc_limit, 1);
+}
+
+Complex DDPackage::canonical(const Complex &w) {
+    if (std::abs(w.real()) > 1e3 || std::abs(w.imag()) > 1e3) {
+        return w;
+    }
+    const auto re = static_cast<std::int64_t>(std::llround(w.real() / DD_TOLERANCE));
+    const auto im = static_cast<std::int64_t>(std::llround(w.imag() / DD_TOLERANCE));
+    for (std::int64_t i = re - 1; i <= re + 1; ++i) {
+        for (std::int64_t j = im - 1; j <= im + 1; ++j) {
+            const Complex *value = this->weights.find(cellKey(i, j));
+            // a hash collision of cells leaves the weight as it is
+            if (value != nullptr && std::abs(value->real() - w.real()) <= DD_TOLERANCE && std::abs(value->imag() - w.imag()) <= DD_TOLERANCE) {
+                return *value;
+            }
+        }
+    }
+    this->weights.insert(cellKey(re, im), w);
+    return w;
+}
+
+void DDPackage::rebuildWeights() {
+    this->weights.clear();
+    for (const Complex &w : {Complex{1, 0}, Complex{-1, 0}, Complex{0, 1}, Complex{0, -1}}) {
+        canonical(w);
+    }
+    // the weights of the nodes in the unique tables, not of those on the free lists
+    for (auto head : this->vectors.buckets) {
+        for (std::uint32_t i = head; i != 0; i = this->vectors.nodes[i].next) {
+            for (auto &e : this->vectors.nodes[i].edges) {
+                canonical(e.weight);
+            }
+        }
+    }
+    for (auto head : this->matrices.buckets) {
+        for (std::uint32_t i = head; i != 0; i = this->matrices.nodes[i].next) {
+            for (auto &e : this->matrices.nodes[i].edges) {
+                canonical(e.weight);
+            }
+        }
+    }
+}
+
+template <std::size_t N>
+DDEdge<N> DDPackage::makeNode(std::int32_t level, std::array<DDEdge<N>, N> edges) {
+    // normalization: the successor of largest magnitude (the first of equal ones) gets weight 1
+    fp largest = 0;
+    for (auto &e : edges) {
+        largest = std::max(largest, std::norm(e.weight));
+    }
+    if (largest < DD_TOLERANCE * DD_TOLERANCE) {
+        return DDEdge<N>{};
+    }
+    std::size_t pivot = 0;
+    while (std::norm(edges[pivot].weight) < largest * (1 - 64 * DD_TOLERANCE)) {
+        ++pivot;
+    }
+    const Complex w = edges[pivot].weight;
+    for (std::size_t i = 0; i < N; ++i) {
+        const Complex weight = edges[i].weight / w;
+        if (i == pivot) {
+            edges[i].weight = Complex{1, 0};
+        } else if (std::abs(weight.real()) <= DD_TOLERANCE && std::abs(weight.imag()) <= DD_TOLERANCE) {
+            edges[i] = DDEdge<N>{};
+        } else {
+            edges[i].weight = canonical(weight);
+        }
+    }
+
+    NodeTable<N> &nodes = table<N>();
+    std::uint64_t h = mix(static_cast<std::uint64_t>(level) + 1);
+    for (auto &e : edges) {
+        h = mix(h ^ (e.node + hashWeight(e.weight)));
+    }
+    const std::size_t bucket = h & (nodes.buckets.size() - 1);
+    for (std::uint32_t i = nodes.buckets[bucket]; i != 0; i = nodes.nodes[i].next) {
+        const Node<N> &node = nodes.nodes[i];
+        if (node.level == level && std::equal(edges.begin(), edges.end(), node.edges.begin(), [](const DDEdge<N> &a, const DDEdge<N> &b) {
+                return a.node == b.node && a.weight == b.weight;
+            })) {
+            return DDEdge<N>{i, w};
+        }
+    }
+
+    std::uint32_t index = nodes.free;
+    if (index != 0) {
+        nodes.free = nodes.nodes[index].next;
+    } else {
+        index = static_cast<std::uint32_t>(nodes.nodes.size());
+        nodes.nodes.emplace_back();
+        this->statistics.peak_nodes = std::max(this->statistics.peak_nodes, this->vectors.nodes.size() + this->matrices.nodes.size() - 2);
+    }
+    Node<N> &node = nodes.nodes[index];
+    node.edges = edges;
+    node.level = level;
+    node.ref = 0;
+    node.identity = false;
+    if constexpr (N == 4) {
+        node.identity = edges[1].isZero() && edges[2].isZero() && edges[0].node == edges[3].node && edges[0].weight == Complex{1, 0} &&
+                        edges[3].weight == Complex{1, 0} && (level == 0 || nodes.nodes[edges[0].node].identity);
+    }
+    node.next = nodes.buckets[bucket];
+    nodes.buckets[bucket] = index;
+    ++nodes.live;
+
+    // rehashing at two nodes per bucket
+    if (nodes.live > 2 * nodes.buckets.size()) {
+        std::vector<std::uint32_t> chained{};
+        chained.reserve(nodes.live);
+        for (auto head : nodes.buckets) {
+            for (std::uint32_t i = head; i != 0; i = nodes.nodes[i].next) {
+                chained.push_back(i);
+            }
+        }
+        nodes.buckets.assign(2 * nodes.buckets.size(), 0);
+        for (auto i : chained) {
+            Node<N> &n = nodes.nodes[i];
+            std::uint64_t g = mix(static_cast<std::uint64_t>(n.level) + 1);
+            for (auto &e : n.edges) {
+                g = mix(g ^ (e.node + hashWeight(e.weight)));
+            }
+            const std::size_t b = g & (nodes.buckets.size() - 1);
+            n.next = nodes.buckets[b];
+            nodes.buckets[b] = i;
+        }
+    }
+    return DDEdge<N>{index, w};
+}
+
+template <std::size_t N>
+void DDPackage::incRef(NodeTable<N> &nodes, std::uint32_t node) {
+    if (node != 0 && nodes.nodes[node].ref++ == 0) {
+        for (auto &e : nodes.nodes[node].edges) {
+            incRef(nodes, e.node);
+        }
+    }
+}
+
+template <std::size_t N>
+void DDPackage::decRef(NodeTable<N> &nodes, std::uint32_t node) {
+    if (node == 0) {
+        return;
+    }
+    if (nodes.nodes[node].ref == 0) {
+        throw QcoreException("[DDPackage::decRef] simulation error msg: releasing an unreferenced node.");
+    }
+    if (--nodes.nodes[node].ref == 0) {
+        for (auto &e : nodes.nodes[node].edges) {
+            decRef(nodes, e.node);
+        }
+    }
+}
+
+void DDPackage::incRef(const VectorEdge &edge) { incRef(this->vectors, edge.node); }
+
+void DDPackage::incRef(const MatrixEdge &edge) { incRef(this->matrices, edge.node); }
+
+void DDPackage::decRef(const VectorEdge &edge) { decRef(this->vectors, edge.node); }
+
+void DDPackage::decRef(const MatrixEdge &edge) { decRef(this->matrices, edge.node); }
+
+template <std::size_t N>
+void DDPackage::collect(NodeTable<N> &nodes, bool force) {
+    if (!force && nodes.live <= nodes.limit) {
+        return;
+    }
+    for (auto &head : nodes.buckets) {
+        std::uint32_t *link = &head;
+        while (*link != 0) {
+            const std::uint32_t i = *link;
+            Node<N> &node = nodes.nodes[i];
+            if (node.ref == 0) {
+                *link = node.next;
+                node.next = nodes.free;
+                nodes.free = i;
+                --nodes.live;
+            } else {
+                link = &node.next;
+            }
+        }
+    }
+    while (nodes.live > nodes.limit / 2) {
+        nodes.limit *= 2;
+    }
+    // the compute tables may point to freed nodes
+    ++this->generation;
+    ++this->statistics.collections;
+}
+
+void DDPackage::garbageCollect(bool force) {
+    const std::size_t collections = this->statistics.collections;
+    collect(this->vectors, force);
+    collect(this->matrices, force);
+    if (this->statistics.collections != collections) {
+        rebuildWeights();
+    }
+    this->statistics.vector_nodes = this->vectors.live;
+    this->statistics.matrix_nodes = this->matrices.live;
+}
+
+template <std::size_t N>
+DDEdge<N> DDPackage::addEdges(const DDEdge<N> &lhs, const DDEdge<N> &rhs) {
+    if (lhs.isZero()) {
+        return rhs;
+    }
+    if (rhs.isZero()) {
+        return lhs;
+    }
+    if (lhs.node == rhs.node) {
+        const Complex w = lhs.weight + rhs.weight;
+        return (std::abs(w) < DD_TOLERANCE) ? DDEdge<N>{} : DDEdge<N>{lhs.node, w};
+    }
+
+    // lhs + rhs = w (a + ratio b) for the nodes a < b
+    const bool ordered = lhs.node < rhs.node;
+    const DDEdge<N> &a = ordered ? lhs : rhs, &b = ordered ? rhs : lhs;
+    const Complex ratio = canonical(b.weight / a.weight);
+    auto &cache = additions<N>();
+    AddEntry<N> &slot = cache[mix(mix(a.node) ^ b.node ^ hashWeight(ratio)) & (cache.size() - 1)];
+    ++this->statistics.lookups;
+    if (slot.generation == this->generation && slot.lhs == a.node && slot.rhs == b.node && slot.ratio == ratio) {
+        ++this->statistics.hits;
+        return scale(slot.result, a.weight);
+    }
+
+    const NodeTable<N> &nodes = table<N>();
+    const std::int32_t level = nodes.nodes[a.node].level;
+    const std::array<DDEdge<N>, N> x = nodes.nodes[a.node].edges, y = nodes.nodes[b.node].edges;
+    std::array<DDEdge<N>, N> sum{};
+    for (std::size_t i = 0; i < N; ++i) {
+        sum[i] = addEdges(x[i], scale(y[i], ratio));
+    }
+    const DDEdge<N> result = makeNode<N>(level, sum);
+
+    // the slot may have been overwritten while recursing
+    AddEntry<N> &entry = cache[mix(mix(a.node) ^ b.node ^ hashWeight(ratio)) & (cache.size() - 1)];
+    entry.lhs = a.node;
+    entry.rhs = b.node;
+    entry.ratio = ratio;
+    entry.result = result;
+    entry.generation = this->generation;
+    return scale(result, a.weight);
+}
+
+template <std::size_t N>
+DDEdge<N> DDPackage::multiplyEdges(const MatrixEdge &lhs, const DDEdge<N> &rhs) {
+    if (lhs.isZero() || rhs.isZero()) {
+        return DDEdge<N>{};
+    }
+    const Complex w = lhs.weight * rhs.weight;
+    if (lhs.node == 0) {
+        return terminal<N>(w);
+    }
+    if (this->matrices.nodes[lhs.node].identity) {
+        return scale(DDEdge<N>{rhs.node, Complex{1, 0}}, w);
+    }
+    if constexpr (N == 4) {
+        if (this->matrices.nodes[rhs.node].identity) {
+            return scale(DDEdge<N>{lhs.node, Complex{1, 0}}, w);
+        }
+    }
+
+    auto &cache = products<N>();
+    const std::size_t index = mix(mix(lhs.node) ^ rhs.node) & (cache.size() - 1);
+    ++this->statistics.lookups;
+    if (cache[index].generation == this->generation && cache[index].lhs == lhs.node && cache[index].rhs == rhs.node) {
+        ++this->statistics.hits;
+        return scale(cache[index].result, w);
+    }
+
+    const std::int32_t level = this->matrices.nodes[lhs.node].level;
+    const std::array<MatrixEdge, 4> m = this->matrices.nodes[lhs.node].edges;
+    const std::array<DDEdge<N>, N> v = table<N>().nodes[rhs.node].edges;
+    std::array<DDEdge<N>, N> product{};
+    for (std::size_t row = 0; row < 2; ++row) {
+        for (std::size_t column = 0; column < N / 2; ++column) {
+            // (M v)_row = M_row,0 v_0 + M_row,1 v_1, per column of a matrix operand
+            product[row * (N / 2) + column] = addEdges(multiplyEdges(m[2 * row], v[column]), multiplyEdges(m[2 * row + 1], v[N / 2 + column]));
+        }
+    }
+    const DDEdge<N> result = makeNode<N>(level, product);
+
+    MultiplyEntry<N> &entry = cache[index];
+    entry.lhs = lhs.node;
+    entry.rhs = rhs.node;
+    entry.result = result;
+    entry.generation = this->generation;
+    return scale(result, w);
+}
+
+VectorEdge DDPackage::add(const VectorEdge &lhs, const VectorEdge &rhs) { return addEdges(lhs, rhs); }
+
+MatrixEdge DDPackage::add(const MatrixEdge &lhs, const MatrixEdge &rhs) { return addEdges(lhs, rhs); }
+
+VectorEdge DDPackage::multiply(const MatrixEdge &lhs, const VectorEdge &rhs) { return multiplyEdges(lhs, rhs); }
+
+MatrixEdge DDPackage::multiply(const MatrixEdge &lhs, const MatrixEdge &rhs) { return multiplyEdges(lhs, rhs); }
+
+VectorEdge DDPackage::makeBasisState(std::uint64_t index) {
+    VectorEdge e{0, Complex{1, 0}};
+    for (std::size_t q = 0; q < this->qubits; ++q) {
+        const bool one = q < 64 && ((index >> q) & 1) != 0;
+        e = makeNode<2>(static_cast<std::int32_t>(q), one ? std::array<VectorEdge, 2>{VectorEdge{}, e} : std::array<VectorEdge, 2>{e, VectorEdge{}});
+    }
+    return e;
+}
+
+MatrixEdge DDPackage::makeIdentity() {
+    MatrixEdge e{0, Complex{1, 0}};
+    for (std::size_t q = 0; q < this->qubits; ++q) {
+        e = makeNode<4>(static_cast<std::int32_t>(q), {e, MatrixEdge{}, MatrixEdge{}, e});
+    }
+    return e;
+}
+
+MatrixEdge DDPackage::makeOperator(std::int32_t level, const std::vector<std::int32_t> &roles, const Complex *matrix, std::size_t dim,
+                                   std::size_t row, std::size_t column, bool active) {
+    if (level < 0) {
+        // below all levels: the matrix entry, or the identity where a control is 0
+        return terminal<4>(active ? matrix[row * dim + column] : Complex{(row == column) ? fp{1} : fp{0}, 0});
+    }
+    const std::int32_t role = roles[level];
+    if (role >= 0) {
+        std::array<MatrixEdge, 4> edges{};
+        for (std::size_t r = 0; r < 2; ++r) {
+            for (std::size_t c = 0; c < 2; ++c) {
+                edges[2 * r + c] = makeOperator(level - 1, roles, matrix, dim, row | (r << role), column | (c << role), active);
+            }
+        }
+        return makeNode<4>(level, edges);
+    }
+    const MatrixEdge idle = makeOperator(level - 1, roles, matrix, dim, row, column, active && role != CONTROL);
+    const MatrixEdge one = (active && role == CONTROL) ? makeOperator(level - 1, roles, matrix, dim, row, column, true) : idle;
+    return makeNode<4>(level, {idle, MatrixEdge{}, MatrixEdge{}, one});
+}
+
+MatrixEdge DDPackage::makeGate(const QubitSet &targets, const Complex *matrix, const QubitSet &controls) {
+    std::vector<std::int32_t> roles(this->qubits, IDLE);
+    auto assign = [this, &roles](Qubit q, std::int32_t role) {
+        if (q >= this->qubits || roles[q] != IDLE) {
+            throw QcoreException("[DDPackage::makeGate] simulation error msg: qubit " + std::to_string(q) + " is repeated or outside the register.");
+        }
+        roles[q] = role;
+    };
+    for (std::size_t i = 0; i < targets.size(); ++i) {
+        assign(targets[i], static_cast<std::int32_t>(i));
+    }
+    for (auto q : controls) {
+        assign(q, CONTROL);
+    }
+    return makeOperator(static_cast<std::int32_t>(this->qubits) - 1, roles, matrix, std::size_t{1} << targets.size(), 0, 0, true);
+}
+
+MatrixEdge DDPackage::makeGate(QGate &gate) {
+    const gate_t type = gate.getType();
+    if (!isSupportedUnitary(gate)) {
+        throw QcoreException("[DDPackage::makeGate] gate: " + toString(type) + " msg: unsupported gate.");
+    }
+    auto &controls = gate.getControls();
+    auto &targets = gate.getTargets();
+    const Matrix2 x = fixedMatrix(GateType::X);
+    switch (type) {
+        case GateType::BARRIER:
+        case GateType::I:
+            return makeIdentity();
+        case GateType::SWAP:
+        case GateType::CSWAP: {
+            Matrix4 swap{};
+            swap[0] = swap[6] = swap[9] = swap[15] = Complex{1, 0};
+            return makeGate({targets[0], targets[1]}, swap.data(), controls);
+        }
+        case GateType::LCCX:
+        case GateType::LCCXDG:
+            return makeGate({targets[0]}, x.data(), controls);
+        case GateType::PERES:
+        case GateType::PERESDG: {
+            // CCX(a, b, c) followed by CX(a, b), or the reverse
+            const MatrixEdge ccx = makeGate({targets[0]}, x.data(), controls);
+            const MatrixEdge cx = makeGate({controls[1]}, x.data(), {controls[0]});
+            return (type == GateType::PERES) ? multiply(cx, ccx) : multiply(ccx, cx);
+        }
+        default:
+            break;
+    }
+
+    Matrix2 matrix{};
+    if (tryTargetMatrix(gate, matrix)) {
+        return makeGate({targets[0]}, matrix.data(), controls);
+    }
+    Matrix4 matrix4{};
+    if (tryPairMatrix(gate, matrix4)) {
+        return makeGate({targets[0], targets[1]}, matrix4.data());
+    }
+
+    QubitSet operands(controls.begin(), controls.end());
+    operands.push_back(targets[0]);
+    const DecompositionTemplate table = cliffordTTemplate(type);
+    MatrixEdge op = makeIdentity();
+    for (const DecompositionStep *step = table.steps; step != table.steps + table.count; ++step) {
+        const Matrix2 m = fixedMatrix(step->type);
+        const QubitSet step_controls = (step->control == NO_SLOT) ? QubitSet{} : QubitSet{operands[step->control]};
+        op = multiply(makeGate({operands[step->target]}, m.data(), step_controls), op);
+    }
+    return op;
+}
+
+Complex DDPackage::amplitude(const VectorEdge &state, std::uint64_t index) const {
+    Complex w = state.weight;
+    std::uint32_t node = state.node;
+    while (node != 0) {
+        const Node<2> &n = this->vectors.nodes[node];
+        const std::size_t q = static_cast<std::size_t>(n.level);
+        const VectorEdge &e = n.edges[(q < 64) ? (index >> q) & 1 : 0];
+        w *= e.weight;
+        node = e.node;
+    }
+    return w;
+}
+
+Complex DDPackage::entry(const MatrixEdge &op, std::uint64_t row, std::uint64_t column) const {
+    Complex w = op.weight;
+    std::uint32_t node = op.node;
+    while (node != 0) {
+        const Node<4> &n = this->matrices.nodes[node];
+        const std::size_t q = static_cast<std::size_t>(n.level);
+        const MatrixEdge &e = n.edges[(q < 64) ? 2 * ((row >> q) & 1) + ((column >> q) & 1) : 0];
+        w *= e.weight;
+        node = e.node;
+    }
+    return w;
+}
+
+fp DDPackage::norm(const VectorEdge &edge, std::vector<fp> &norms) const {
+    if (edge.isZero()) {
+        return 0;
+    }
+    if (edge.node != 0 && norms[edge.node] < 0) {
+        const Node<2> &n = this->vectors.nodes[edge.node];
+        norms[edge.node] = norm(n.edges[0], norms) + norm(n.edges[1], norms);
+    }
+    return std::norm(edge.weight) * ((edge.node == 0) ? 1 : norms[edge.node]);
+}
+
+fp DDPackage::probability(const VectorEdge &state, Qubit qubit) const {
+    std::vector<fp> norms(this->vectors.nodes.size(), -1), ones(this->vectors.nodes.size(), -1);
+    // squared norm of the part with the qubit at 1, per node of unit weight
+    std::function<fp(const VectorEdge &)> one = [&](const VectorEdge &edge) -> fp {
+        if (edge.isZero() || edge.node == 0) {
+            return 0;
+        }
+        if (ones[edge.node] < 0) {
+            const Node<2> &n = this->vectors.nodes[edge.node];
+            ones[edge.node] = (static_cast<Qubit>(n.level) == qubit) ? norm(n.edges[1], norms) : one(n.edges[0]) + one(n.edges[1]);
+        }
+        return std::norm(edge.weight) * ones[edge.node];
+    };
+    const fp total = norm(state, norms);
+    return (total > 0) ? one(state) / total : 0;
+}
+
+template <std::size_t N>
+std::size_t DDPackage::countNodes(const NodeTable<N> &nodes, std::uint32_t root) const {
+    std::vector<bool> seen(nodes.nodes.size(), false);
+    std::vector<std::uint32_t> stack{root};
+    std::size_t count = 0;
+    while (!stack.empty()) {
+        const std::uint32_t node = stack.back();
+        stack.pop_back();
+        if (node == 0 || seen[node]) {
+            continue;
+        }
+        seen[node] = true;
+        ++count;
+        for (auto &e : nodes.nodes[node].edges) {
+            stack.push_back(e.node);
+        }
+    }
+    return count;
+}
+
+std::size_t DDPackage::nodeCount(const VectorEdge &edge) const { return countNodes(this->vectors, edge.node); }
+
+std::size_t DDPackage::nodeCount(const MatrixEdge &edge) const { return countNodes(this->matrices, edge.node); }
+
+DDSimulator::DDSimulator(std::size_t qubits, std::uint64_t seed, std::size_t gc_limit) : package(qubits, gc_limit), rng(seed) { reset(); }
+
+void DDSimulator::replace(const VectorEdge &next) {
+    this->package.incRef(next);
+    this->package.decRef(this->state);
+    this->state = next;
+    this->package.garbageCollect();
+}
+
+void DDSimulator::reset() {
+    replace(this->package.makeBasisState(0));
+    std::fill(this->cbits.begin(), this->cbits.end(), 0);
+}
+
+void DDSimulator::apply(QGate &gate) {
+    const gate_t type = gate.getType();
+    if (gate.getIsClassical() && !conditionHolds(gate, this->cbits, "DDSimulator::apply")) {
+        return;
+    }
+
+    auto &targets = gate.getTargets();
+    for (auto &qubits : {std::cref(gate.getControls()), std::cref(targets)}) {
+        for (auto q : qubits.get()) {
+            if (q >= getQubits()) {
+                throw QcoreException("[DDSimulator::apply] gate: " + toString(type) + " msg: qubit " + std::to_string(q) + " lies outside the register.");
+            }
+        }
+    }
+
+    switch (type) {
+        case GateType::MEASURE:
+            for (std::size_t i = 0; i < targets.size(); ++i) {
+                storeOutcome(this->cbits, gate, i, measure(targets[i]));
+            }
+            return;
+        case GateType::RESET:
+            for (auto q : targets) {
+                reset(q);
+            }
+            return;
+        case GateType::BARRIER:
+        case GateType::I:
+            return;
+        default:
+            break;
+    }
+    replace(this->package.multiply(this->package.makeGate(gate), this->state));
+}
+
+void DDSimulator::run(QCircuit &qc) {
+    if (qc.getQregSize() > getQubits()) {
+        throw QcoreException("[DDSimulator::run] simulation error msg: circuit of " + std::to_string(qc.getQregSize()) +
+                             " qubits exceeds the register of " + std::to_string(getQubits()) + " qubits.");
+    }
+    if (this->cbits.size() < qc.getCregSize()) {
+        this->cbits.resize(qc.getCregSize(), 0);
+    }
+    for (auto &gate : qc.getGates()) {
+        apply(*gate);
+    }
+}
+
+bool DDSimulator::measure(Qubit qubit) {
+    if (qubit >= getQubits()) {
+        throw QcoreException("[DDSimulator::measure] simulation error msg: qubit " + std::to_string(qubit) + " lies outside the register.");
+    }
+    const fp one = probability(qubit);
+    const bool outcome = std::uniform_real_distribution<fp>(0, 1)(this->rng) < one;
+    const fp norm = 1 / std::sqrt(outcome ? one : 1 - one);
+    const Matrix2 projector{outcome ? Complex{} : Complex{norm, 0}, Complex{}, Complex{}, outcome ? Complex{norm, 0} : Complex{}};
+    replace(this->package.multiply(this->package.makeGate({qubit}, projector.data()), this->state));
+    return outcome;
+}
+
+void DDSimulator::reset(Qubit qubit) {
+    if (measure(qubit)) {
+        const Matrix2 x = fixedMatrix(GateType::X);
+        replace(this->package.multiply(this->package.makeGate({qubit}, x.data()), this->state));
+    }
+}
+
+MatrixEdge buildUnitary(DDPackage &package, QCircuit &qc) {
+    if (qc.getQregSize() > package.getQubits()) {
+        throw QcoreException("[buildUnitary] simulation error msg: circuit of " + std::to_string(qc.getQregSize()) +
+                             " qubits exceeds the package of " + std::to_string(package.getQubits()) + " qubits.");
+    }
+    for (auto &gate : qc.getGates()) {
+        if (gate->getIsClassical() || !isSupportedUnitary(*gate)) {
+            throw QcoreException("[buildUnitary] gate: " + toString(gate->getType()) + " msg: not a supported unitary gate.");
+        }
+    }
+
+    MatrixEdge unitary = package.makeIdentity();
+    package.incRef(unitary);
+    for (auto &gate : qc.getGates()) {
+        const MatrixEdge next = package.multiply(package.makeGate(*gate), unitary);
+        package.incRef(next);
+        package.decRef(unitary);
+        unitary = next;
+        package.garbageCollect();
+    }
+    return unitary;
+}
+
+}  // namespace qcore
@@ -0,0 +1,291 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   GateFusion.cpp
+ *  @brief  Instance Description for the Gate Fusion Stage of the State-vector Simulator
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "simulate/GateFusion.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "decompose/Clifford_T.hpp"
+
+namespace qcore {
+
+namespace {
+
+constexpr std::size_t NO_BLOCK = std::numeric_limits<std::size_t>::max();
+
+/**
+ * @brief Gates collected for a block that may still grow
+ */
+struct OpenBlock {
+    QubitSet qubits{};
+    std::vector<QGate *> gates{};
+};
+
+inline fp lanesOf(const SimdLevel &simd) {
+    switch (simd) {
+        case SimdLevel::AVX512:
+            return 4;
+        case SimdLevel::AVX2:
+            return 2;
+        default:
+            return 1;
+    }
+}
+
+// cost of one call of the 2x2 kernels, following their choice by the matrix structure
+fp matrixCost(const Matrix2 &matrix, std::size_t controls, fp lanes, fp pass_cost) {
+    const Complex one{1, 0};
+    const fp fraction = std::ldexp(fp{1}, -static_cast<int>(controls));
+    if (matrix[1] == Complex{} && matrix[2] == Complex{}) {
+        const fp scaled = ((matrix[0] != one) ? 0.5 : 0) + ((matrix[3] != one) ? 0.5 : 0);
+        return fraction * scaled * (pass_cost + 1 / lanes);
+    }
+    if (matrix[0] == Complex{} && matrix[3] == Complex{}) {
+        return fraction * (pass_cost + 1 / lanes);
+    }
+    return fraction * (pass_cost + 2 / lanes);
+}
+
+// dense matrix of the gates of a block; layout is scratch indexed by circuit qubits
+void buildMatrix(const OpenBlock &open, FusedBlock &block, std::vector<Qubit> &layout) {
+    block.qubits = open.qubits;
+    std::sort(block.qubits.begin(), block.qubits.end());
+    for (std::size_t i = 0; i < block.qubits.size(); ++i) {
+        layout[block.qubits[i]] = i;
+    }
+
+    // column c of the matrix is the amplitude block c * dim of a register twice as wide,
+    // so every gate is applied to all columns by one call on the low qubits
+    const std::size_t k = block.qubits.size(), dim = std::size_t{1} << k;
+    std::vector<Complex> columns(dim * dim);
+    for (std::size_t c = 0; c < dim; ++c) {
+        columns[c * dim + c] = Complex{1, 0};
+    }
+    for (auto *gate : open.gates) {
+        applyGate(AmplitudeSpan{columns.data(), 2 * k}, *gate, SimdLevel::SCALAR, nullptr, layout.data());
+    }
+
+    block.matrix.resize(dim * dim);
+    for (std::size_t r = 0; r < dim; ++r) {
+        for (std::size_t c = 0; c < dim; ++c) {
+            block.matrix[r * dim + c] = columns[c * dim + r];
+        }
+    }
+    block.gates = open.gates.size();
+}
+
+}  // namespace
+
+fp gateCost(QGate &gate, const SimdLevel &simd, fp pass_cost) {
+    const fp lanes = lanesOf(simd);
+    const gate_t type = gate.getType();
+    auto &controls = gate.getControls();
+    const Matrix2 x = fixedMatrix(GateType::X);
+    switch (type) {
+        case GateType::BARRIER:
+        case GateType::I:
+            return 0;
+        case GateType::SWAP:
+        case GateType::CSWAP:
+            return std::ldexp(pass_cost / 2, -static_cast<int>(controls.size()));
+        case GateType::LCCX:
+        case GateType::LCCXDG:
+            return matrixCost(x, 2, lanes, pass_cost);
+        case GateType::PERES:
+        case GateType::PERESDG:
+            return matrixCost(x, 2, lanes, pass_cost) + matrixCost(x, 1, lanes, pass_cost);
+        default:
+            break;
+    }
+
+    Matrix2 matrix{};
+    if (tryTargetMatrix(gate, matrix)) {
+        return matrixCost(matrix, controls.size(), lanes, pass_cost);
+    }
+    Matrix4 matrix4{};
+    if (tryPairMatrix(gate, matrix4)) {
+        return pass_cost + 4 / lanes;
+    }
+    const DecompositionTemplate table = cliffordTTemplate(type);
+    if (table.steps != nullptr) {
+        fp cost = 0;
+        for (const DecompositionStep *step = table.steps; step != table.steps + table.count; ++step) {
+            cost += matrixCost(fixedMatrix(step->type), (step->control == NO_SLOT) ? 0 : 1, lanes, pass_cost);
+        }
+        return cost;
+    }
+    return pass_cost;
+}
+
+fp blockCost(const QubitSet &qubits, const SimdLevel &simd, fp pass_cost) {
+    if (qubits.empty()) {
+        return 0;
+    }
+    const Qubit lowest = *std::min_element(qubits.begin(), qubits.end());
+    const fp lanes = std::min(lanesOf(simd), std::ldexp(fp{1}, static_cast<int>(std::min<Qubit>(lowest, 2))));
+    return pass_cost + std::ldexp(fp{1}, static_cast<int>(qubits.size())) / lanes;
+}
+
+std::vector<SimulationStep> fuseGates(QCircuit &qc, std::size_t max_qubits, const SimdLevel &simd, fp pass_cost) {
+    if (max_qubits == 0 || max_qubits > MAX_DENSE_QUBITS) {
+        throw QcoreException("[fuseGates] simulation error msg: blocks of " + std::to_string(max_qubits) + " qubits, supported are 1 to " +
+                             std::to_string(MAX_DENSE_QUBITS) + ".");
+    }
+    const std::size_t n = qc.getQregSize();
+    std::vector<SimulationStep> steps{};
+    std::vector<OpenBlock> blocks{};
+    std::vector<std::size_t> available{};
+    std::vector<std::size_t> owner(n, NO_BLOCK);
+    std::vector<Qubit> layout(n, 0);
+
+    const auto close = [&](std::size_t b) {
+        OpenBlock &open = blocks[b];
+        fp separate = 0;
+        for (auto *gate : open.gates) {
+            separate += gateCost(*gate, simd, pass_cost);
+        }
+        if (open.gates.size() > 1 && blockCost(open.qubits, simd, pass_cost) < separate) {
+            SimulationStep step{};
+            buildMatrix(open, step.block, layout);
+            steps.push_back(std::move(step));
+        } else {
+            for (auto *gate : open.gates) {
+                steps.push_back(SimulationStep{gate, FusedBlock{}});
+            }
+        }
+        for (auto q : open.qubits) {
+            owner[q] = NO_BLOCK;
+        }
+        open.qubits.clear();
+        open.gates.clear();
+        available.push_back(b);
+    };
+
+    const auto merge = [&](std::size_t target, std::size_t b) {
+        OpenBlock &block = blocks[target], &other = blocks[b];
+        for (auto q : other.qubits) {
+            owner[q] = target;
+        }
+        block.qubits.insert(block.qubits.end(), other.qubits.begin(), other.qubits.end());
+        block.gates.insert(block.gates.end(), other.gates.begin(), other.gates.end());
+        other.qubits.clear();
+        other.gates.clear();
+        available.push_back(b);
+    };
+
+    // disjoint open blocks are packed first fit, largest first, before they are closed
+    const auto closeAll = [&]() {
+        std::vector<std::size_t> open{};
+        for (std::size_t b = 0; b < blocks.size(); ++b) {
+            if (!blocks[b].gates.empty()) {
+                open.push_back(b);
+            }
+        }
+        std::stable_sort(open.begin(), open.end(),
+                         [&blocks](std::size_t a, std::size_t b) { return blocks[a].qubits.size() > blocks[b].qubits.size(); });
+        for (std::size_t i = 0; i < open.size(); ++i) {
+            if (blocks[open[i]].gates.empty()) {
+                continue;
+            }
+            for (std::size_t j = i + 1; j < open.size(); ++j) {
+                if (!blocks[open[j]].gates.empty() && blocks[open[i]].qubits.size() + blocks[open[j]].qubits.size() <= max_qubits) {
+                    merge(open[i], open[j]);
+                }
+            }
+            close(open[i]);
+        }
+    };
+
+    QubitSet operands{};
+    std::vector<std::size_t> touched{};
+    for (auto &gate : qc.getGates()) {
+        if (gate->getType() == GateType::BARRIER) {
+            closeAll();
+            steps.push_back(SimulationStep{gate.get(), FusedBlock{}});
+            continue;
+        }
+
+        operands = gate->getControls();
+        operands.insert(operands.end(), gate->getTargets().begin(), gate->getTargets().end());
+        touched.clear();
+        bool inside = true;
+        std::size_t width = 0;
+        for (auto q : operands) {
+            if (q >= n) {
+                inside = false;
+            } else if (owner[q] == NO_BLOCK) {
+                ++width;
+            } else if (std::find(touched.begin(), touched.end(), owner[q]) == touched.end()) {
+                touched.push_back(owner[q]);
+                width += blocks[owner[q]].qubits.size();
+            }
+        }
+
+        const bool fusable = inside && !operands.empty() && operands.size() <= max_qubits && !gate->getIsClassical() && isSupportedUnitary(*gate);
+        if (!fusable || width > max_qubits) {
+            for (auto b : touched) {
+                close(b);
+            }
+            if (!fusable) {
+                steps.push_back(SimulationStep{gate.get(), FusedBlock{}});
+                continue;
+            }
+            touched.clear();
+        }
+
+        // the gate joins the union of the blocks it touches, or opens a new one
+        std::size_t target = NO_BLOCK;
+        if (!touched.empty()) {
+            target = touched[0];
+        } else if (!available.empty()) {
+            target = available.back();
+            available.pop_back();
+        } else {
+            target = blocks.size();
+            blocks.emplace_back();
+        }
+        for (std::size_t i = 1; i < touched.size(); ++i) {
+            merge(target, touched[i]);
+        }
+        OpenBlock &block = blocks[target];
+        for (auto q : operands) {
+            if (owner[q] == NO_BLOCK) {
+                owner[q] = target;
+                block.qubits.push_back(q);
+            }
+        }
+        block.gates.push_back(gate.get());
+    }
+
+    closeAll();
+    return steps;
+}
+
+}  // namespace qcore
@@ -0,0 +1,409 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Reversible.cpp
+ *  @brief  Instance Description for the Bit-Sliced Simulator for Reversible Circuits
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "simulate/Reversible.hpp"
+
+#include <algorithm>
+#include <string>
+
+#include "parallel/ThreadPool.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define QCORE_X86_SIMD 1
+#include <immintrin.h>
+#define QCORE_TARGET_AVX2 __attribute__((target("avx2")))
+#define QCORE_TARGET_AVX512 __attribute__((target("avx512f,avx2")))
+#define QCORE_FORCE_INLINE __attribute__((always_inline)) inline
+// the generic sweep is only ever inlined into kernels of its own target, so no
+// vector register crosses a call boundary
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+#else
+#define QCORE_FORCE_INLINE inline
+#endif
+
+namespace qcore {
+
+namespace {
+
+constexpr std::uint64_t ONES = ~std::uint64_t{0};
+
+// slices of the inputs 0 to 5 within a word: bit j holds bit i of j
+constexpr std::uint64_t INPUT_PATTERNS[6] = {0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL, 0xF0F0F0F0F0F0F0F0ULL,
+                                             0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL};
+
+struct ScalarWord {
+    using type = std::uint64_t;
+    static constexpr std::size_t WORDS = 1;
+
+    static inline type load(const std::uint64_t *p) { return *p; }
+    static inline void store(std::uint64_t *p, type a) { *p = a; }
+    static inline type ones() { return ONES; }
+    static inline type bitAnd(type a, type b) { return a & b; }
+    static inline type bitXor(type a, type b) { return a ^ b; }
+};
+
+#ifdef QCORE_X86_SIMD
+
+struct AVX2Word {
+    using type = __m256i;
+    static constexpr std::size_t WORDS = 4;
+
+    QCORE_TARGET_AVX2 static inline type load(const std::uint64_t *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+    QCORE_TARGET_AVX2 static inline void store(std::uint64_t *p, type a) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), a); }
+    QCORE_TARGET_AVX2 static inline type ones() { return _mm256_set1_epi64x(-1); }
+    QCORE_TARGET_AVX2 static inline type bitAnd(type a, type b) { return _mm256_and_si256(a, b); }
+    QCORE_TARGET_AVX2 static inline type bitXor(type a, type b) { return _mm256_xor_si256(a, b); }
+};
+
+struct AVX512Word {
+    using type = __m512i;
+    static constexpr std::size_t WORDS = 8;
+
+    QCORE_TARGET_AVX512 static inline type load(const std::uint64_t *p) { return _mm512_loadu_si512(p); }
+    QCORE_TARGET_AVX512 static inline void store(std::uint64_t *p, type a) { _mm512_storeu_si512(p, a); }
+    QCORE_TARGET_AVX512 static inline type ones() { return _mm512_set1_epi64(-1); }
+    QCORE_TARGET_AVX512 static inline type bitAnd(type a, type b) { return _mm512_and_si512(a, b); }
+    QCORE_TARGET_AVX512 static inline type bitXor(type a, type b) { return _mm512_xor_si512(a, b); }
+};
+
+#endif
+
+// applies the operations to the words [begin, end) of every slice, end - begin a multiple of Word::WORDS;
+// the common arities get their own loops so that the control count is not re-read per word
+template <class Word>
+QCORE_FORCE_INLINE void sweep(const ReversibleOperation *operations, std::size_t count, const Qubit *operands, std::uint64_t *slices, std::size_t stride,
+                              std::size_t begin, std::size_t end) {
+    using W = typename Word::type;
+    for (const ReversibleOperation *op = operations; op != operations + count; ++op) {
+        std::uint64_t *t = slices + op->target * stride;
+        const Qubit *c = operands + op->first;
+        if (op->exchange) {
+            std::uint64_t *u = slices + op->partner * stride;
+            for (std::size_t w = begin; w < end; w += Word::WORDS) {
+                W condition = Word::ones();
+                for (std::uint32_t k = 0; k < op->controls; ++k) {
+                    condition = Word::bitAnd(condition, Word::load(slices + c[k] * stride + w));
+                }
+                const W a = Word::load(t + w), b = Word::load(u + w);
+                const W flip = Word::bitAnd(Word::bitXor(a, b), condition);
+                Word::store(t + w, Word::bitXor(a, flip));
+                Word::store(u + w, Word::bitXor(b, flip));
+            }
+            continue;
+        }
+        switch (op->controls) {
+            case 0:
+                for (std::size_t w = begin; w < end; w += Word::WORDS) {
+                    Word::store(t + w, Word::bitXor(Word::load(t + w), Word::ones()));
+                }
+                break;
+            case 1: {
+                const std::uint64_t *c0 = slices + c[0] * stride;
+                for (std::size_t w = begin; w < end; w += Word::WORDS) {
+                    Word::store(t + w, Word::bitXor(Word::load(t + w), Word::load(c0 + w)));
+                }
+                break;
+            }
+            case 2: {
+                const std::uint64_t *c0 = slices + c[0] * stride, *c1 = slices + c[1] * stride;
+                for (std::size_t w = begin; w < end; w += Word::WORDS) {
+                    Word::store(t + w, Word::bitXor(Word::load(t + w), Word::bitAnd(Word::load(c0 + w), Word::load(c1 + w))));
+                }
+                break;
+            }
+            default:
+                for (std::size_t w = begin; w < end; w += Word::WORDS) {
+                    W condition = Word::load(slices + c[0] * stride + w);
+                    for (std::uint32_t k = 1; k < op->controls; ++k) {
+                        condition = Word::bitAnd(condition, Word::load(slices + c[k] * stride + w));
+                    }
+                    Word::store(t + w, Word::bitXor(Word::load(t + w), condition));
+                }
+                break;
+        }
+    }
+}
+
+using SweepKernel = void (*)(const ReversibleOperation *, std::size_t, const Qubit *, std::uint64_t *, std::size_t, std::size_t, std::size_t);
+
+void sweepScalar(const ReversibleOperation *operations, std::size_t count, const Qubit *operands, std::uint64_t *slices, std::size_t stride,
+                 std::size_t begin, std::size_t end) {
+    sweep<ScalarWord>(operations, count, operands, slices, stride, begin, end);
+}
+
+#ifdef QCORE_X86_SIMD
+
+QCORE_TARGET_AVX2 void sweepAVX2(const ReversibleOperation *operations, std::size_t count, const Qubit *operands, std::uint64_t *slices,
+                                 std::size_t stride, std::size_t begin, std::size_t end) {
+    sweep<AVX2Word>(operations, count, operands, slices, stride, begin, end);
+}
+
+QCORE_TARGET_AVX512 void sweepAVX512(const ReversibleOperation *operations, std::size_t count, const Qubit *operands, std::uint64_t *slices,
+                                     std::size_t stride, std::size_t begin, std::size_t end) {
+    sweep<AVX512Word>(operations, count, operands, slices, stride, begin, end);
+}
+
+#endif
+
+// the kernel of an instruction set and the number of words it handles at once
+std::pair<SweepKernel, std::size_t> sweepKernel(const SimdLevel &simd) {
+#ifdef QCORE_X86_SIMD
+    switch (simd) {
+        case SimdLevel::AVX512:
+            return {sweepAVX512, AVX512Word::WORDS};
+        case SimdLevel::AVX2:
+            return {sweepAVX2, AVX2Word::WORDS};
+        default:
+            break;
+    }
+#endif
+    return {sweepScalar, ScalarWord::WORDS};
+}
+
+void checkInputs(const QubitSet &inputs, std::size_t qubits, const std::string &func) {
+    if (inputs.size() > 63) {
+        throw QcoreException("[" + func + "] simulation error msg: " + std::to_string(inputs.size()) + " inputs exceed the limit of 63.");
+    }
+    std::vector<bool> seen(qubits, false);
+    for (auto q : inputs) {
+        if (q >= qubits || seen[q]) {
+            throw QcoreException("[" + func + "] simulation error msg: input qubit " + std::to_string(q) + " is repeated or outside the circuit.");
+        }
+        seen[q] = true;
+    }
+}
+
+}  // namespace
+
+bool isReversibleGate(QGate &gate) {
+    if (gate.getIsClassical()) {
+        return false;
+    }
+    auto &controls = gate.getControls();
+    auto &targets = gate.getTargets();
+    std::size_t expected_targets = 1;
+    switch (gate.getType()) {
+        case GateType::I:
+        case GateType::BARRIER:
+            return true;
+        case GateType::X:
+        case GateType::CX:
+        case GateType::CCX:
+        case GateType::MCX:
+        case GateType::LCCX:
+        case GateType::LCCXDG:
+            break;
+        case GateType::PERES:
+        case GateType::PERESDG:
+            if (controls.size() != 2) {
+                return false;
+            }
+            break;
+        case GateType::SWAP:
+        case GateType::CSWAP:
+            expected_targets = 2;
+            break;
+        default:
+            return false;
+    }
+    if (targets.size() != expected_targets) {
+        return false;
+    }
+    // an operand appearing twice would not be a permutation of the slices
+    QubitSet qubits(controls.begin(), controls.end());
+    qubits.insert(qubits.end(), targets.begin(), targets.end());
+    std::sort(qubits.begin(), qubits.end());
+    return std::adjacent_find(qubits.begin(), qubits.end()) == qubits.end();
+}
+
+bool isReversibleCircuit(QCircuit &qc) {
+    return std::all_of(qc.getGates().begin(), qc.getGates().end(), [](const std::unique_ptr<QGate> &gate) { return isReversibleGate(*gate); });
+}
+
+ReversibleSimulator::ReversibleSimulator(QCircuit &qc, SimdLevel simd) : qubits(qc.getQregSize()), simd(simd) {
+    auto flip = [this](const QubitSet &controls, Qubit target) {
+        ReversibleOperation op{};
+        op.first = static_cast<std::uint32_t>(this->operands.size());
+        op.controls = static_cast<std::uint32_t>(controls.size());
+        op.target = target;
+        this->operands.insert(this->operands.end(), controls.begin(), controls.end());
+        this->operations.push_back(op);
+    };
+
+    for (auto &gate : qc.getGates()) {
+        const gate_t type = gate->getType();
+        if (!isReversibleGate(*gate)) {
+            throw QcoreException("[ReversibleSimulator] gate: " + toString(type) + " msg: not a reversible gate.");
+        }
+        auto &controls = gate->getControls();
+        auto &targets = gate->getTargets();
+        for (auto &operand_set : {std::cref(controls), std::cref(targets)}) {
+            for (auto q : operand_set.get()) {
+                if (q >= this->qubits) {
+                    throw QcoreException("[ReversibleSimulator] gate: " + toString(type) + " msg: qubit " + std::to_string(q) +
+                                         " lies outside the register.");
+                }
+            }
+        }
+
+        switch (type) {
+            case GateType::I:
+            case GateType::BARRIER:
+                break;
+            case GateType::SWAP:
+            case GateType::CSWAP:
+                flip(controls, targets[0]);
+                this->operations.back().partner = targets[1];
+                this->operations.back().exchange = true;
+                break;
+            case GateType::PERES:
+            case GateType::PERESDG:
+                // CCX(a, b, c) followed by CX(a, b), or the reverse
+                if (type == GateType::PERESDG) {
+                    flip({controls[0]}, controls[1]);
+                }
+                flip(controls, targets[0]);
+                if (type == GateType::PERES) {
+                    flip({controls[0]}, controls[1]);
+                }
+                break;
+            default:
+                flip(controls, targets[0]);
+                break;
+        }
+    }
+}
+
+void ReversibleSimulator::evaluate(std::uint64_t *slices, std::size_t words) const {
+    const ReversibleOperation *operations = this->operations.data();
+    const auto kernel = sweepKernel(this->simd);
+    for (std::size_t begin = 0; begin < words; begin += SLICE_WORDS) {
+        const std::size_t end = std::min(words, begin + SLICE_WORDS);
+        const std::size_t vector_end = begin + (end - begin) / kernel.second * kernel.second;
+        if (vector_end > begin) {
+            kernel.first(operations, this->operations.size(), this->operands.data(), slices, words, begin, vector_end);
+        }
+        if (vector_end < end) {
+            sweepScalar(operations, this->operations.size(), this->operands.data(), slices, words, vector_end, end);
+        }
+    }
+}
+
+std::vector<std::uint64_t> ReversibleSimulator::run(const std::vector<std::uint64_t> &states) const {
+    if (this->qubits > 64) {
+        throw QcoreException("[ReversibleSimulator::run] simulation error msg: " + std::to_string(this->qubits) +
+                             " qubits do not fit in 64-bit basis states.");
+    }
+    std::vector<std::uint64_t> outputs(states.size(), 0), slices(this->qubits * SLICE_WORDS);
+    for (std::size_t first = 0; first < states.size(); first += 64 * SLICE_WORDS) {
+        const std::size_t count = std::min(states.size() - first, 64 * SLICE_WORDS), words = (count + 63) / 64;
+        std::fill(slices.begin(), slices.end(), 0);
+        for (std::size_t i = 0; i < count; ++i) {
+            for (std::size_t q = 0; q < this->qubits; ++q) {
+                slices[q * words + (i >> 6)] |= ((states[first + i] >> q) & 1) << (i & 63);
+            }
+        }
+        evaluate(slices.data(), words);
+        for (std::size_t i = 0; i < count; ++i) {
+            for (std::size_t q = 0; q < this->qubits; ++q) {
+                outputs[first + i] |= ((slices[q * words + (i >> 6)] >> (i & 63)) & 1) << q;
+            }
+        }
+    }
+    return outputs;
+}
+
+void ReversibleSimulator::enumerate(const QubitSet &inputs, const std::function<void(const SliceBatch &)> &visitor, std::size_t threads) const {
+    checkInputs(inputs, this->qubits, "ReversibleSimulator::enumerate");
+    const std::uint64_t assignments = std::uint64_t{1} << inputs.size();
+    const std::uint64_t total_words = (assignments + 63) / 64;
+    const std::uint64_t batches = (total_words + SLICE_WORDS - 1) / SLICE_WORDS;
+
+    auto evaluateBatches = [&](std::size_t first_batch, std::size_t last_batch) {
+        std::vector<std::uint64_t> slices(this->qubits * SLICE_WORDS);
+        for (std::size_t b = first_batch; b < last_batch; ++b) {
+            const std::uint64_t first_word = b * SLICE_WORDS;
+            const std::size_t words = static_cast<std::size_t>(std::min<std::uint64_t>(SLICE_WORDS, total_words - first_word));
+            std::fill(slices.begin(), slices.begin() + this->qubits * words, 0);
+            for (std::size_t i = 0; i < inputs.size(); ++i) {
+                std::uint64_t *slice = slices.data() + inputs[i] * words;
+                for (std::size_t w = 0; w < words; ++w) {
+                    slice[w] = (i < 6) ? INPUT_PATTERNS[i] : ((((first_word + w) >> (i - 6)) & 1) != 0) ? ONES : 0;
+                }
+            }
+            evaluate(slices.data(), words);
+
+            SliceBatch batch{};
+            batch.first = 64 * first_word;
+            batch.count = std::min<std::uint64_t>(64 * words, assignments - batch.first);
+            batch.words = words;
+            batch.slices = slices.data();
+            visitor(batch);
+        }
+    };
+
+    const std::size_t workers = resolveThreads(threads);
+    if (workers <= 1 || batches <= 1) {
+        evaluateBatches(0, batches);
+        return;
+    }
+    ThreadPool pool(workers);
+    parallelFor(pool, batches, evaluateBatches);
+}
+
+TruthTable ReversibleSimulator::truthTable(const QubitSet &inputs, std::size_t threads) const {
+    checkInputs(inputs, this->qubits, "ReversibleSimulator::truthTable");
+    TruthTable table{};
+    table.inputs = inputs.size();
+    table.qubits = this->qubits;
+    const std::uint64_t words = ((std::uint64_t{1} << inputs.size()) + 63) / 64;
+    if (this->qubits > 0 && words > table.bits.max_size() / this->qubits) {
+        throw QcoreException("[ReversibleSimulator::truthTable] simulation error msg: the table of " + std::to_string(inputs.size()) +
+                             " inputs does not fit in memory.");
+    }
+    table.words = static_cast<std::size_t>(words);
+    table.bits.assign(this->qubits * table.words, 0);
+
+    // batches cover disjoint words of the table
+    enumerate(
+        inputs,
+        [&table](const SliceBatch &batch) {
+            const std::uint64_t mask = (batch.count < 64) ? (std::uint64_t{1} << batch.count) - 1 : ONES;
+            for (std::size_t q = 0; q < table.qubits; ++q) {
+                std::uint64_t *row = table.bits.data() + q * table.words + batch.first / 64;
+                std::copy(batch.slices + q * batch.words, batch.slices + (q + 1) * batch.words, row);
+                row[0] &= mask;
+            }
+        },
+        threads);
+    return table;
+}
+
+}  // namespace qcore
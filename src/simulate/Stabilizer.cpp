@@ -0,0 +1,177 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Stabilizer.cpp
+ *  @brief  Instance Description for the Stabilizer Tableau Simulator for Clifford Circuits
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "simulate/Stabilizer.hpp"
+
+#include <algorithm>
+#include <string>
+
+#include "simulate/ClassicalBits.hpp"
+
+namespace qcore {
+
+bool isStabilizerGate(QGate &gate) {
+    const auto controls = gate.getControls().size(), targets = gate.getTargets().size();
+    switch (gate.getType()) {
+        case GateType::H:
+        case GateType::S:
+        case GateType::SDG:
+        case GateType::SX:
+        case GateType::SXDG:
+        case GateType::X:
+        case GateType::Y:
+        case GateType::Z:
+        case GateType::I:
+            return controls == 0 && targets == 1;
+        case GateType::CX:
+        case GateType::CY:
+        case GateType::CZ:
+            return controls == 1 && targets == 1 && gate.getControls()[0] != gate.getTargets()[0];
+        case GateType::SWAP:
+            return controls == 0 && targets == 2 && gate.getTargets()[0] != gate.getTargets()[1];
+        case GateType::MEASURE:
+        case GateType::RESET:
+        case GateType::BARRIER:
+            return controls == 0;
+        default:
+            return false;
+    }
+}
+
+bool isStabilizerCircuit(QCircuit &qc) {
+    return std::all_of(qc.getGates().begin(), qc.getGates().end(), [](const std::unique_ptr<QGate> &gate) { return isStabilizerGate(*gate); });
+}
+
+StabilizerSimulator::StabilizerSimulator(std::size_t qubits, std::uint64_t seed) : tableau(qubits), rng(seed) {}
+
+void StabilizerSimulator::reset() {
+    this->tableau = CliffordTableau(this->tableau.size());
+    std::fill(this->cbits.begin(), this->cbits.end(), 0);
+}
+
+void StabilizerSimulator::apply(QGate &gate) {
+    const gate_t type = gate.getType();
+    if (!isStabilizerGate(gate)) {
+        throw QcoreException("[StabilizerSimulator::apply] gate: " + toString(type) + " msg: unsupported gate.");
+    }
+    if (gate.getIsClassical() && !conditionHolds(gate, this->cbits, "StabilizerSimulator::apply")) {
+        return;
+    }
+
+    auto &targets = gate.getTargets();
+    for (auto &qubits : {std::cref(gate.getControls()), std::cref(targets)}) {
+        for (auto q : qubits.get()) {
+            if (q >= this->tableau.size()) {
+                throw QcoreException("[StabilizerSimulator::apply] gate: " + toString(type) + " msg: qubit " + std::to_string(q) +
+                                     " lies outside the register.");
+            }
+        }
+    }
+
+    const Qubit t = targets.empty() ? 0 : targets[0];
+    switch (type) {
+        case GateType::H:
+            this->tableau.h(t);
+            break;
+        case GateType::S:
+            this->tableau.s(t);
+            break;
+        case GateType::SDG:
+            this->tableau.sdg(t);
+            break;
+        case GateType::SX:
+        case GateType::SXDG:
+            // H S H and H S^dagger H
+            this->tableau.h(t);
+            (type == GateType::SX) ? this->tableau.s(t) : this->tableau.sdg(t);
+            this->tableau.h(t);
+            break;
+        case GateType::X:
+            this->tableau.x(t);
+            break;
+        case GateType::Y:
+            this->tableau.y(t);
+            break;
+        case GateType::Z:
+            this->tableau.z(t);
+            break;
+        case GateType::CX:
+            this->tableau.cx(gate.getControls()[0], t);
+            break;
+        case GateType::CY:
+            this->tableau.cy(gate.getControls()[0], t);
+            break;
+        case GateType::CZ:
+            this->tableau.cz(gate.getControls()[0], t);
+            break;
+        case GateType::SWAP:
+            this->tableau.swap(t, targets[1]);
+            break;
+        case GateType::MEASURE:
+            for (std::size_t i = 0; i < targets.size(); ++i) {
+                storeOutcome(this->cbits, gate, i, measure(targets[i]));
+            }
+            break;
+        case GateType::RESET:
+            for (auto q : targets) {
+                reset(q);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void StabilizerSimulator::run(QCircuit &qc) {
+    if (qc.getQregSize() > this->tableau.size()) {
+        throw QcoreException("[StabilizerSimulator::run] simulation error msg: circuit of " + std::to_string(qc.getQregSize()) +
+                             " qubits exceeds the register of " + std::to_string(this->tableau.size()) + " qubits.");
+    }
+    if (this->cbits.size() < qc.getCregSize()) {
+        this->cbits.resize(qc.getCregSize(), 0);
+    }
+    for (auto &gate : qc.getGates()) {
+        apply(*gate);
+    }
+}
+
+bool StabilizerSimulator::measure(Qubit qubit) {
+    if (qubit >= this->tableau.size()) {
+        throw QcoreException("[StabilizerSimulator::measure] simulation error msg: qubit " + std::to_string(qubit) + " lies outside the register.");
+    }
+    const bool coin = (this->rng() & 1) != 0;
+    return this->tableau.measure(qubit, coin);
+}
+
+void StabilizerSimulator::reset(Qubit qubit) {
+    if (measure(qubit)) {
+        this->tableau.x(qubit);
+    }
+}
+
+}  // namespace qcore
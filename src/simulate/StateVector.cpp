@@ -0,0 +1,1072 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   StateVector.cpp
+ *  @brief  Instance Description for the SIMD State-vector Simulator
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "simulate/StateVector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cmath>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <string>
+
+#include "decompose/Clifford_T.hpp"
+#include "simulate/ClassicalBits.hpp"
+#include "simulate/GateFusion.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define QCORE_X86_SIMD 1
+#include <immintrin.h>
+#define QCORE_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define QCORE_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+#endif
+
+namespace qcore {
+
+namespace {
+
+// amplitudes per task, smaller states are simulated serially
+constexpr std::size_t PARALLEL_GRAIN = std::size_t{1} << 14;
+
+// longest contiguous run handed to a kernel, so that long runs still split over tasks
+constexpr std::size_t MAX_RUN = std::size_t{1} << 12;
+
+using MatrixKernel = void (*)(Complex *, Complex *, std::size_t, const Matrix2 &);
+using AdjacentKernel = void (*)(Complex *, std::size_t, const Matrix2 &);
+using ScaleKernel = void (*)(Complex *, std::size_t, Complex);
+using Matrix4Kernel = void (*)(Complex *const *, std::size_t, const Matrix4 &);
+using DenseKernel = void (*)(Complex *, const std::size_t *, std::size_t, std::size_t, const Complex *);
+
+/**
+ * @brief Kernels of an instruction set, each working on contiguous runs of amplitudes
+ *
+ * @details matrix applies a 2x2 matrix to the pairs (p0[i], p1[i]), adjacent to the pairs
+ *          (p[2i], p[2i + 1]), scale multiplies a run by a factor and matrix4 applies a 4x4
+ *          matrix to the quadruples (p[0][i], ..., p[3][i]) and dense a row-major dim x dim
+ *          matrix to the vectors (p[offsets[0] + i], ..., p[offsets[dim - 1] + i]).
+ */
+struct Kernels {
+    MatrixKernel matrix;
+    AdjacentKernel adjacent;
+    ScaleKernel scale;
+    Matrix4Kernel matrix4;
+    DenseKernel dense;
+};
+
+constexpr std::size_t MAX_DENSE_DIM = std::size_t{1} << MAX_DENSE_QUBITS;
+
+// complex product without the NaN recovery of std::complex, which blocks vectorization
+inline Complex multiply(const Complex &lhs, const Complex &rhs) {
+    return Complex{lhs.real() * rhs.real() - lhs.imag() * rhs.imag(), lhs.real() * rhs.imag() + lhs.imag() * rhs.real()};
+}
+
+void matrixScalar(Complex *p0, Complex *p1, std::size_t n, const Matrix2 &m) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const Complex a0 = p0[i], a1 = p1[i];
+        p0[i] = multiply(m[0], a0) + multiply(m[1], a1);
+        p1[i] = multiply(m[2], a0) + multiply(m[3], a1);
+    }
+}
+
+void adjacentScalar(Complex *p, std::size_t pairs, const Matrix2 &m) {
+    for (std::size_t i = 0; i < pairs; ++i) {
+        const Complex a0 = p[2 * i], a1 = p[2 * i + 1];
+        p[2 * i] = multiply(m[0], a0) + multiply(m[1], a1);
+        p[2 * i + 1] = multiply(m[2], a0) + multiply(m[3], a1);
+    }
+}
+
+void scaleScalar(Complex *p, std::size_t n, Complex factor) {
+    for (std::size_t i = 0; i < n; ++i) {
+        p[i] = multiply(factor, p[i]);
+    }
+}
+
+void matrix4Scalar(Complex *const *p, std::size_t n, const Matrix4 &m) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const Complex a[4] = {p[0][i], p[1][i], p[2][i], p[3][i]};
+        for (std::size_t r = 0; r < 4; ++r) {
+            p[r][i] = multiply(m[4 * r], a[0]) + multiply(m[4 * r + 1], a[1]) + multiply(m[4 * r + 2], a[2]) + multiply(m[4 * r + 3], a[3]);
+        }
+    }
+}
+
+void denseScalar(Complex *p, const std::size_t *offsets, std::size_t dim, std::size_t n, const Complex *m) {
+    // plain arrays, as a Complex array would be zeroed on every call
+    double re[MAX_DENSE_DIM], im[MAX_DENSE_DIM];
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t c = 0; c < dim; ++c) {
+            re[c] = p[offsets[c] + i].real();
+            im[c] = p[offsets[c] + i].imag();
+        }
+        for (std::size_t r = 0; r < dim; ++r) {
+            const Complex *row = m + r * dim;
+            double sum_re = 0, sum_im = 0;
+            for (std::size_t c = 0; c < dim; ++c) {
+                sum_re += row[c].real() * re[c] - row[c].imag() * im[c];
+                sum_im += row[c].real() * im[c] + row[c].imag() * re[c];
+            }
+            p[offsets[r] + i] = Complex{sum_re, sum_im};
+        }
+    }
+}
+
+constexpr Kernels SCALAR_KERNELS{matrixScalar, adjacentScalar, scaleScalar, matrix4Scalar, denseScalar};
+
+#ifdef QCORE_X86_SIMD
+
+// (re + i im) * a for interleaved complex lanes: the swapped lanes times im are
+// subtracted from the real and added to the imaginary parts
+QCORE_TARGET_AVX2 inline __m256d multiply256(__m256d re, __m256d im, __m256d a) {
+    return _mm256_fmaddsub_pd(re, a, _mm256_mul_pd(im, _mm256_permute_pd(a, 0x5)));
+}
+
+QCORE_TARGET_AVX2 void matrixAVX2(Complex *p0, Complex *p1, std::size_t n, const Matrix2 &m) {
+    __m256d re[4], im[4];
+    for (std::size_t k = 0; k < 4; ++k) {
+        re[k] = _mm256_set1_pd(m[k].real());
+        im[k] = _mm256_set1_pd(m[k].imag());
+    }
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        double *x0 = reinterpret_cast<double *>(p0 + i), *x1 = reinterpret_cast<double *>(p1 + i);
+        const __m256d a0 = _mm256_loadu_pd(x0), a1 = _mm256_loadu_pd(x1);
+        _mm256_storeu_pd(x0, _mm256_add_pd(multiply256(re[0], im[0], a0), multiply256(re[1], im[1], a1)));
+        _mm256_storeu_pd(x1, _mm256_add_pd(multiply256(re[2], im[2], a0), multiply256(re[3], im[3], a1)));
+    }
+    matrixScalar(p0 + i, p1 + i, n - i, m);
+}
+
+QCORE_TARGET_AVX2 void adjacentAVX2(Complex *p, std::size_t pairs, const Matrix2 &m) {
+    // lanes [a0, a1] times [m00, m11] plus the swapped lanes [a1, a0] times [m01, m10]
+    const __m256d diagonal_re = _mm256_setr_pd(m[0].real(), m[0].real(), m[3].real(), m[3].real());
+    const __m256d diagonal_im = _mm256_setr_pd(m[0].imag(), m[0].imag(), m[3].imag(), m[3].imag());
+    const __m256d off_re = _mm256_setr_pd(m[1].real(), m[1].real(), m[2].real(), m[2].real());
+    const __m256d off_im = _mm256_setr_pd(m[1].imag(), m[1].imag(), m[2].imag(), m[2].imag());
+    for (std::size_t i = 0; i < pairs; ++i) {
+        double *x = reinterpret_cast<double *>(p + 2 * i);
+        const __m256d a = _mm256_loadu_pd(x);
+        const __m256d swapped = _mm256_permute2f128_pd(a, a, 0x01);
+        _mm256_storeu_pd(x, _mm256_add_pd(multiply256(diagonal_re, diagonal_im, a), multiply256(off_re, off_im, swapped)));
+    }
+}
+
+QCORE_TARGET_AVX2 void scaleAVX2(Complex *p, std::size_t n, Complex factor) {
+    const __m256d re = _mm256_set1_pd(factor.real()), im = _mm256_set1_pd(factor.imag());
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        double *x = reinterpret_cast<double *>(p + i);
+        _mm256_storeu_pd(x, multiply256(re, im, _mm256_loadu_pd(x)));
+    }
+    scaleScalar(p + i, n - i, factor);
+}
+
+QCORE_TARGET_AVX2 void matrix4AVX2(Complex *const *p, std::size_t n, const Matrix4 &m) {
+    __m256d re[16], im[16];
+    for (std::size_t k = 0; k < 16; ++k) {
+        re[k] = _mm256_set1_pd(m[k].real());
+        im[k] = _mm256_set1_pd(m[k].imag());
+    }
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m256d a[4];
+        for (std::size_t c = 0; c < 4; ++c) {
+            a[c] = _mm256_loadu_pd(reinterpret_cast<double *>(p[c] + i));
+        }
+        for (std::size_t r = 0; r < 4; ++r) {
+            __m256d sum = multiply256(re[4 * r], im[4 * r], a[0]);
+            for (std::size_t c = 1; c < 4; ++c) {
+                sum = _mm256_add_pd(sum, multiply256(re[4 * r + c], im[4 * r + c], a[c]));
+            }
+            _mm256_storeu_pd(reinterpret_cast<double *>(p[r] + i), sum);
+        }
+    }
+    Complex *const tail[4] = {p[0] + i, p[1] + i, p[2] + i, p[3] + i};
+    matrix4Scalar(tail, n - i, m);
+}
+
+// the real parts of a row times the amplitudes and the imaginary parts times the swapped
+// amplitudes are accumulated apart and combined once per row
+QCORE_TARGET_AVX2 void denseAVX2(Complex *p, const std::size_t *offsets, std::size_t dim, std::size_t n, const Complex *m) {
+    const double *entries = reinterpret_cast<const double *>(m);
+    __m256d a[MAX_DENSE_DIM], swapped[MAX_DENSE_DIM];
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        for (std::size_t c = 0; c < dim; ++c) {
+            a[c] = _mm256_loadu_pd(reinterpret_cast<double *>(p + offsets[c] + i));
+            swapped[c] = _mm256_permute_pd(a[c], 0x5);
+        }
+        for (std::size_t r = 0; r < dim; ++r) {
+            const double *row = entries + 2 * r * dim;
+            __m256d real = _mm256_setzero_pd(), imag = _mm256_setzero_pd();
+            for (std::size_t c = 0; c < dim; ++c) {
+                real = _mm256_fmadd_pd(_mm256_broadcast_sd(row + 2 * c), a[c], real);
+                imag = _mm256_fmadd_pd(_mm256_broadcast_sd(row + 2 * c + 1), swapped[c], imag);
+            }
+            _mm256_storeu_pd(reinterpret_cast<double *>(p + offsets[r] + i), _mm256_addsub_pd(real, imag));
+        }
+    }
+    denseScalar(p + i, offsets, dim, n - i, m);
+}
+
+// the masked permutes take a as the pass-through source, which the unmasked forms leave undefined
+QCORE_TARGET_AVX512 inline __m512d multiply512(__m512d re, __m512d im, __m512d a) {
+    return _mm512_fmaddsub_pd(re, a, _mm512_mul_pd(im, _mm512_mask_permute_pd(a, 0xFF, a, 0x55)));
+}
+
+QCORE_TARGET_AVX512 void matrixAVX512(Complex *p0, Complex *p1, std::size_t n, const Matrix2 &m) {
+    __m512d re[4], im[4];
+    for (std::size_t k = 0; k < 4; ++k) {
+        re[k] = _mm512_set1_pd(m[k].real());
+        im[k] = _mm512_set1_pd(m[k].imag());
+    }
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        double *x0 = reinterpret_cast<double *>(p0 + i), *x1 = reinterpret_cast<double *>(p1 + i);
+        const __m512d a0 = _mm512_loadu_pd(x0), a1 = _mm512_loadu_pd(x1);
+        _mm512_storeu_pd(x0, _mm512_add_pd(multiply512(re[0], im[0], a0), multiply512(re[1], im[1], a1)));
+        _mm512_storeu_pd(x1, _mm512_add_pd(multiply512(re[2], im[2], a0), multiply512(re[3], im[3], a1)));
+    }
+    matrixAVX2(p0 + i, p1 + i, n - i, m);
+}
+
+QCORE_TARGET_AVX512 void adjacentAVX512(Complex *p, std::size_t pairs, const Matrix2 &m) {
+    const __m512d diagonal_re = _mm512_setr_pd(m[0].real(), m[0].real(), m[3].real(), m[3].real(), m[0].real(), m[0].real(), m[3].real(), m[3].real());
+    const __m512d diagonal_im = _mm512_setr_pd(m[0].imag(), m[0].imag(), m[3].imag(), m[3].imag(), m[0].imag(), m[0].imag(), m[3].imag(), m[3].imag());
+    const __m512d off_re = _mm512_setr_pd(m[1].real(), m[1].real(), m[2].real(), m[2].real(), m[1].real(), m[1].real(), m[2].real(), m[2].real());
+    const __m512d off_im = _mm512_setr_pd(m[1].imag(), m[1].imag(), m[2].imag(), m[2].imag(), m[1].imag(), m[1].imag(), m[2].imag(), m[2].imag());
+    std::size_t i = 0;
+    for (; i + 2 <= pairs; i += 2) {
+        double *x = reinterpret_cast<double *>(p + 2 * i);
+        const __m512d a = _mm512_loadu_pd(x);
+        const __m512d swapped = _mm512_mask_permutex_pd(a, 0xFF, a, 0x4E);
+        _mm512_storeu_pd(x, _mm512_add_pd(multiply512(diagonal_re, diagonal_im, a), multiply512(off_re, off_im, swapped)));
+    }
+    adjacentAVX2(p + 2 * i, pairs - i, m);
+}
+
+QCORE_TARGET_AVX512 void scaleAVX512(Complex *p, std::size_t n, Complex factor) {
+    const __m512d re = _mm512_set1_pd(factor.real()), im = _mm512_set1_pd(factor.imag());
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        double *x = reinterpret_cast<double *>(p + i);
+        _mm512_storeu_pd(x, multiply512(re, im, _mm512_loadu_pd(x)));
+    }
+    scaleAVX2(p + i, n - i, factor);
+}
+
+QCORE_TARGET_AVX512 void matrix4AVX512(Complex *const *p, std::size_t n, const Matrix4 &m) {
+    __m512d re[16], im[16];
+    for (std::size_t k = 0; k < 16; ++k) {
+        re[k] = _mm512_set1_pd(m[k].real());
+        im[k] = _mm512_set1_pd(m[k].imag());
+    }
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m512d a[4];
+        for (std::size_t c = 0; c < 4; ++c) {
+            a[c] = _mm512_loadu_pd(reinterpret_cast<double *>(p[c] + i));
+        }
+        for (std::size_t r = 0; r < 4; ++r) {
+            __m512d sum = multiply512(re[4 * r], im[4 * r], a[0]);
+            for (std::size_t c = 1; c < 4; ++c) {
+                sum = _mm512_add_pd(sum, multiply512(re[4 * r + c], im[4 * r + c], a[c]));
+            }
+            _mm512_storeu_pd(reinterpret_cast<double *>(p[r] + i), sum);
+        }
+    }
+    Complex *const tail[4] = {p[0] + i, p[1] + i, p[2] + i, p[3] + i};
+    matrix4AVX2(tail, n - i, m);
+}
+
+QCORE_TARGET_AVX512 void denseAVX512(Complex *p, const std::size_t *offsets, std::size_t dim, std::size_t n, const Complex *m) {
+    const double *entries = reinterpret_cast<const double *>(m);
+    const __m512d ones = _mm512_set1_pd(1);
+    __m512d a[MAX_DENSE_DIM], swapped[MAX_DENSE_DIM];
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        for (std::size_t c = 0; c < dim; ++c) {
+            a[c] = _mm512_loadu_pd(reinterpret_cast<double *>(p + offsets[c] + i));
+            swapped[c] = _mm512_mask_permute_pd(a[c], 0xFF, a[c], 0x55);
+        }
+        for (std::size_t r = 0; r < dim; ++r) {
+            const double *row = entries + 2 * r * dim;
+            __m512d real = _mm512_setzero_pd(), imag = _mm512_setzero_pd();
+            for (std::size_t c = 0; c < dim; ++c) {
+                real = _mm512_fmadd_pd(_mm512_set1_pd(row[2 * c]), a[c], real);
+                imag = _mm512_fmadd_pd(_mm512_set1_pd(row[2 * c + 1]), swapped[c], imag);
+            }
+            _mm512_storeu_pd(reinterpret_cast<double *>(p + offsets[r] + i), _mm512_fmaddsub_pd(ones, real, imag));
+        }
+    }
+    denseAVX2(p + i, offsets, dim, n - i, m);
+}
+
+constexpr Kernels AVX2_KERNELS{matrixAVX2, adjacentAVX2, scaleAVX2, matrix4AVX2, denseAVX2};
+constexpr Kernels AVX512_KERNELS{matrixAVX512, adjacentAVX512, scaleAVX512, matrix4AVX512, denseAVX512};
+
+#endif
+
+const Kernels &kernelsOf(const SimdLevel &simd) {
+    if (simd > detectSimdLevel()) {
+        throw QcoreException("[StateVector] simulation error msg: " + toString(simd) + " is not supported by the processor.");
+    }
+#ifdef QCORE_X86_SIMD
+    switch (simd) {
+        case SimdLevel::AVX512:
+            return AVX512_KERNELS;
+        case SimdLevel::AVX2:
+            return AVX2_KERNELS;
+        default:
+            break;
+    }
+#endif
+    return SCALAR_KERNELS;
+}
+
+/**
+ * @brief Fixed bits of a kernel call and the contiguous runs of amplitudes between them
+ *
+ * @details Run r starts at the index obtained by spreading r * run over the free bits
+ *          and setting the bits of set; as run divides 2^(lowest fixed bit), a run never
+ *          crosses a fixed bit.
+ */
+struct RunLayout {
+    std::array<std::size_t, 64> bits{};
+    std::size_t count = 0;
+    std::size_t set = 0;
+    std::size_t run = 0;
+    std::size_t runs = 0;
+};
+
+RunLayout runLayout(std::size_t qubits, std::size_t fixed, std::size_t set) {
+    RunLayout layout{};
+    for (std::size_t b = 0; b < qubits; ++b) {
+        if ((fixed >> b) & 1) {
+            layout.bits[layout.count++] = b;
+        }
+    }
+    layout.set = set;
+    const std::size_t free = qubits - layout.count;
+    const std::size_t lowest = (layout.count == 0) ? free : layout.bits[0];
+    layout.run = std::min(std::size_t{1} << lowest, MAX_RUN);
+    layout.runs = (std::size_t{1} << free) / layout.run;
+    return layout;
+}
+
+inline std::size_t runStart(const RunLayout &layout, std::size_t r) {
+    std::size_t index = r * layout.run;
+    for (std::size_t i = 0; i < layout.count; ++i) {
+        const std::size_t b = layout.bits[i];
+        index = ((index >> b) << (b + 1)) | (index & ((std::size_t{1} << b) - 1));
+    }
+    return index | layout.set;
+}
+
+// calls func(first, last) on ranges of runs, on the pool if the state is large enough
+void forRuns(const RunLayout &layout, ThreadPool *pool, const std::function<void(std::size_t, std::size_t)> &func) {
+    const std::size_t grain = std::max<std::size_t>(1, PARALLEL_GRAIN / layout.run);
+    if (pool != nullptr && pool->size() > 1 && layout.runs > grain) {
+        parallelFor(*pool, layout.runs, func, grain);
+    } else {
+        func(0, layout.runs);
+    }
+}
+
+template <typename F>
+void forEachRun(const RunLayout &layout, ThreadPool *pool, const F &func) {
+    forRuns(layout, pool, [&layout, &func](std::size_t first, std::size_t last) {
+        for (std::size_t r = first; r < last; ++r) {
+            func(runStart(layout, r));
+        }
+    });
+}
+
+void checkOperands(const AmplitudeSpan &state, std::size_t operands, std::size_t controls, const std::string &func) {
+    if ((operands & controls) != 0 || ((operands | controls) >> state.qubits) != 0) {
+        throw QcoreException("[" + func + "] simulation error msg: operands overlap or lie outside the register of " +
+                             std::to_string(state.qubits) + " qubits.");
+    }
+}
+
+// number of relative qubits of the Clifford+T template of a gate type, 0 without template
+std::size_t templateSlots(const gate_t &type) {
+    const DecompositionTemplate table = cliffordTTemplate(type);
+    std::size_t slots = 0;
+    for (const DecompositionStep *step = table.steps; step != table.steps + table.count; ++step) {
+        slots = std::max<std::size_t>(slots, step->target + 1);
+    }
+    return slots;
+}
+
+}  // namespace
+
+SimdLevel detectSimdLevel() {
+#ifdef QCORE_X86_SIMD
+    static const SimdLevel level = []() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return SimdLevel::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return SimdLevel::AVX2;
+        }
+        return SimdLevel::SCALAR;
+    }();
+    return level;
+#else
+    return SimdLevel::SCALAR;
+#endif
+}
+
+std::string toString(const SimdLevel &level) {
+    switch (level) {
+        case SimdLevel::AVX512:
+            return "avx512";
+        case SimdLevel::AVX2:
+            return "avx2";
+        default:
+            return "scalar";
+    }
+}
+
+void applyMatrix(const AmplitudeSpan &state, Qubit target, const Matrix2 &matrix, std::size_t controls, const SimdLevel &simd,
+                 ThreadPool *pool) {
+    const std::size_t bit = std::size_t{1} << target;
+    if (target >= state.qubits) {
+        throw QcoreException("[applyMatrix] simulation error msg: target " + std::to_string(target) + " lies outside the register.");
+    }
+    checkOperands(state, bit, controls, "applyMatrix");
+    const Kernels &kernels = kernelsOf(simd);
+    Complex *data = state.data;
+
+    // pairs of a target on qubit 0 are adjacent, so the runs lie between the controls
+    if (target == 0) {
+        const RunLayout layout = runLayout(state.qubits, controls, controls);
+        forEachRun(layout, pool, [&](std::size_t start) { kernels.adjacent(data + start, layout.run / 2, matrix); });
+        return;
+    }
+
+    const RunLayout layout = runLayout(state.qubits, controls | bit, controls);
+    const Complex one{1, 0};
+    if (matrix[1] == Complex{} && matrix[2] == Complex{}) {
+        if (matrix[0] == one && matrix[3] == one) {
+            return;
+        }
+        forEachRun(layout, pool, [&](std::size_t start) {
+            if (matrix[0] != one) {
+                kernels.scale(data + start, layout.run, matrix[0]);
+            }
+            if (matrix[3] != one) {
+                kernels.scale(data + start + bit, layout.run, matrix[3]);
+            }
+        });
+    } else if (matrix[0] == Complex{} && matrix[3] == Complex{}) {
+        forEachRun(layout, pool, [&](std::size_t start) {
+            std::swap_ranges(data + start, data + start + layout.run, data + start + bit);
+            if (matrix[1] != one) {
+                kernels.scale(data + start, layout.run, matrix[1]);
+            }
+            if (matrix[2] != one) {
+                kernels.scale(data + start + bit, layout.run, matrix[2]);
+            }
+        });
+    } else {
+        forEachRun(layout, pool, [&](std::size_t start) { kernels.matrix(data + start, data + start + bit, layout.run, matrix); });
+    }
+}
+
+void applyMatrix(const AmplitudeSpan &state, Qubit low, Qubit high, const Matrix4 &matrix, std::size_t controls, const SimdLevel &simd,
+                 ThreadPool *pool) {
+    if (low == high || low >= state.qubits || high >= state.qubits) {
+        throw QcoreException("[applyMatrix] simulation error msg: targets must be distinct qubits of the register.");
+    }
+    const std::size_t low_bit = std::size_t{1} << low, high_bit = std::size_t{1} << high;
+    checkOperands(state, low_bit | high_bit, controls, "applyMatrix");
+    const Kernels &kernels = kernelsOf(simd);
+    Complex *data = state.data;
+
+    const RunLayout layout = runLayout(state.qubits, controls | low_bit | high_bit, controls);
+    forEachRun(layout, pool, [&](std::size_t start) {
+        Complex *const quadruple[4] = {data + start, data + start + low_bit, data + start + high_bit, data + start + low_bit + high_bit};
+        kernels.matrix4(quadruple, layout.run, matrix);
+    });
+}
+
+void applySwap(const AmplitudeSpan &state, Qubit a, Qubit b, std::size_t controls, ThreadPool *pool) {
+    if (a == b || a >= state.qubits || b >= state.qubits) {
+        throw QcoreException("[applySwap] simulation error msg: swapped qubits must be distinct qubits of the register.");
+    }
+    const std::size_t a_bit = std::size_t{1} << a, b_bit = std::size_t{1} << b;
+    checkOperands(state, a_bit | b_bit, controls, "applySwap");
+    Complex *data = state.data;
+
+    const RunLayout layout = runLayout(state.qubits, controls | a_bit | b_bit, controls);
+    forEachRun(layout, pool, [&](std::size_t start) { std::swap_ranges(data + start + a_bit, data + start + a_bit + layout.run, data + start + b_bit); });
+}
+
+void applySwaps(const AmplitudeSpan &state, const std::vector<std::pair<Qubit, Qubit>> &pairs, ThreadPool *pool) {
+    std::size_t fixed = 0;
+    for (const auto &pair : pairs) {
+        for (auto q : {pair.first, pair.second}) {
+            if (q >= state.qubits || ((fixed >> q) & 1) != 0) {
+                throw QcoreException("[applySwaps] simulation error msg: swapped qubits must be distinct qubits of the register.");
+            }
+            fixed |= std::size_t{1} << q;
+        }
+    }
+    if (pairs.empty()) {
+        return;
+    }
+
+    // offsets of the patterns a of the first and b of the second qubits; the runs at
+    // (a, b) and (b, a) are exchanged for a < b
+    const std::size_t dim = std::size_t{1} << pairs.size();
+    std::vector<std::size_t> first(dim, 0), second(dim, 0);
+    for (std::size_t a = 1; a < dim; ++a) {
+        std::size_t i = 0;
+        while (((a >> i) & 1) == 0) {
+            ++i;
+        }
+        first[a] = first[a & (a - 1)] | (std::size_t{1} << pairs[i].first);
+        second[a] = second[a & (a - 1)] | (std::size_t{1} << pairs[i].second);
+    }
+    Complex *data = state.data;
+    const RunLayout layout = runLayout(state.qubits, fixed, 0);
+    const auto exchange = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t t = begin; t < end; ++t) {
+            Complex *base = data + runStart(layout, t / dim);
+            const std::size_t a = t % dim;
+            for (std::size_t b = a + 1; b < dim; ++b) {
+                std::swap_ranges(base + (first[a] | second[b]), base + (first[a] | second[b]) + layout.run, base + (first[b] | second[a]));
+            }
+        }
+    };
+    const std::size_t tasks = layout.runs * dim, grain = std::max<std::size_t>(1, PARALLEL_GRAIN / (layout.run * dim));
+    if (pool != nullptr && pool->size() > 1 && tasks > grain) {
+        parallelFor(*pool, tasks, exchange, grain);
+    } else {
+        exchange(0, tasks);
+    }
+}
+
+void applyMatrix(const AmplitudeSpan &state, const QubitSet &qubits, const Complex *matrix, std::size_t controls, const SimdLevel &simd,
+                 ThreadPool *pool) {
+    if (qubits.empty() || qubits.size() > MAX_DENSE_QUBITS) {
+        throw QcoreException("[applyMatrix] simulation error msg: dense matrices act on 1 to " + std::to_string(MAX_DENSE_QUBITS) + " qubits.");
+    }
+    std::size_t mask = 0;
+    for (auto q : qubits) {
+        if (q >= state.qubits || ((mask >> q) & 1) != 0) {
+            throw QcoreException("[applyMatrix] simulation error msg: targets must be distinct qubits of the register.");
+        }
+        mask |= std::size_t{1} << q;
+    }
+    checkOperands(state, mask, controls, "applyMatrix");
+    const Kernels &kernels = kernelsOf(simd);
+    Complex *data = state.data;
+
+    const std::size_t dim = std::size_t{1} << qubits.size();
+    std::array<std::size_t, MAX_DENSE_DIM> offsets{};
+    for (std::size_t j = 1; j < dim; ++j) {
+        std::size_t i = 0;
+        while (((j >> i) & 1) == 0) {
+            ++i;
+        }
+        offsets[j] = offsets[j & (j - 1)] | (std::size_t{1} << qubits[i]);
+    }
+
+    const RunLayout layout = runLayout(state.qubits, controls | mask, controls);
+    forEachRun(layout, pool, [&](std::size_t start) { kernels.dense(data + start, offsets.data(), dim, layout.run, matrix); });
+}
+
+bool isSupportedUnitary(QGate &gate) {
+    const gate_t type = gate.getType();
+    auto &controls = gate.getControls();
+    auto &targets = gate.getTargets();
+    switch (type) {
+        case GateType::BARRIER:
+        case GateType::I:
+            return true;
+        case GateType::MEASURE:
+        case GateType::RESET:
+            return false;
+        case GateType::SWAP:
+        case GateType::CSWAP:
+            return targets.size() == 2;
+        case GateType::LCCX:
+        case GateType::LCCXDG:
+        case GateType::PERES:
+        case GateType::PERESDG:
+            return controls.size() == 2 && targets.size() == 1;
+        default:
+            break;
+    }
+
+    Matrix2 matrix{};
+    if (tryTargetMatrix(gate, matrix)) {
+        return true;
+    }
+    Matrix4 matrix4{};
+    if (tryPairMatrix(gate, matrix4)) {
+        return true;
+    }
+    const std::size_t slots = templateSlots(type);
+    return slots != 0 && targets.size() == 1 && controls.size() + 1 == slots;
+}
+
+bool tryPairMatrix(QGate &gate, Matrix4 &matrix) {
+    auto &targets = gate.getTargets();
+    if (!gate.getControls().empty() || targets.size() != 2) {
+        return false;
+    }
+    if (!gate.getIsClassical()) {
+        return tryTwoQubitMatrix(gate, targets[0], targets[1], matrix);
+    }
+    QGate unconditioned(gate);
+    unconditioned.setIsClassical(false);
+    return tryTwoQubitMatrix(unconditioned, targets[0], targets[1], matrix);
+}
+
+bool applyGate(const AmplitudeSpan &state, QGate &gate, const SimdLevel &simd, ThreadPool *pool, const Qubit *layout) {
+    if (!isSupportedUnitary(gate)) {
+        return false;
+    }
+    const gate_t type = gate.getType();
+    if (type == GateType::BARRIER || type == GateType::I) {
+        return true;
+    }
+
+    const auto place = [&state, &type, layout](Qubit q) {
+        const Qubit p = (layout == nullptr) ? q : layout[q];
+        if (p >= state.qubits) {
+            throw QcoreException("[applyGate] gate: " + toString(type) + " msg: qubit " + std::to_string(q) + " lies outside the register.");
+        }
+        return p;
+    };
+    auto &controls = gate.getControls();
+    auto &targets = gate.getTargets();
+    std::size_t mask = 0;
+    for (auto q : controls) {
+        mask |= std::size_t{1} << place(q);
+    }
+    Qubit operands[4];
+    std::size_t slot = 0;
+    for (auto q : controls) {
+        if (slot < 3) {
+            operands[slot++] = place(q);
+        }
+    }
+    const Qubit target = place(targets[0]);
+    operands[slot] = target;
+
+    const Matrix2 x = fixedMatrix(GateType::X);
+    switch (type) {
+        case GateType::SWAP:
+        case GateType::CSWAP:
+            applySwap(state, target, place(targets[1]), mask, pool);
+            return true;
+        case GateType::LCCX:
+        case GateType::LCCXDG:
+            applyMatrix(state, target, x, mask, simd, pool);
+            return true;
+        case GateType::PERES:
+        case GateType::PERESDG: {
+            // CCX(a, b, c) followed by CX(a, b), or the reverse
+            const std::size_t first = std::size_t{1} << operands[0];
+            if (type == GateType::PERESDG) {
+                applyMatrix(state, operands[1], x, first, simd, pool);
+            }
+            applyMatrix(state, target, x, mask, simd, pool);
+            if (type == GateType::PERES) {
+                applyMatrix(state, operands[1], x, first, simd, pool);
+            }
+            return true;
+        }
+        default:
+            break;
+    }
+
+    Matrix2 matrix{};
+    if (tryTargetMatrix(gate, matrix)) {
+        applyMatrix(state, target, matrix, mask, simd, pool);
+        return true;
+    }
+
+    Matrix4 matrix4{};
+    if (tryPairMatrix(gate, matrix4)) {
+        applyMatrix(state, target, place(targets[1]), matrix4, 0, simd, pool);
+        return true;
+    }
+
+    const DecompositionTemplate table = cliffordTTemplate(type);
+    for (const DecompositionStep *step = table.steps; step != table.steps + table.count; ++step) {
+        const std::size_t step_controls = (step->control == NO_SLOT) ? 0 : std::size_t{1} << operands[step->control];
+        applyMatrix(state, operands[step->target], fixedMatrix(step->type), step_controls, simd, pool);
+    }
+    return true;
+}
+
+void StateVector::AlignedDelete::operator()(Complex *amplitudes) const {
+    ::operator delete(amplitudes, std::align_val_t{AMPLITUDE_ALIGNMENT});
+}
+
+StateVector::StateVector(std::size_t qubits, std::size_t threads, SimdLevel simd, std::uint64_t seed)
+    : qubits(qubits), simd(simd), rng(seed) {
+    if (qubits == 0 || qubits > MAX_STATEVECTOR_QUBITS) {
+        throw QcoreException("[StateVector] simulation error msg: register of " + std::to_string(qubits) + " qubits, supported are 1 to " +
+                             std::to_string(MAX_STATEVECTOR_QUBITS) + ".");
+    }
+    kernelsOf(simd);
+
+    threads = resolveThreads(threads);
+    if (threads > 1) {
+        this->pool = std::make_unique<ThreadPool>(threads);
+    }
+    this->amplitudes.reset(static_cast<Complex *>(::operator new(sizeof(Complex) * size(), std::align_val_t{AMPLITUDE_ALIGNMENT})));
+    reset();
+}
+
+void StateVector::reset() {
+    // the workers touch the pages first, which places them near the threads that use them
+    Complex *data = this->amplitudes.get();
+    const RunLayout layout = runLayout(this->qubits, 0, 0);
+    forEachRun(layout, this->pool.get(), [&](std::size_t start) { std::fill(data + start, data + start + layout.run, Complex{}); });
+    data[0] = Complex{1, 0};
+    std::fill(this->cbits.begin(), this->cbits.end(), 0);
+}
+
+void StateVector::apply(QGate &gate) { apply(gate, nullptr); }
+
+void StateVector::apply(QGate &gate, const Qubit *layout) {
+    const gate_t type = gate.getType();
+    if (gate.getIsClassical() && !conditionHolds(gate, this->cbits, "StateVector::apply")) {
+        return;
+    }
+
+    auto &controls = gate.getControls();
+    auto &targets = gate.getTargets();
+    for (auto &qubits : {std::cref(controls), std::cref(targets)}) {
+        for (auto q : qubits.get()) {
+            if (q >= this->qubits) {
+                throw QcoreException("[StateVector::apply] gate: " + toString(type) + " msg: qubit " + std::to_string(q) + " lies outside the register.");
+            }
+        }
+    }
+    const auto place = [layout](Qubit q) { return (layout == nullptr) ? q : layout[q]; };
+
+    switch (type) {
+        case GateType::MEASURE:
+            for (std::size_t i = 0; i < targets.size(); ++i) {
+                storeOutcome(this->cbits, gate, i, measure(place(targets[i])));
+            }
+            return;
+        case GateType::RESET:
+            for (auto q : targets) {
+                reset(place(q));
+            }
+            return;
+        default:
+            break;
+    }
+
+    if (!applyGate(span(), gate, this->simd, this->pool.get(), layout)) {
+        throw QcoreException("[StateVector::apply] gate: " + toString(type) + " msg: unsupported gate.");
+    }
+}
+
+void StateVector::prepare(QCircuit &qc, const std::string &func) {
+    if (qc.getQregSize() > this->qubits) {
+        throw QcoreException("[" + func + "] simulation error msg: circuit of " + std::to_string(qc.getQregSize()) +
+                             " qubits exceeds the register of " + std::to_string(this->qubits) + " qubits.");
+    }
+    if (this->cbits.size() < qc.getCregSize()) {
+        this->cbits.resize(qc.getCregSize(), 0);
+    }
+}
+
+void StateVector::run(QCircuit &qc) {
+    prepare(qc, "StateVector::run");
+    for (auto &gate : qc.getGates()) {
+        apply(*gate);
+    }
+}
+
+void StateVector::run(const std::vector<SimulationStep> &steps) {
+    for (const auto &step : steps) {
+        if (step.isFused()) {
+            applyMatrix(span(), step.block.qubits, step.block.matrix.data(), 0, this->simd, this->pool.get());
+        } else {
+            apply(*step.gate);
+        }
+    }
+}
+
+std::size_t StateVector::runBlocked(const std::vector<SimulationStep> &steps, std::size_t block_qubits) {
+    if (block_qubits == 0) {
+        throw QcoreException("[StateVector::runBlocked] simulation error msg: chunks need at least one qubit.");
+    }
+    const std::size_t n = this->qubits, local = std::min(block_qubits, n);
+    const std::uint64_t all = (n == 64) ? ~std::uint64_t{0} : (std::uint64_t{1} << n) - 1;
+
+    // operands of the steps as masks (none for no-ops) and whether a step can run on a chunk
+    std::vector<std::uint64_t> operands(steps.size(), 0);
+    std::vector<bool> blockable(steps.size(), false);
+    for (std::size_t i = 0; i < steps.size(); ++i) {
+        const SimulationStep &step = steps[i];
+        QubitSet qubits{};
+        if (step.isFused()) {
+            qubits = step.block.qubits;
+        } else if (step.gate->getType() != GateType::BARRIER && step.gate->getType() != GateType::I) {
+            qubits = step.gate->getControls();
+            qubits.insert(qubits.end(), step.gate->getTargets().begin(), step.gate->getTargets().end());
+        }
+        bool inside = true;
+        for (auto q : qubits) {
+            inside = inside && q < n;
+            operands[i] |= inside ? std::uint64_t{1} << q : 0;
+        }
+        const bool unitary = step.isFused() || (!step.gate->getIsClassical() && isSupportedUnitary(*step.gate));
+        blockable[i] = inside && unitary && qubits.size() <= local;
+    }
+
+    // layout maps circuit qubits to positions in the register, position is its inverse
+    std::vector<Qubit> layout(n), position(n);
+    for (Qubit q = 0; q < n; ++q) {
+        layout[q] = position[q] = q;
+    }
+    const auto relabel = [&layout, &position](Qubit a, Qubit b) {
+        std::swap(position[a], position[b]);
+        layout[position[a]] = a;
+        layout[position[b]] = b;
+    };
+    const auto placed = [&layout](const QubitSet &qubits) {
+        QubitSet result{};
+        for (auto q : qubits) {
+            result.push_back(layout[q]);
+        }
+        return result;
+    };
+
+    std::size_t passes = 0;
+    std::vector<std::pair<Qubit, Qubit>> pairs{};
+    const auto exchange = [&]() {
+        if (!pairs.empty()) {
+            applySwaps(span(), pairs, this->pool.get());
+            for (const auto &pair : pairs) {
+                relabel(pair.first, pair.second);
+            }
+            pairs.clear();
+            ++passes;
+        }
+    };
+
+    // applies the steps to one chunk after the other, local qubit pairs being swapped first
+    Complex *data = this->amplitudes.get();
+    const auto sweep = [&](const std::vector<std::size_t> &run, const std::vector<std::pair<Qubit, Qubit>> &swaps) {
+        std::vector<QubitSet> blocks(run.size());
+        for (std::size_t k = 0; k < run.size(); ++k) {
+            if (steps[run[k]].isFused()) {
+                blocks[k] = placed(steps[run[k]].block.qubits);
+            }
+        }
+        const std::size_t chunks = size() >> local;
+        const auto chunk = [&](std::size_t first, std::size_t last) {
+            for (std::size_t c = first; c < last; ++c) {
+                const AmplitudeSpan part{data + (c << local), local};
+                for (const auto &swap : swaps) {
+                    applySwap(part, swap.first, swap.second, 0);
+                }
+                for (std::size_t k = 0; k < run.size(); ++k) {
+                    const SimulationStep &step = steps[run[k]];
+                    if (step.isFused()) {
+                        applyMatrix(part, blocks[k], step.block.matrix.data(), 0, this->simd);
+                    } else {
+                        applyGate(part, *step.gate, this->simd, nullptr, layout.data());
+                    }
+                }
+            }
+        };
+        if (this->pool != nullptr && this->pool->size() > 1 && chunks > 1) {
+            parallelFor(*this->pool, chunks, chunk, 1);
+        } else {
+            chunk(0, chunks);
+        }
+        ++passes;
+    };
+
+    // steps that cannot run on a chunk are applied to the whole register through the layout
+    const auto global = [&](std::size_t i) {
+        const SimulationStep &step = steps[i];
+        if (step.isFused()) {
+            applyMatrix(span(), placed(step.block.qubits), step.block.matrix.data(), 0, this->simd, this->pool.get());
+        } else {
+            apply(*step.gate, layout.data());
+        }
+        ++passes;
+    };
+
+    std::vector<bool> done(steps.size(), false);
+    std::vector<std::size_t> run{};
+    for (std::size_t first = 0; first < steps.size();) {
+        if (done[first]) {
+            ++first;
+            continue;
+        }
+        if (!blockable[first]) {
+            global(first);
+            done[first++] = true;
+            continue;
+        }
+
+        // a phase takes every pending step on at most local qubits that commutes with the
+        // skipped steps before it, up to the next step that cannot run on a chunk
+        std::uint64_t working = 0, skipped = 0;
+        run.clear();
+        for (std::size_t j = first; j < steps.size() && skipped != all; ++j) {
+            if (done[j]) {
+                continue;
+            }
+            if (!blockable[j]) {
+                break;
+            }
+            const std::uint64_t grown = working | operands[j];
+            if ((operands[j] & skipped) == 0 && std::bitset<64>(grown).count() <= local) {
+                working = grown;
+                run.push_back(j);
+            } else {
+                skipped |= operands[j];
+            }
+        }
+
+        // the working qubits outside the chunk replace the highest local positions not in use
+        Qubit victim = static_cast<Qubit>(local);
+        for (Qubit q = 0; q < n; ++q) {
+            if (((working >> q) & 1) != 0 && layout[q] >= local) {
+                do {
+                    --victim;
+                } while (((working >> position[victim]) & 1) != 0);
+                pairs.emplace_back(victim, layout[q]);
+            }
+        }
+        if (!pairs.empty() && run.size() == 1) {
+            // an exchange for a single step costs more than applying it in place
+            pairs.clear();
+            global(run[0]);
+        } else {
+            exchange();
+            sweep(run, {});
+        }
+        for (auto j : run) {
+            done[j] = true;
+        }
+    }
+
+    // circuit qubits on the wrong side of the chunk boundary are exchanged in one pass,
+    // the local positions are sorted within the chunks and the high ones pairwise
+    for (Qubit p = 0, h = static_cast<Qubit>(local); p < local; ++p) {
+        if (position[p] >= local) {
+            while (position[h] >= local) {
+                ++h;
+            }
+            pairs.emplace_back(p, h++);
+        }
+    }
+    exchange();
+    std::vector<std::pair<Qubit, Qubit>> swaps{};
+    for (Qubit p = 0; p < local; ++p) {
+        if (position[p] != p) {
+            swaps.emplace_back(p, layout[p]);
+            relabel(p, layout[p]);
+        }
+    }
+    if (!swaps.empty()) {
+        run.clear();
+        sweep(run, swaps);
+    }
+    for (Qubit p = static_cast<Qubit>(local); p < n; ++p) {
+        if (position[p] != p) {
+            applySwap(span(), p, layout[p], 0, this->pool.get());
+            relabel(p, layout[p]);
+            ++passes;
+        }
+    }
+    return passes;
+}
+
+std::size_t StateVector::runBlocked(QCircuit &qc, std::size_t block_qubits) {
+    prepare(qc, "StateVector::runBlocked");
+    std::vector<SimulationStep> steps(qc.getGates().size());
+    for (std::size_t i = 0; i < steps.size(); ++i) {
+        steps[i].gate = qc.getGates()[i].get();
+    }
+    return runBlocked(steps, block_qubits);
+}
+
+fp StateVector::probability(Qubit qubit) {
+    if (qubit >= this->qubits) {
+        throw QcoreException("[StateVector::probability] simulation error msg: qubit " + std::to_string(qubit) + " lies outside the register.");
+    }
+    const std::size_t bit = std::size_t{1} << qubit;
+    const RunLayout layout = runLayout(this->qubits, bit, bit);
+    const Complex *data = this->amplitudes.get();
+
+    fp total = 0;
+    std::mutex lock;
+    forRuns(layout, this->pool.get(), [&](std::size_t first, std::size_t last) {
+        fp partial = 0;
+        for (std::size_t r = first; r < last; ++r) {
+            const Complex *run = data + runStart(layout, r);
+            for (std::size_t i = 0; i < layout.run; ++i) {
+                partial += std::norm(run[i]);
+            }
+        }
+        std::lock_guard<std::mutex> guard(lock);
+        total += partial;
+    });
+    return total;
+}
+
+bool StateVector::measure(Qubit qubit) {
+    const fp one = probability(qubit);
+    const bool outcome = std::uniform_real_distribution<fp>(0, 1)(this->rng) < one;
+    const fp norm = 1 / std::sqrt(outcome ? one : 1 - one);
+    const Matrix2 projector{outcome ? Complex{} : Complex{norm, 0}, Complex{}, Complex{}, outcome ? Complex{norm, 0} : Complex{}};
+    applyMatrix(span(), qubit, projector, 0, this->simd, this->pool.get());
+    return outcome;
+}
+
+void StateVector::reset(Qubit qubit) {
+    if (measure(qubit)) {
+        applyMatrix(span(), qubit, fixedMatrix(GateType::X), 0, this->simd, this->pool.get());
+    }
+}
+
+}  // namespace qcore
@@ -0,0 +1,343 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Extraction.cpp
+ *  @brief  Instance Description for the Circuit Extraction from ZX-Diagrams
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "zx/Extraction.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "Angle.hpp"
+#include "optimize/RotationMerging.hpp"
+#include "zx/Simplify.hpp"
+
+namespace qcore {
+
+static constexpr std::size_t NO_QUBIT = std::numeric_limits<std::size_t>::max();
+
+namespace {
+
+// frontier of the extraction, one spider per output
+class Extractor {
+   private:
+    ZXDiagram &diagram;
+    std::size_t qubits;
+    std::vector<vertex_t> frontier;
+    std::vector<bool> done;
+    FlatHashMap<vertex_t, std::size_t> position{};
+    FlatHashMap<vertex_t, std::size_t> input_position{};
+
+    // gates from the outputs towards the inputs
+    QGateSet reversed{};
+
+    void setFrontier(std::size_t q, vertex_t v) {
+        this->position.erase(this->frontier[q]);
+        this->frontier[q] = v;
+        this->position.insert(v, q);
+    }
+
+    std::size_t frontierPosition(vertex_t v) const {
+        auto *q = this->position.find(v);
+        return (q == nullptr) ? NO_QUBIT : *q;
+    }
+
+    // neighbours of a frontier spider other than its output
+    std::vector<vertex_t> inner(std::size_t q) const {
+        std::vector<vertex_t> neighbours{};
+        for (const auto &entry : this->diagram.getNeighbours(this->frontier[q])) {
+            if (entry.key != this->diagram.getOutputs()[q]) {
+                neighbours.push_back(entry.key);
+            }
+        }
+        return neighbours;
+    }
+
+    void emitPhase(std::size_t q, fp phase) {
+        std::int64_t k = 0;
+        if (isAngleMultiple(phase, PI / 4, k)) {
+            auto gates = phaseGates(k, q);
+            moveQGates(this->reversed, gates);
+        } else {
+            RotationMap angles{{RotationType::THETA, angleString(phase)}};
+            this->reversed.push_back(std::make_unique<QGate>(GateType::RZ, 1, angles, TargetSet{q}));
+        }
+    }
+
+    // H gates at the outputs, frontier phases and CZ gates inside the frontier
+    void cleanFrontier() {
+        for (std::size_t q = 0; q < this->qubits; ++q) {
+            const vertex_t v = this->frontier[q], output = this->diagram.getOutputs()[q];
+            if (this->diagram.getEdgeType(v, output) == EdgeType::HADAMARD) {
+                this->reversed.push_back(std::make_unique<QGate>(GateType::H, 1, TargetSet{q}));
+                this->diagram.setEdgeType(v, output, EdgeType::SIMPLE);
+            }
+            if (this->diagram.getPhase(v) != 0) {
+                emitPhase(q, this->diagram.getPhase(v));
+                this->diagram.setPhase(v, 0);
+            }
+        }
+        for (std::size_t q = 0; q < this->qubits; ++q) {
+            for (auto w : inner(q)) {
+                const std::size_t p = frontierPosition(w);
+                if (p != NO_QUBIT) {
+                    this->reversed.push_back(std::make_unique<QGate>(GateType::CZ, 2, ControlSet{q}, TargetSet{p}));
+                    this->diagram.removeEdge(this->frontier[q], w);
+                }
+            }
+        }
+    }
+
+    // marks frontier spiders that only lead to an input, detaches the others from inputs
+    bool settleInputs() {
+        bool complete = true;
+        for (std::size_t q = 0; q < this->qubits; ++q) {
+            if (this->done[q]) {
+                continue;
+            }
+            const auto neighbours = inner(q);
+            for (auto w : neighbours) {
+                if (!this->input_position.contains(w)) {
+                    continue;
+                }
+                if (neighbours.size() == 1) {
+                    this->done[q] = true;
+                } else {
+                    const vertex_t v = this->frontier[q], z = this->diagram.addVertex(VertexType::Z);
+                    const EdgeType type = this->diagram.getEdgeType(v, w);
+                    this->diagram.removeEdge(v, w);
+                    this->diagram.addEdge(v, z, EdgeType::HADAMARD);
+                    this->diagram.addEdge(z, w, (type == EdgeType::SIMPLE) ? EdgeType::HADAMARD : EdgeType::SIMPLE);
+                }
+            }
+            complete = complete && this->done[q];
+        }
+        return complete;
+    }
+
+    // replaces frontier spiders that have a single other neighbour by that neighbour
+    bool advanceSingles() {
+        bool advanced = false;
+        for (std::size_t q = 0; q < this->qubits; ++q) {
+            if (this->done[q]) {
+                continue;
+            }
+            const auto neighbours = inner(q);
+            if (neighbours.size() != 1 || frontierPosition(neighbours[0]) != NO_QUBIT) {
+                continue;
+            }
+            this->diagram.removeVertex(this->frontier[q]);
+            this->diagram.addEdge(neighbours[0], this->diagram.getOutputs()[q], EdgeType::HADAMARD);
+            setFrontier(q, neighbours[0]);
+            advanced = true;
+        }
+        return advanced;
+    }
+
+    // Gauss-Jordan reduction of the frontier biadjacency matrix, one CX per row addition
+    void eliminate() {
+        std::vector<std::size_t> rows{};
+        std::vector<vertex_t> columns{};
+        FlatHashMap<vertex_t, std::size_t> column_of{};
+        for (std::size_t q = 0; q < this->qubits; ++q) {
+            if (this->done[q]) {
+                continue;
+            }
+            rows.push_back(q);
+            for (auto w : inner(q)) {
+                if (!column_of.contains(w)) {
+                    column_of.insert(w, columns.size());
+                    columns.push_back(w);
+                }
+            }
+        }
+
+        const std::size_t words = (columns.size() + 63) / 64;
+        std::vector<std::uint64_t> matrix(rows.size() * words, 0);
+        auto row = [&](std::size_t r) { return matrix.data() + r * words; };
+        auto bit = [&](std::size_t r, std::size_t c) { return ((row(r)[c >> 6] >> (c & 63)) & 1) != 0; };
+        auto addRow = [&](std::size_t source, std::size_t destination) {
+            for (std::size_t w = 0; w < words; ++w) {
+                row(destination)[w] ^= row(source)[w];
+            }
+            // row addition in the Hadamard frame of the outputs: CX with the roles exchanged
+            this->reversed.push_back(std::make_unique<QGate>(GateType::CX, 2, ControlSet{rows[destination]}, TargetSet{rows[source]}));
+        };
+
+        for (std::size_t r = 0; r < rows.size(); ++r) {
+            for (auto w : inner(rows[r])) {
+                const std::size_t c = *column_of.find(w);
+                row(r)[c >> 6] |= std::uint64_t{1} << (c & 63);
+            }
+        }
+
+        std::size_t pivot_row = 0;
+        for (std::size_t c = 0; c < columns.size() && pivot_row < rows.size(); ++c) {
+            std::size_t r = pivot_row;
+            while (r < rows.size() && !bit(r, c)) {
+                ++r;
+            }
+            if (r == rows.size()) {
+                continue;
+            }
+            if (r != pivot_row) {
+                addRow(r, pivot_row);
+            }
+            for (std::size_t other = 0; other < rows.size(); ++other) {
+                if (other != pivot_row && bit(other, c)) {
+                    addRow(pivot_row, other);
+                }
+            }
+            ++pivot_row;
+        }
+
+        for (std::size_t r = 0; r < rows.size(); ++r) {
+            const vertex_t v = this->frontier[rows[r]];
+            for (std::size_t c = 0; c < columns.size(); ++c) {
+                if (bit(r, c) != this->diagram.isConnected(v, columns[c])) {
+                    if (bit(r, c)) {
+                        this->diagram.addEdge(v, columns[c], EdgeType::HADAMARD);
+                    } else {
+                        this->diagram.removeEdge(v, columns[c]);
+                    }
+                }
+            }
+        }
+    }
+
+    // pivots a frontier spider with a neighbouring phase gadget hub
+    bool pivotGadget() {
+        for (std::size_t q = 0; q < this->qubits; ++q) {
+            if (this->done[q]) {
+                continue;
+            }
+            for (auto w : inner(q)) {
+                std::int64_t k = 0;
+                if (!isAngleMultiple(this->diagram.getPhase(w), PI, k) || !this->diagram.isInterior(w)) {
+                    continue;
+                }
+                bool hub = false;
+                for (const auto &entry : this->diagram.getNeighbours(w)) {
+                    hub = hub || this->diagram.degree(entry.key) == 1;
+                }
+                if (!hub) {
+                    continue;
+                }
+
+                // a phase-free spider between frontier and output makes the frontier interior
+                const vertex_t v = this->frontier[q], output = this->diagram.getOutputs()[q];
+                const vertex_t z = this->diagram.addVertex(VertexType::Z);
+                this->diagram.removeEdge(v, output);
+                this->diagram.addEdge(v, z, EdgeType::HADAMARD);
+                this->diagram.addEdge(z, output, EdgeType::HADAMARD);
+                pivot(this->diagram, v, w);
+                setFrontier(q, z);
+                return true;
+            }
+        }
+        return false;
+    }
+
+   public:
+    explicit Extractor(ZXDiagram &diagram) : diagram(diagram), qubits(diagram.getOutputs().size()), frontier(qubits), done(qubits, false) {
+        if (diagram.getInputs().size() != this->qubits) {
+            throw QcoreException("[extractCircuit] inputs: " + std::to_string(diagram.getInputs().size()) + " msg: expected " +
+                                 std::to_string(this->qubits) + " inputs");
+        }
+        for (std::size_t q = 0; q < this->qubits; ++q) {
+            this->input_position.insert(diagram.getInputs()[q], q);
+            const vertex_t output = diagram.getOutputs()[q];
+            if (diagram.degree(output) != 1 || diagram.isBoundary(diagram.getNeighbours(output).begin()->key)) {
+                throw QcoreException("[extractCircuit] output: " + std::to_string(q) + " msg: diagram is not graph-like");
+            }
+            this->frontier[q] = diagram.getNeighbours(output).begin()->key;
+            this->position.insert(this->frontier[q], q);
+        }
+    }
+
+    QGateSet run() {
+        while (true) {
+            cleanFrontier();
+            if (settleInputs()) {
+                break;
+            }
+            if (advanceSingles()) {
+                continue;
+            }
+            eliminate();
+            if (advanceSingles() || pivotGadget()) {
+                continue;
+            }
+            throw QcoreException("[extractCircuit] msg: diagram has no generalized flow");
+        }
+
+        // Hadamards on the inputs, then the permutation from inputs to outputs
+        QGateSet gates{};
+        std::vector<std::size_t> source(this->qubits, NO_QUBIT);
+        for (std::size_t q = 0; q < this->qubits; ++q) {
+            const vertex_t v = this->frontier[q];
+            for (const auto &entry : this->diagram.getNeighbours(v)) {
+                auto *p = this->input_position.find(entry.key);
+                if (p == nullptr) {
+                    continue;
+                }
+                source[q] = *p;
+                if (entry.value == EdgeType::HADAMARD) {
+                    gates.push_back(std::make_unique<QGate>(GateType::H, 1, TargetSet{*p}));
+                }
+            }
+        }
+
+        std::vector<std::size_t> content(this->qubits);
+        for (std::size_t q = 0; q < this->qubits; ++q) {
+            content[q] = q;
+        }
+        for (std::size_t q = 0; q < this->qubits; ++q) {
+            const std::size_t r = static_cast<std::size_t>(std::find(content.begin() + q, content.end(), source[q]) - content.begin());
+            if (r == this->qubits) {
+                throw QcoreException("[extractCircuit] output: " + std::to_string(q) + " msg: inputs are not a permutation of the outputs");
+            }
+            if (r != q) {
+                gates.push_back(std::make_unique<QGate>(GateType::SWAP, 2, TargetSet{q, r}));
+                std::swap(content[q], content[r]);
+            }
+        }
+
+        for (auto it = this->reversed.rbegin(); it != this->reversed.rend(); ++it) {
+            gates.push_back(std::move(*it));
+        }
+        return gates;
+    }
+};
+
+}  // namespace
+
+QGateSet extractCircuit(ZXDiagram diagram) {
+    toGraphLike(diagram);
+    return Extractor(diagram).run();
+}
+
+}  // namespace qcore
@@ -0,0 +1,409 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   Simplify.cpp
+ *  @brief  Instance Description for the ZX-Calculus Rewrite Rules
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "zx/Simplify.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "Angle.hpp"
+
+namespace qcore {
+
+static bool isZeroPhase(fp phase) {
+    return std::abs(phase) <= ANGLE_TOLERANCE;
+}
+
+static bool isPauliPhase(fp phase) {
+    std::int64_t k = 0;
+    return isAngleMultiple(phase, PI, k);
+}
+
+static bool isCliffordPhase(fp phase) {
+    std::int64_t k = 0;
+    return isAngleMultiple(phase, PI / 2, k);
+}
+
+static bool isProperCliffordPhase(fp phase) {
+    return isCliffordPhase(phase) && !isPauliPhase(phase);
+}
+
+static std::vector<Neighbourhood::Entry> neighbourList(const ZXDiagram &diagram, vertex_t v) {
+    auto &neighbours = diagram.getNeighbours(v);
+    return std::vector<Neighbourhood::Entry>(neighbours.begin(), neighbours.end());
+}
+
+// degree-one Z spider hanging off a Z spider
+static bool isLeaf(const ZXDiagram &diagram, vertex_t v) {
+    if (diagram.isBoundary(v) || diagram.degree(v) != 1) {
+        return false;
+    }
+    return !diagram.isBoundary(diagram.getNeighbours(v).begin()->key);
+}
+
+static bool isHub(const ZXDiagram &diagram, vertex_t v) {
+    for (const auto &entry : diagram.getNeighbours(v)) {
+        if (isLeaf(diagram, entry.key)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void fuseSpiders(ZXDiagram &diagram, vertex_t u, vertex_t v) {
+    const auto neighbours = neighbourList(diagram, v);
+    diagram.addToPhase(u, diagram.getPhase(v));
+    diagram.removeVertex(v);
+    for (const auto &entry : neighbours) {
+        if (entry.key != u) {
+            diagram.addEdge(u, entry.key, entry.value);
+        }
+    }
+}
+
+void toGraphLike(ZXDiagram &diagram) {
+    for (vertex_t v = 0; v < diagram.vertexBound(); ++v) {
+        if (!diagram.isAlive(v) || diagram.isBoundary(v)) {
+            continue;
+        }
+        for (bool fused = true; fused;) {
+            fused = false;
+            for (const auto &entry : diagram.getNeighbours(v)) {
+                if (entry.value == EdgeType::SIMPLE && !diagram.isBoundary(entry.key)) {
+                    fuseSpiders(diagram, v, entry.key);
+                    fused = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    for (auto *boundaries : {&diagram.getInputs(), &diagram.getOutputs()}) {
+        for (auto b : *boundaries) {
+            const auto neighbours = neighbourList(diagram, b);
+            if (neighbours.size() == 1 && diagram.isBoundary(neighbours[0].key)) {
+                const vertex_t z = diagram.addVertex(VertexType::Z);
+                diagram.removeEdge(b, neighbours[0].key);
+                diagram.addEdge(b, z, EdgeType::SIMPLE);
+                diagram.addEdge(z, neighbours[0].key, neighbours[0].value);
+            }
+        }
+    }
+}
+
+void localComplement(ZXDiagram &diagram, vertex_t v) {
+    const auto neighbours = neighbourList(diagram, v);
+    const fp phase = diagram.getPhase(v);
+    diagram.removeVertex(v);
+    for (std::size_t i = 0; i < neighbours.size(); ++i) {
+        diagram.addToPhase(neighbours[i].key, -phase);
+        for (std::size_t j = i + 1; j < neighbours.size(); ++j) {
+            diagram.addEdge(neighbours[i].key, neighbours[j].key, EdgeType::HADAMARD);
+        }
+    }
+}
+
+void pivot(ZXDiagram &diagram, vertex_t u, vertex_t v) {
+    std::vector<vertex_t> only_u{}, only_v{}, common{};
+    for (const auto &entry : diagram.getNeighbours(u)) {
+        if (entry.key != v) {
+            (diagram.isConnected(v, entry.key) ? common : only_u).push_back(entry.key);
+        }
+    }
+    for (const auto &entry : diagram.getNeighbours(v)) {
+        if (entry.key != u && !diagram.isConnected(u, entry.key)) {
+            only_v.push_back(entry.key);
+        }
+    }
+
+    const fp phase_u = diagram.getPhase(u), phase_v = diagram.getPhase(v);
+    diagram.removeVertex(u);
+    diagram.removeVertex(v);
+
+    auto toggle = [&](const std::vector<vertex_t> &lhs, const std::vector<vertex_t> &rhs) {
+        for (auto a : lhs) {
+            for (auto b : rhs) {
+                diagram.addEdge(a, b, EdgeType::HADAMARD);
+            }
+        }
+    };
+    toggle(only_u, only_v);
+    toggle(only_u, common);
+    toggle(only_v, common);
+
+    for (auto w : only_u) {
+        diagram.addToPhase(w, phase_v);
+    }
+    for (auto w : only_v) {
+        diagram.addToPhase(w, phase_u);
+    }
+    for (auto w : common) {
+        diagram.addToPhase(w, phase_u + phase_v + PI);
+    }
+}
+
+vertex_t unfusePhaseGadget(ZXDiagram &diagram, vertex_t v) {
+    const vertex_t hub = diagram.addVertex(VertexType::Z);
+    const vertex_t leaf = diagram.addVertex(VertexType::Z, diagram.getPhase(v));
+    diagram.setPhase(v, 0);
+    diagram.addEdge(v, hub, EdgeType::HADAMARD);
+    diagram.addEdge(hub, leaf, EdgeType::HADAMARD);
+    return hub;
+}
+
+struct SupportHash {
+    std::size_t operator()(const std::vector<vertex_t> &support) const {
+        std::size_t hash = 14695981039346656037ULL;
+        for (auto v : support) {
+            hash = (hash ^ v) * 1099511628211ULL;
+        }
+        return hash;
+    }
+};
+
+// fuses gadgets and reports the spiders whose neighbourhood changed
+static std::size_t fuseGadgets(ZXDiagram &diagram, std::vector<vertex_t> &touched) {
+    std::unordered_map<std::vector<vertex_t>, vertex_t, SupportHash> gadgets{};
+    std::size_t removed = 0;
+
+    for (vertex_t leaf = 0; leaf < diagram.vertexBound(); ++leaf) {
+        if (!diagram.isAlive(leaf) || !isLeaf(diagram, leaf)) {
+            continue;
+        }
+        const vertex_t hub = diagram.getNeighbours(leaf).begin()->key;
+        if (diagram.degree(hub) < 2 || !isPauliPhase(diagram.getPhase(hub)) || !diagram.isInterior(hub)) {
+            continue;
+        }
+
+        // gadgets next to other gadgets are left alone, their supports may change below
+        std::vector<vertex_t> support{};
+        bool nested = false;
+        for (const auto &entry : diagram.getNeighbours(hub)) {
+            if (entry.key != leaf) {
+                support.push_back(entry.key);
+                nested = nested || isLeaf(diagram, entry.key) || isHub(diagram, entry.key);
+            }
+        }
+        if (nested) {
+            continue;
+        }
+        std::sort(support.begin(), support.end());
+
+        if (!isZeroPhase(diagram.getPhase(hub))) {
+            diagram.setPhase(hub, 0);
+            diagram.setPhase(leaf, -diagram.getPhase(leaf));
+        }
+
+        auto found = gadgets.find(support);
+        if (found != gadgets.end() && diagram.isAlive(found->second)) {
+            diagram.addToPhase(found->second, diagram.getPhase(leaf));
+            diagram.removeVertex(leaf);
+            diagram.removeVertex(hub);
+            touched.insert(touched.end(), support.begin(), support.end());
+            touched.push_back(found->second);
+            ++removed;
+        } else if (isZeroPhase(diagram.getPhase(leaf))) {
+            diagram.removeVertex(leaf);
+            diagram.removeVertex(hub);
+            touched.insert(touched.end(), support.begin(), support.end());
+            ++removed;
+        } else {
+            gadgets[std::move(support)] = leaf;
+        }
+    }
+
+    // a fused leaf may have lost its phase
+    for (auto &gadget : gadgets) {
+        const vertex_t leaf = gadget.second;
+        if (diagram.isAlive(leaf) && isZeroPhase(diagram.getPhase(leaf))) {
+            const vertex_t hub = diagram.getNeighbours(leaf).begin()->key;
+            diagram.removeVertex(leaf);
+            diagram.removeVertex(hub);
+            touched.insert(touched.end(), gadget.first.begin(), gadget.first.end());
+            ++removed;
+        }
+    }
+    return removed;
+}
+
+std::size_t fuseGadgets(ZXDiagram &diagram) {
+    std::vector<vertex_t> touched{};
+    return fuseGadgets(diagram, touched);
+}
+
+namespace {
+
+// work list driven rule matching
+class Reducer {
+   private:
+    ZXDiagram &diagram;
+    bool gadgets;
+    std::vector<vertex_t> work{};
+    std::vector<bool> queued{};
+    std::size_t rewrites = 0;
+
+    void touch(vertex_t v) {
+        if (!this->diagram.isAlive(v) || this->diagram.isBoundary(v)) {
+            return;
+        }
+        if (this->queued.size() <= v) {
+            this->queued.resize(this->diagram.vertexBound(), false);
+        }
+        if (!this->queued[v]) {
+            this->queued[v] = true;
+            this->work.push_back(v);
+        }
+    }
+
+    void touchAll(const std::vector<vertex_t> &vertices) {
+        for (auto v : vertices) {
+            touch(v);
+        }
+    }
+
+    std::vector<vertex_t> neighbourKeys(vertex_t v) const {
+        std::vector<vertex_t> keys{};
+        keys.reserve(this->diagram.degree(v));
+        for (const auto &entry : this->diagram.getNeighbours(v)) {
+            keys.push_back(entry.key);
+        }
+        return keys;
+    }
+
+    // interior spider that takes part in pivots
+    bool pivotable(vertex_t v) const {
+        return this->diagram.degree(v) > 1 && this->diagram.isInterior(v) && !isHub(this->diagram, v);
+    }
+
+    bool removeIdentity(vertex_t v) {
+        if (this->diagram.degree(v) == 0) {
+            this->diagram.removeVertex(v);  // scalar
+            return true;
+        }
+        if (this->diagram.degree(v) != 2 || !isZeroPhase(this->diagram.getPhase(v)) || !this->diagram.isInterior(v)) {
+            return false;
+        }
+
+        const auto neighbours = neighbourKeys(v);
+        this->diagram.removeVertex(v);
+        this->diagram.addEdge(neighbours[0], neighbours[1], EdgeType::SIMPLE);
+        fuseSpiders(this->diagram, neighbours[0], neighbours[1]);
+        touch(neighbours[0]);
+        touchAll(neighbourKeys(neighbours[0]));
+        return true;
+    }
+
+    bool complement(vertex_t v) {
+        if (!isProperCliffordPhase(this->diagram.getPhase(v)) || !this->diagram.isInterior(v)) {
+            return false;
+        }
+        const auto neighbours = neighbourKeys(v);
+        localComplement(this->diagram, v);
+        touchAll(neighbours);
+        return true;
+    }
+
+    bool pivotPauli(vertex_t v) {
+        if (!isPauliPhase(this->diagram.getPhase(v)) || !pivotable(v)) {
+            return false;
+        }
+
+        vertex_t partner = FlatHashMap<vertex_t, EdgeType>::EMPTY, gadget = partner;
+        for (const auto &entry : this->diagram.getNeighbours(v)) {
+            const vertex_t w = entry.key;
+            if (!pivotable(w)) {
+                continue;
+            }
+            if (isPauliPhase(this->diagram.getPhase(w))) {
+                partner = w;
+                break;
+            }
+            if (this->gadgets && gadget == FlatHashMap<vertex_t, EdgeType>::EMPTY && !isCliffordPhase(this->diagram.getPhase(w))) {
+                gadget = w;
+            }
+        }
+        if (partner == FlatHashMap<vertex_t, EdgeType>::EMPTY) {
+            if (gadget == FlatHashMap<vertex_t, EdgeType>::EMPTY) {
+                return false;
+            }
+            unfusePhaseGadget(this->diagram, gadget);
+            partner = gadget;
+        }
+
+        auto neighbours = neighbourKeys(v);
+        const auto partner_neighbours = neighbourKeys(partner);
+        neighbours.insert(neighbours.end(), partner_neighbours.begin(), partner_neighbours.end());
+        pivot(this->diagram, v, partner);
+        touchAll(neighbours);
+        return true;
+    }
+
+   public:
+    Reducer(ZXDiagram &diagram, bool gadgets) : diagram(diagram), gadgets(gadgets), queued(diagram.vertexBound(), false) {}
+
+    std::size_t run() {
+        for (vertex_t v = 0; v < this->diagram.vertexBound(); ++v) {
+            touch(v);
+        }
+
+        while (true) {
+            while (!this->work.empty()) {
+                const vertex_t v = this->work.back();
+                this->work.pop_back();
+                this->queued[v] = false;
+                if (!this->diagram.isAlive(v)) {
+                    continue;
+                }
+                if (removeIdentity(v) || complement(v) || pivotPauli(v)) {
+                    ++this->rewrites;
+                }
+            }
+
+            if (!this->gadgets) {
+                break;
+            }
+            std::vector<vertex_t> touched{};
+            const auto fused = fuseGadgets(this->diagram, touched);
+            if (fused == 0) {
+                break;
+            }
+            this->rewrites += fused;
+            touchAll(touched);
+        }
+        return this->rewrites;
+    }
+};
+
+}  // namespace
+
+std::size_t fullReduce(ZXDiagram &diagram, bool gadgets) {
+    toGraphLike(diagram);
+    return Reducer(diagram, gadgets).run();
+}
+
+}  // namespace qcore
@@ -0,0 +1,311 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   ZXDiagram.cpp
+ *  @brief  Instance Description for the ZX-Diagram Representation of Quantum Circuits
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include "zx/ZXDiagram.hpp"
+
+#include <algorithm>
+
+#include "Angle.hpp"
+
+namespace qcore {
+
+vertex_t ZXDiagram::addVertex(VertexType type, fp phase) {
+    const auto v = static_cast<vertex_t>(this->types.size());
+    this->types.push_back(type);
+    this->phases.push_back(normalizeAngle(phase));
+    this->adjacency.emplace_back();
+    this->alive.push_back(true);
+    ++this->vertices;
+    return v;
+}
+
+void ZXDiagram::removeVertex(vertex_t v) {
+    if (!isAlive(v)) {
+        return;
+    }
+    for (const auto &entry : this->adjacency[v]) {
+        this->adjacency[entry.key].erase(v);
+    }
+    this->edges -= this->adjacency[v].size();
+    this->adjacency[v].clear();
+    this->alive[v] = false;
+    --this->vertices;
+}
+
+void ZXDiagram::addEdge(vertex_t u, vertex_t v, EdgeType type) {
+    if (u == v) {
+        if (type == EdgeType::HADAMARD) {
+            addToPhase(u, PI);
+        }
+        return;
+    }
+
+    auto *existing = this->adjacency[u].find(v);
+    if (existing == nullptr) {
+        this->adjacency[u].insert(v, type);
+        this->adjacency[v].insert(u, type);
+        ++this->edges;
+        return;
+    }
+
+    if (isBoundary(u) || isBoundary(v)) {
+        throw QcoreException("[ZXDiagram::addEdge] vertices: " + std::to_string(u) + ", " + std::to_string(v) + " msg: parallel edge at a boundary");
+    }
+    if (*existing == EdgeType::HADAMARD && type == EdgeType::HADAMARD) {
+        removeEdge(u, v);
+    } else if (*existing != type) {
+        setEdgeType(u, v, EdgeType::SIMPLE);
+        addToPhase(u, PI);
+    }
+}
+
+void ZXDiagram::removeEdge(vertex_t u, vertex_t v) {
+    if (this->adjacency[u].erase(v)) {
+        this->adjacency[v].erase(u);
+        --this->edges;
+    }
+}
+
+void ZXDiagram::setEdgeType(vertex_t u, vertex_t v, EdgeType type) {
+    this->adjacency[u].insert(v, type);
+    this->adjacency[v].insert(u, type);
+}
+
+void ZXDiagram::setPhase(vertex_t v, fp phase) {
+    this->phases[v] = normalizeAngle(phase);
+}
+
+void ZXDiagram::addToPhase(vertex_t v, fp phase) {
+    this->phases[v] = normalizeAngle(this->phases[v] + phase);
+}
+
+bool ZXDiagram::isInterior(vertex_t v) const {
+    for (const auto &entry : this->adjacency[v]) {
+        if (isBoundary(entry.key)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// phase of a single-angle rotation, false if it is not a constant expression
+static bool rotationAngle(QGate &gate, fp &angle) {
+    auto &angles = gate.getAngle();
+    return angles.size() == 1 && tryAngleValue(angles.begin()->second, angle);
+}
+
+bool isZXGate(QGate &gate) {
+    if (gate.getIsClassical()) {
+        return false;
+    }
+
+    const auto controls = gate.getControls().size(), targets = gate.getTargets().size();
+    fp angle = 0;
+    switch (gate.getType()) {
+        case GateType::I:
+        case GateType::H:
+        case GateType::X:
+        case GateType::Y:
+        case GateType::Z:
+        case GateType::S:
+        case GateType::SDG:
+        case GateType::T:
+        case GateType::TDG:
+        case GateType::SX:
+        case GateType::SXDG:
+        case GateType::V:
+        case GateType::VDG:
+            return controls == 0 && targets == 1;
+        case GateType::RX:
+        case GateType::RZ:
+        case GateType::P:
+        case GateType::U1:
+            return controls == 0 && targets == 1 && rotationAngle(gate, angle);
+        case GateType::CX:
+        case GateType::CZ:
+            return controls == 1 && targets == 1 && gate.getControls()[0] != gate.getTargets()[0];
+        case GateType::SWAP:
+            return controls == 0 && targets == 2 && gate.getTargets()[0] != gate.getTargets()[1];
+        default:
+            return false;
+    }
+}
+
+namespace {
+
+// open wire ends while a circuit is translated
+class WireBuilder {
+   private:
+    ZXDiagram &diagram;
+    std::vector<vertex_t> last;
+    std::vector<bool> hadamard;
+
+   public:
+    WireBuilder(ZXDiagram &diagram, std::size_t qubits) : diagram(diagram), last(qubits), hadamard(qubits, false) {
+        for (std::size_t q = 0; q < qubits; ++q) {
+            last[q] = diagram.addVertex(VertexType::BOUNDARY);
+            diagram.getInputs().push_back(last[q]);
+        }
+    }
+
+    // attaches a new vertex to the end of a wire
+    void attach(const Qubit &q, vertex_t v) {
+        this->diagram.addEdge(this->last[q], v, this->hadamard[q] ? EdgeType::HADAMARD : EdgeType::SIMPLE);
+        this->last[q] = v;
+        this->hadamard[q] = false;
+    }
+
+    // Z spider at the end of a wire, reusing the last one while the wire is simple
+    vertex_t zSpider(const Qubit &q) {
+        if (!this->hadamard[q] && !this->diagram.isBoundary(this->last[q])) {
+            return this->last[q];
+        }
+        const vertex_t v = this->diagram.addVertex(VertexType::Z);
+        attach(q, v);
+        return v;
+    }
+
+    // X spider at the end of a wire, as a Z spider between Hadamard edges
+    vertex_t xSpider(const Qubit &q) {
+        this->hadamard[q] = !this->hadamard[q];
+        const vertex_t v = zSpider(q);
+        this->hadamard[q] = !this->hadamard[q];
+        return v;
+    }
+
+    void zPhase(const Qubit &q, fp phase) { this->diagram.addToPhase(zSpider(q), phase); }
+
+    void xPhase(const Qubit &q, fp phase) { this->diagram.addToPhase(xSpider(q), phase); }
+
+    void h(const Qubit &q) { this->hadamard[q] = !this->hadamard[q]; }
+
+    void swap(const Qubit &a, const Qubit &b) {
+        std::swap(this->last[a], this->last[b]);
+        const bool h = this->hadamard[a];
+        this->hadamard[a] = this->hadamard[b];
+        this->hadamard[b] = h;
+    }
+
+    void close() {
+        for (Qubit q = 0; q < this->last.size(); ++q) {
+            const vertex_t output = this->diagram.addVertex(VertexType::BOUNDARY);
+            attach(q, output);
+            this->diagram.getOutputs().push_back(output);
+        }
+    }
+};
+
+}  // namespace
+
+ZXDiagram circuitToZX(QCircuit &qc) {
+    std::size_t qubits = qc.getQregSize();
+    for (auto &g : qc.getGates()) {
+        for (auto *operands : {&g->getControls(), &g->getTargets()}) {
+            for (auto q : *operands) {
+                qubits = std::max<std::size_t>(qubits, q + 1);
+            }
+        }
+    }
+
+    ZXDiagram diagram{};
+    WireBuilder wires(diagram, qubits);
+
+    for (auto &g : qc.getGates()) {
+        if (!isZXGate(*g)) {
+            throw QcoreException("[circuitToZX] gate: " + toString(g->getType()) + " msg: no ZX-diagram translation");
+        }
+
+        auto &targets = g->getTargets();
+        fp angle = 0;
+        switch (g->getType()) {
+            case GateType::H:
+                wires.h(targets[0]);
+                break;
+            case GateType::X:
+                wires.xPhase(targets[0], PI);
+                break;
+            case GateType::Y:
+                wires.zPhase(targets[0], PI);
+                wires.xPhase(targets[0], PI);
+                break;
+            case GateType::Z:
+                wires.zPhase(targets[0], PI);
+                break;
+            case GateType::S:
+                wires.zPhase(targets[0], PI / 2);
+                break;
+            case GateType::SDG:
+                wires.zPhase(targets[0], -PI / 2);
+                break;
+            case GateType::T:
+                wires.zPhase(targets[0], PI / 4);
+                break;
+            case GateType::TDG:
+                wires.zPhase(targets[0], -PI / 4);
+                break;
+            case GateType::SX:
+            case GateType::V:
+                wires.xPhase(targets[0], PI / 2);
+                break;
+            case GateType::SXDG:
+            case GateType::VDG:
+                wires.xPhase(targets[0], -PI / 2);
+                break;
+            case GateType::RX:
+                rotationAngle(*g, angle);
+                wires.xPhase(targets[0], angle);
+                break;
+            case GateType::RZ:
+            case GateType::P:
+            case GateType::U1:
+                rotationAngle(*g, angle);
+                wires.zPhase(targets[0], angle);
+                break;
+            case GateType::CX: {
+                const vertex_t control = wires.zSpider(g->getControls()[0]);
+                diagram.addEdge(control, wires.xSpider(targets[0]), EdgeType::HADAMARD);
+                break;
+            }
+            case GateType::CZ: {
+                const vertex_t control = wires.zSpider(g->getControls()[0]);
+                diagram.addEdge(control, wires.zSpider(targets[0]), EdgeType::HADAMARD);
+                break;
+            }
+            case GateType::SWAP:
+                wires.swap(targets[0], targets[1]);
+                break;
+            default:
+                break;  // identity
+        }
+    }
+    wires.close();
+
+    return diagram;
+}
+
+}  // namespace qcore
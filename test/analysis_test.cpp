@@ -0,0 +1,132 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   analysis_test.cpp
+ *  @brief  Unit Test for Batch Circuit Analysis
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include <atomic>
+#include <filesystem>
+
+#include <gtest/gtest.h>
+
+#include "QCircuit.hpp"
+#include "analysis/Batch.hpp"
+#include "analysis/Liveness.hpp"
+#include "parallel/ThreadPool.hpp"
+
+std::string test_resource(const std::string& filename) {
+    return (std::filesystem::path(TEST_RESOURCES_DIR) / filename).string();
+}
+
+TEST(ThreadPoolTest, RunsEveryTask) {
+    qcore::ThreadPool pool(4, 2);
+    std::atomic<int> sum{0};
+    for (int i = 1; i <= 1000; ++i) {
+        pool.submit([&sum, i] { sum += i; });
+    }
+    pool.wait();
+    ASSERT_EQ(sum.load(), 500500);
+}
+
+TEST(ThreadPoolTest, ParallelForCoversRange) {
+    qcore::ThreadPool pool(3);
+    std::vector<int> hits(10007, 0);
+    qcore::parallelFor(pool, hits.size(), [&hits](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            hits[i] += 1;
+        }
+    });
+    for (auto hit : hits) {
+        ASSERT_EQ(hit, 1);
+    }
+}
+
+TEST(LivenessTest, CleanAndIdleQubits) {
+    using namespace qcore;
+    QCircuit qc(5, 0);
+    auto& gates = qc.getGates();
+    gates.push_back(std::make_unique<QGate>(GateType::H, 1, TargetSet{0}));
+    gates.push_back(std::make_unique<QGate>(GateType::CX, 2, ControlSet{0}, TargetSet{1}));
+    gates.push_back(std::make_unique<QGate>(GateType::RESET, 1, TargetSet{1}));
+    gates.push_back(std::make_unique<QGate>(GateType::X, 1, TargetSet{3}));
+    gates.push_back(std::make_unique<QGate>(GateType::BARRIER, 2, TargetSet{2, 4}));
+    gates.push_back(std::make_unique<QGate>(GateType::CX, 2, ControlSet{0}, TargetSet{3}));
+
+    QubitLiveness liveness(qc);
+    ASSERT_EQ(liveness.width(), 5);
+    ASSERT_FALSE(liveness.isClean(1, 2));
+    ASSERT_TRUE(liveness.isClean(1, 3));
+    ASSERT_TRUE(liveness.isClean(2, 5));
+    ASSERT_FALSE(liveness.isClean(3, 4));
+    ASSERT_EQ(liveness.previousUse(0, 5), 1);
+    ASSERT_EQ(liveness.nextUse(0, 1), 5);
+    ASSERT_EQ(liveness.nextUse(4, 0), QubitLiveness::NO_USE);
+
+    QubitSet dirty, clean;
+    liveness.ancillasAt(3, dirty, clean);
+    ASSERT_EQ(clean, (QubitSet{1, 2, 4}));
+    ASSERT_EQ(dirty, (QubitSet{0}));
+
+    // copies keep both register sizes
+    QCircuit copy(qc);
+    ASSERT_EQ(copy.getQregSize(), 5);
+    ASSERT_EQ(copy.getCregSize(), 0);
+    ASSERT_EQ(QubitLiveness(copy).width(), 5);
+}
+
+TEST(BatchAnalysisTest, DirectoryWithFailures) {
+    auto summaries = qcore::analyzeQCircuitDirectory(test_resource("batch"), 2);
+    ASSERT_EQ(summaries.size(), 3);
+
+    // sorted by path: bell, ghz, invalid
+    ASSERT_TRUE(summaries[0].valid);
+    ASSERT_EQ(summaries[0].qreg, 2);
+    ASSERT_EQ(summaries[0].creg, 2);
+    ASSERT_EQ(summaries[0].gates, 4);
+    ASSERT_EQ(summaries[0].properties[qcore::GateType::MEASURE], 2);
+
+    ASSERT_TRUE(summaries[1].valid);
+    ASSERT_EQ(summaries[1].properties[qcore::GateType::CX], 3);
+
+    ASSERT_FALSE(summaries[2].valid);
+    ASSERT_FALSE(summaries[2].error.empty());
+
+    auto rows = qcore::toJSON(summaries);
+    ASSERT_EQ(rows.size(), 3);
+    ASSERT_EQ(rows[0]["GateSummary"]["cx"], 1);
+    ASSERT_TRUE(rows[2].contains("Error"));
+
+    auto columns = qcore::toColumnarJSON(summaries);
+    ASSERT_EQ(columns["GateSummary"]["cx"], nlohmann::json({1, 3, 0}));
+    ASSERT_TRUE(columns["Error"][0].is_null());
+    ASSERT_TRUE(columns["Error"][2].is_string());
+}
+
+TEST(BatchAnalysisTest, MissingFileIsReported) {
+    auto summaries = qcore::analyzeQCircuits({test_resource("batch/bell.qasm"), test_resource("batch/none.qasm")}, 2);
+    ASSERT_EQ(summaries.size(), 2);
+    ASSERT_TRUE(summaries[0].valid);
+    ASSERT_FALSE(summaries[1].valid);
+}
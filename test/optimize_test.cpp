@@ -0,0 +1,1445 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   optimize_test.cpp
+ *  @brief  Unit Test for Circuit Optimization Passes
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "Angle.hpp"
+#include "QCircuit.hpp"
+#include "Tableau.hpp"
+#include "Unitary.hpp"
+#include "analysis/Liveness.hpp"
+#include "decompose/BasisTranslation.hpp"
+#include "decompose/Clifford_T.hpp"
+#include "decompose/Decompose.hpp"
+#include "decompose/DecomposedView.hpp"
+#include "decompose/RotationSynthesis.hpp"
+#include "optimize/BlockConsolidation.hpp"
+#include "optimize/CliffordSynthesis.hpp"
+#include "optimize/Commutation.hpp"
+#include "optimize/InverseCancellation.hpp"
+#include "optimize/LinearSynthesis.hpp"
+#include "optimize/PassManager.hpp"
+#include "optimize/PhaseFolding.hpp"
+#include "optimize/RotationMerging.hpp"
+#include "optimize/SingleQubitFusion.hpp"
+#include "optimize/TemplateRewriting.hpp"
+#include "optimize/ZXSimplification.hpp"
+#include "zx/Extraction.hpp"
+#include "zx/FlatHashMap.hpp"
+#include "zx/Simplify.hpp"
+#include "zx/ZXDiagram.hpp"
+
+using namespace qcore;
+
+QCircuit parse_qasm(const std::string& body, regsize_t qreg) {
+    auto qasm = std::istringstream("OPENQASM 2.0;\ninclude \"qelib1.inc\";\nqreg q[" + std::to_string(qreg) +
+                                   "];\ncreg c[" + std::to_string(qreg) + "];\n" + body);
+    QCircuit qc;
+    qc.readQASM(qasm);
+    return qc;
+}
+
+// dense unitary (column major) of a small circuit made of single target and swap gates
+std::vector<Complex> circuit_unitary(QCircuit& qc, std::size_t n) {
+    const std::size_t dim = std::size_t{1} << n;
+    std::vector<Complex> unitary(dim * dim, 0);
+    for (std::size_t col = 0; col < dim; ++col) {
+        std::vector<Complex> state(dim, 0);
+        state[col] = 1;
+        for (auto& g : qc.getGates()) {
+            std::size_t control_mask = 0;
+            for (auto c : g->getControls()) {
+                control_mask |= std::size_t{1} << c;
+            }
+            if (g->getControls().empty() && g->getTargets().size() == 2) {
+                auto low = g->getTargets()[0], high = g->getTargets()[1];
+                Matrix4 m{};
+                EXPECT_TRUE(tryTwoQubitMatrix(*g, low, high, m)) << "unsupported gate " << toString(g->getType());
+                for (std::size_t i = 0; i < dim; ++i) {
+                    if (((i >> low) & 1) == 0 && ((i >> high) & 1) == 0) {
+                        const std::array<std::size_t, 4> index{i, i | (std::size_t{1} << low), i | (std::size_t{1} << high),
+                                                               i | (std::size_t{1} << low) | (std::size_t{1} << high)};
+                        std::array<Complex, 4> amplitudes{};
+                        for (std::size_t r = 0; r < 4; ++r) {
+                            for (std::size_t c = 0; c < 4; ++c) {
+                                amplitudes[r] += m[4 * r + c] * state[index[c]];
+                            }
+                        }
+                        for (std::size_t r = 0; r < 4; ++r) {
+                            state[index[r]] = amplitudes[r];
+                        }
+                    }
+                }
+                continue;
+            }
+            Matrix2 m{};
+            EXPECT_TRUE(tryTargetMatrix(*g, m)) << "unsupported gate " << toString(g->getType());
+            const std::size_t bit = std::size_t{1} << g->getTargets().front();
+            for (std::size_t i = 0; i < dim; ++i) {
+                if ((i & bit) == 0 && (i & control_mask) == control_mask) {
+                    Complex a0 = state[i], a1 = state[i | bit];
+                    state[i] = m[0] * a0 + m[1] * a1;
+                    state[i | bit] = m[2] * a0 + m[3] * a1;
+                }
+            }
+        }
+        std::copy(state.begin(), state.end(), unitary.begin() + col * dim);
+    }
+    return unitary;
+}
+
+bool equal_up_to_phase(const std::vector<Complex>& lhs, const std::vector<Complex>& rhs, fp tolerance = 1e-8) {
+    std::size_t pivot = 0;
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        if (std::abs(lhs[i]) > std::abs(lhs[pivot])) {
+            pivot = i;
+        }
+    }
+    if (std::abs(rhs[pivot]) < tolerance) {
+        return false;
+    }
+    Complex phase = lhs[pivot] / rhs[pivot];
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        if (std::abs(lhs[i] - phase * rhs[i]) > tolerance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// equality up to a common phase on the first columns, i.e. for inputs with the upper qubits |0>
+bool equal_on_columns(const std::vector<Complex>& lhs, const std::vector<Complex>& rhs, std::size_t columns, fp tolerance = 1e-8) {
+    const std::size_t dim = static_cast<std::size_t>(std::sqrt(static_cast<fp>(lhs.size())) + 0.5);
+    return equal_up_to_phase(std::vector<Complex>(lhs.begin(), lhs.begin() + columns * dim),
+                             std::vector<Complex>(rhs.begin(), rhs.begin() + columns * dim), tolerance);
+}
+
+TEST(InverseCancellationTest, AdjacentPairs) {
+    auto qc = parse_qasm("h q[0];\nh q[0];\nt q[1];\ntdg q[1];\ns q[2];\nsdg q[2];\ncx q[0],q[1];\ncx q[0],q[1];\n", 3);
+    ASSERT_EQ(cancelInversePairs(qc), 8);
+    ASSERT_EQ(qc.getGates().size(), 0);
+    ASSERT_TRUE(qc.getProperties().empty());
+}
+
+TEST(InverseCancellationTest, NestedPairsCascade) {
+    auto qc = parse_qasm("h q[1];\ncx q[0],q[1];\nt q[1];\ntdg q[1];\ncx q[0],q[1];\nh q[1];\nx q[2];\n", 3);
+    ASSERT_EQ(cancelInversePairs(qc), 6);
+    ASSERT_EQ(qc.getGates().size(), 1);
+    ASSERT_EQ(qc.getGates()[0]->getType(), GateType::X);
+}
+
+TEST(InverseCancellationTest, BlockedPairsStay) {
+    // x on the target separates the two cx, the swapped cx operands do not match either
+    auto qc = parse_qasm("cx q[0],q[1];\nx q[1];\ncx q[0],q[1];\ncx q[1],q[0];\nrz(pi/4) q[0];\nrz(pi/4) q[0];\nmeasure q[0] -> c[0];\nmeasure q[0] -> c[0];\n", 2);
+    ASSERT_EQ(cancelInversePairs(qc), 0);
+    ASSERT_EQ(qc.getGates().size(), 8);
+}
+
+TEST(InverseCancellationTest, RelativePhaseGatesStay) {
+    QCircuit qc(4, 0);
+    for (int i = 0; i < 2; ++i) {
+        qc.getGates().push_back(std::make_unique<QGate>(GateType::RC3X, 4, ControlSet{0, 1, 2}, TargetSet{3}));
+    }
+    for (int i = 0; i < 2; ++i) {
+        qc.getGates().push_back(std::make_unique<QGate>(GateType::ISWAP, 2, TargetSet{0, 1}));
+    }
+    ASSERT_EQ(cancelInversePairs(qc), 0);
+    ASSERT_EQ(qc.getGates().size(), 4);
+}
+
+TEST(InverseCancellationTest, ToffoliFollowedByInverse) {
+    Qubit a = 0, b = 1, c = 2;
+    auto qc = decompose_CCX_Clifford_T(a, b, c);
+    qc.addQCircuit(decompose_CCX_Clifford_T(a, b, c, true));
+
+    ASSERT_EQ(cancelInversePairs(qc), 30);
+    ASSERT_EQ(qc.getGates().size(), 0);
+}
+
+TEST(AngleTest, ParseAndFormat) {
+    ASSERT_NEAR(angleValue("pi/4"), PI / 4, 1e-12);
+    ASSERT_NEAR(angleValue("-pi / 2"), -PI / 2, 1e-12);
+    ASSERT_NEAR(angleValue("3*pi/4"), 3 * PI / 4, 1e-12);
+    ASSERT_NEAR(angleValue("2pi"), 2 * PI, 1e-12);
+    ASSERT_NEAR(angleValue("2*(pi-0.5)"), 2 * (PI - 0.5), 1e-12);
+    ASSERT_NEAR(angleValue("1e-3"), 1e-3, 1e-15);
+    ASSERT_THROW(angleValue("theta"), QcoreException);
+
+    ASSERT_EQ(angleString(PI / 4), "pi/4");
+    ASSERT_EQ(angleString(-PI), "pi");
+    ASSERT_EQ(angleString(0.25), "0.25");
+    ASSERT_NEAR(angleValue(angleString(-0.3)), 2 * PI - 0.3, 1e-12);
+}
+
+TEST(RotationMergingTest, MergesThroughDiagonalGates) {
+    auto qc = parse_qasm("rz(0.25) q[0];\ncx q[0],q[1];\nrz(0.5) q[0];\ncz q[0],q[1];\nt q[0];\nh q[0];\nrz(0.1) q[0];\n", 2);
+    ASSERT_EQ(mergeRotations(qc), 2);
+    ASSERT_EQ(qc.getGates().size(), 5);
+    ASSERT_NEAR(angleValue(qc.getGates()[0]->getAngle()[RotationType::THETA]), 0.75 + PI / 4, 1e-12);
+    ASSERT_EQ(qc.getGates()[3]->getType(), GateType::H);
+}
+
+TEST(RotationMergingTest, FoldsFullTurns) {
+    auto qc = parse_qasm("rx(pi) q[0];\ncx q[1],q[0];\nrx(pi) q[0];\nry(pi/2) q[1];\nry(1.5) q[1];\nu1(pi) q[2];\nz q[2];\n", 3);
+    ASSERT_EQ(mergeRotations(qc), 5);
+    ASSERT_EQ(qc.getGates().size(), 2);
+    ASSERT_EQ(qc.getGates()[0]->getType(), GateType::CX);
+    ASSERT_EQ(qc.getGates()[1]->getType(), GateType::RY);
+}
+
+TEST(RotationMergingTest, CliffordTEmission) {
+    auto qc = parse_qasm("rz(pi/2) q[0];\nrz(pi/4) q[0];\nt q[1];\nt q[1];\np(0.3) q[2];\n", 3);
+    mergeRotations(qc, true);
+    ASSERT_EQ(qc.getGates().size(), 4);
+    ASSERT_EQ(qc.getGates()[0]->getType(), GateType::S);
+    ASSERT_EQ(qc.getGates()[1]->getType(), GateType::T);
+    ASSERT_EQ(qc.getGates()[2]->getType(), GateType::S);
+    ASSERT_EQ(qc.getGates()[3]->getType(), GateType::P);
+}
+
+TEST(UnitaryTest, ZYZDecompositionRoundTrip) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<fp> angle(-2 * PI, 2 * PI);
+    std::vector<Matrix2> samples{IDENTITY2, fixedMatrix(GateType::X), fixedMatrix(GateType::Y), fixedMatrix(GateType::H),
+                                 fixedMatrix(GateType::T), fixedMatrix(GateType::SX), u3Matrix(1e-12, 0.3, 0.1), u3Matrix(PI - 1e-12, 0.3, 0.1)};
+    for (int i = 0; i < 50; ++i) {
+        auto m = u3Matrix(angle(rng), angle(rng), angle(rng));
+        auto phase = std::polar(1.0, angle(rng));
+        for (auto& entry : m) {
+            entry *= phase;
+        }
+        samples.push_back(m);
+    }
+    for (auto& m : samples) {
+        auto euler = zyzDecomposition(m);
+        auto r = u3Matrix(euler.theta, euler.phi, euler.lambda);
+        for (std::size_t k = 0; k < 4; ++k) {
+            ASSERT_NEAR(std::abs(m[k] - std::polar(1.0, euler.phase) * r[k]), 0, 1e-9);
+        }
+    }
+}
+
+TEST(SingleQubitFusionTest, RunsBecomeU3) {
+    auto qc = parse_qasm("h q[0];\nt q[0];\nrx(0.3) q[0];\ncx q[0],q[1];\ns q[1];\nh q[1];\nsx q[0];\nh q[2];\nh q[2];\nu3(0.1,0.2,0.3) q[1];\n", 3);
+    auto expected = circuit_unitary(qc, 3);
+    ASSERT_EQ(fuseSingleQubitRuns(qc), 6);
+    ASSERT_EQ(qc.getGates().size(), 4);
+    ASSERT_EQ(qc.getGates()[0]->getType(), GateType::U3);
+    ASSERT_EQ(qc.getGates()[1]->getType(), GateType::CX);
+    ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(qc, 3)));
+}
+
+TEST(SingleQubitFusionTest, RandomCircuitsStayEquivalent) {
+    std::mt19937 rng(11);
+    const std::vector<std::string> ops{"h", "t", "tdg", "s", "sdg", "x", "y", "z", "sx", "rz(0.7)", "ry(1.3)", "p(2.1)", "u2(0.4,1.1)"};
+    for (int trial = 0; trial < 20; ++trial) {
+        std::string body{};
+        for (int i = 0; i < 40; ++i) {
+            if (rng() % 4 == 0) {
+                int a = rng() % 3, b = (a + 1 + rng() % 2) % 3;
+                body += "cx q[" + std::to_string(a) + "],q[" + std::to_string(b) + "];\n";
+            } else {
+                body += ops[rng() % ops.size()] + " q[" + std::to_string(rng() % 3) + "];\n";
+            }
+        }
+        auto qc = parse_qasm(body, 3);
+        auto expected = circuit_unitary(qc, 3);
+        fuseSingleQubitRuns(qc);
+        ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(qc, 3))) << body;
+    }
+}
+
+TEST(UnitaryTest, KAKDecompositionRoundTrip) {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<fp> angle(-PI, PI);
+    auto local = [&]() { return u3Matrix(angle(rng), angle(rng), angle(rng)); };
+
+    for (int trial = 0; trial < 50; ++trial) {
+        // random products of locals and canonical interactions, including degenerate ones
+        Matrix4 u = kron(local(), local());
+        for (int layer = 0; layer < 3; ++layer) {
+            fp a = (trial % 3 == 0) ? 0 : angle(rng), b = (trial % 5 == 0) ? PI / 4 : angle(rng), c = (trial % 2 == 0) ? 0 : angle(rng);
+            u = multiply(kron(local(), local()), multiply(canonicalMatrix(a, b, c), u));
+        }
+
+        auto kak = kakDecomposition(u);
+        Matrix4 rebuilt = multiply(kron(kak.after_high, kak.after_low),
+                                   multiply(canonicalMatrix(kak.a, kak.b, kak.c), kron(kak.before_high, kak.before_low)));
+        for (std::size_t k = 0; k < 16; ++k) {
+            ASSERT_NEAR(std::abs(u[k] - std::polar(1.0, kak.phase) * rebuilt[k]), 0, 1e-9) << "trial " << trial;
+        }
+    }
+}
+
+TEST(BlockConsolidationTest, LowersCXCount) {
+    auto qc = parse_qasm("cx q[0],q[1];\nh q[0];\ncx q[1],q[0];\nrz(0.3) q[1];\ncx q[0],q[1];\nt q[0];\ncx q[1],q[0];\nswap q[0],q[1];\nh q[2];\n", 3);
+    auto expected = circuit_unitary(qc, 3);
+    ASSERT_EQ(consolidateTwoQubitBlocks(qc, 2), 5);
+    gcount_t cx = 0;
+    for (auto& g : qc.getGates()) {
+        cx += cxCost(*g);
+    }
+    ASSERT_EQ(cx, 2);
+    ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(qc, 3)));
+
+    // a single CX cannot be improved and stays untouched
+    auto single = parse_qasm("h q[0];\ncx q[0],q[1];\n", 2);
+    ASSERT_EQ(consolidateTwoQubitBlocks(single), 0);
+    ASSERT_EQ(single.getGates().size(), 2);
+}
+
+TEST(BlockConsolidationTest, SynthesisUsesMinimalCXCount) {
+    const std::vector<std::pair<std::string, gcount_t>> blocks{
+        {"h q[0];\nt q[1];\n", 0},
+        {"cx q[1],q[0];\nh q[1];\n", 1},
+        {"cz q[0],q[1];\nrx(0.4) q[0];\ncz q[0],q[1];\n", 2},
+        {"rzz(0.7) q[0],q[1];\n", 2},
+        {"iswap q[0],q[1];\n", 2},
+        {"swap q[0],q[1];\n", 3},
+    };
+    for (auto& block : blocks) {
+        auto qc = parse_qasm(block.first, 2);
+        auto expected = circuit_unitary(qc, 2);
+
+        Matrix4 unitary{};
+        for (std::size_t k = 0; k < 4; ++k) {
+            unitary[5 * k] = 1;
+        }
+        for (auto& g : qc.getGates()) {
+            Matrix4 m{};
+            ASSERT_TRUE(tryTwoQubitMatrix(*g, 0, 1, m));
+            unitary = multiply(m, unitary);
+        }
+
+        QCircuit synthesized(2, 0);
+        gcount_t cx = 0;
+        for (auto& g : synthesizeTwoQubitUnitary(unitary, 0, 1)) {
+            cx += cxCost(*g);
+            synthesized.addQGate(*g);
+        }
+        ASSERT_EQ(cx, block.second) << block.first;
+        ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(synthesized, 2))) << block.first;
+    }
+}
+
+TEST(BlockConsolidationTest, RandomCircuitsStayEquivalent) {
+    std::mt19937 rng(23);
+    const std::vector<std::string> ones{"h", "t", "s", "sx", "rz(0.7)", "ry(1.3)", "u3(0.4,1.1,2.5)"};
+    const std::vector<std::string> twos{"cx", "cz", "cy", "swap", "crz(0.9)", "cp(1.7)", "rxx(0.3)", "ch"};
+    for (int trial = 0; trial < 30; ++trial) {
+        std::string body{};
+        for (int i = 0; i < 30; ++i) {
+            if (rng() % 2 == 0) {
+                int a = rng() % 3, b = (a + 1 + rng() % 2) % 3;
+                body += twos[rng() % twos.size()] + " q[" + std::to_string(a) + "],q[" + std::to_string(b) + "];\n";
+            } else {
+                body += ones[rng() % ones.size()] + " q[" + std::to_string(rng() % 3) + "];\n";
+            }
+        }
+        auto qc = parse_qasm(body, 3);
+        auto expected = circuit_unitary(qc, 3);
+        gcount_t before = 0, after = 0;
+        for (auto& g : qc.getGates()) {
+            before += cxCost(*g);
+        }
+        auto reduction = consolidateTwoQubitBlocks(qc);
+        for (auto& g : qc.getGates()) {
+            after += cxCost(*g);
+        }
+        ASSERT_EQ(before - after, reduction);
+        ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(qc, 3))) << body;
+    }
+}
+
+std::string toffoli(int a, int b, int c) {
+    auto q = [](int i) { return "q[" + std::to_string(i) + "]"; };
+    return "h " + q(c) + ";\ncx " + q(b) + "," + q(c) + ";\ntdg " + q(c) + ";\ncx " + q(a) + "," + q(c) + ";\nt " + q(c) +
+           ";\ncx " + q(b) + "," + q(c) + ";\ntdg " + q(c) + ";\ncx " + q(a) + "," + q(c) + ";\nt " + q(b) + ";\nt " + q(c) +
+           ";\nh " + q(c) + ";\ncx " + q(a) + "," + q(b) + ";\nt " + q(a) + ";\ntdg " + q(b) + ";\ncx " + q(a) + "," + q(b) + ";\n";
+}
+
+TEST(PhaseFoldingTest, ChainedToffolis) {
+    auto qc = parse_qasm(toffoli(0, 1, 2) + toffoli(0, 1, 2), 3);
+    auto expected = circuit_unitary(qc, 3);
+    ASSERT_EQ(tCount(qc), 14);
+    foldPhasePolynomial(qc);
+    ASSERT_EQ(tCount(qc), 8);
+    ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(qc, 3)));
+
+    auto chain = parse_qasm(toffoli(0, 1, 2) + toffoli(1, 2, 3) + toffoli(0, 1, 2) + "x q[1];\n" + toffoli(0, 1, 3), 4);
+    expected = circuit_unitary(chain, 4);
+    const auto before = tCount(chain);
+    foldPhasePolynomial(chain);
+    ASSERT_LT(tCount(chain), before);
+    ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(chain, 4)));
+}
+
+// dense unitary of a circuit whose PERES gates are expanded into CCX and CX
+std::vector<Complex> peres_unitary(QCircuit& qc, std::size_t n) {
+    QCircuit expanded(n, 0);
+    for (auto& g : qc.getGates()) {
+        const gate_t type = g->getType();
+        if (type != GateType::PERES && type != GateType::PERESDG) {
+            expanded.getGates().push_back(std::make_unique<QGate>(*g));
+            continue;
+        }
+        const Qubit a = g->getControls()[0], b = g->getControls()[1], c = g->getTargets()[0];
+        if (type == GateType::PERESDG) {
+            expanded.getGates().push_back(std::make_unique<QGate>(GateType::CX, 2, ControlSet{a}, TargetSet{b}));
+        }
+        expanded.getGates().push_back(std::make_unique<QGate>(GateType::CCX, 3, ControlSet{a, b}, TargetSet{c}));
+        if (type == GateType::PERES) {
+            expanded.getGates().push_back(std::make_unique<QGate>(GateType::CX, 2, ControlSet{a}, TargetSet{b}));
+        }
+    }
+    return circuit_unitary(expanded, n);
+}
+
+TEST(PhaseFoldingTest, RandomCircuitsStayEquivalent) {
+    std::mt19937 rng(31);
+    const std::vector<std::string> ones{"h", "t", "tdg", "s", "sdg", "z", "x", "rz(0.3)", "p(1.2)", "t", "t"};
+    for (int trial = 0; trial < 30; ++trial) {
+        std::string body{};
+        for (int i = 0; i < 60; ++i) {
+            const auto pick = rng() % 8;
+            if (pick < 3) {
+                int a = rng() % 4, b = (a + 1 + rng() % 3) % 4;
+                body += std::string(pick == 2 && i % 5 == 0 ? "swap" : "cx") + " q[" + std::to_string(a) + "],q[" + std::to_string(b) + "];\n";
+            } else {
+                body += ones[rng() % ones.size()] + " q[" + std::to_string(rng() % 4) + "];\n";
+            }
+        }
+        auto qc = parse_qasm(body, 4);
+        // PERES flips its second control, which must not keep its parity
+        for (int i = 0; i < 4; ++i) {
+            std::vector<Qubit> q{0, 1, 2, 3};
+            std::shuffle(q.begin(), q.end(), rng);
+            auto position = qc.getGates().begin() + static_cast<std::ptrdiff_t>(rng() % qc.getGates().size());
+            qc.getGates().insert(position, std::make_unique<QGate>((i % 2) ? GateType::PERESDG : GateType::PERES, 3, ControlSet{q[0], q[1]}, TargetSet{q[2]}));
+        }
+        auto expected = peres_unitary(qc, 4);
+        const auto size = qc.getGates().size();
+        const auto reduction = foldPhasePolynomial(qc);
+        ASSERT_EQ(size - reduction, qc.getGates().size());
+        ASSERT_TRUE(equal_up_to_phase(expected, peres_unitary(qc, 4))) << body;
+    }
+}
+
+TEST(PassManagerTest, FixedPointIteration) {
+    auto manager = PassManager(true, 8);
+    manager.addPass("fold_phase_polynomial").addPass("cancel_inverse_pairs").addPass("merge_rotations_clifford_t");
+    ASSERT_THROW(manager.addPass("no_such_pass"), QcoreException);
+    ASSERT_EQ(manager.size(), 3);
+
+    auto qc = parse_qasm(toffoli(0, 1, 2) + toffoli(0, 1, 2) + "h q[0];\nh q[0];\n", 3);
+    auto expected = circuit_unitary(qc, 3);
+    auto report = manager.run(qc);
+
+    ASSERT_TRUE(report.valid);
+    ASSERT_GE(report.iterations, 2);
+    ASSERT_EQ(report.passes.size(), 3 * report.iterations);
+    ASSERT_EQ(report.final_gates, qc.getGates().size());
+    ASSERT_LT(report.final_gates, report.initial_gates);
+
+    std::int64_t delta = 0;
+    for (auto& record : report.passes) {
+        delta += record.gateDelta();
+        ASSERT_GE(record.seconds, 0);
+    }
+    ASSERT_EQ(static_cast<std::int64_t>(report.initial_gates) + delta, static_cast<std::int64_t>(report.final_gates));
+    // the last iteration did not shrink the circuit any further
+    std::int64_t last = 0;
+    for (auto& record : report.passes) {
+        if (record.iteration == report.iterations) {
+            last += record.gateDelta();
+        }
+    }
+    ASSERT_EQ(last, 0);
+    ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(qc, 3)));
+
+    auto json = toJSON(report);
+    ASSERT_EQ(json["Passes"].size(), report.passes.size());
+    ASSERT_EQ(json["FinalGateCount"], report.final_gates);
+}
+
+TEST(PassManagerTest, PerPassMemory) {
+    if (residentMemory() == 0) {
+        GTEST_SKIP() << "resident memory is not reported on this platform";
+    }
+    constexpr std::size_t ballast_size = 64 << 20;
+    std::vector<char> ballast{};
+    auto manager = PassManager();
+    manager.addPass("grow", [&ballast](QCircuit&) {
+        ballast.assign(ballast_size, 1);
+        return gcount_t{0};
+    });
+    manager.addPass("shrink", [&ballast](QCircuit&) {
+        std::vector<char>().swap(ballast);
+        return gcount_t{0};
+    });
+    manager.addPass("idle", [](QCircuit&) { return gcount_t{0}; });
+
+    auto qc = parse_qasm("h q[0];\n", 1);
+    auto report = manager.run(qc);
+    ASSERT_EQ(report.passes.size(), 3);
+    const auto& grow = report.passes[0];
+    const auto& shrink = report.passes[1];
+    const auto& idle = report.passes[2];
+    ASSERT_GT(grow.memoryDelta(), static_cast<std::int64_t>(ballast_size / 2));
+    ASSERT_LT(shrink.memoryDelta(), -static_cast<std::int64_t>(ballast_size / 2));
+    ASSERT_GE(grow.peak_memory, grow.memory_after);
+    // the peak of a pass does not carry the high-water mark of an earlier one
+    ASSERT_LT(idle.peak_memory + ballast_size / 2, grow.peak_memory);
+    ASSERT_EQ(toJSON(report)["Passes"][0]["MemoryDelta"], grow.memoryDelta());
+}
+
+TEST(PassManagerTest, ParallelCircuits) {
+    auto manager = PassManager();
+    manager.addPass("cancel_inverse_pairs").addPass("consolidate_two_qubit_blocks");
+
+    std::vector<std::unique_ptr<QCircuit>> circuits{};
+    std::vector<gcount_t> sequential{};
+    for (int i = 0; i < 12; ++i) {
+        std::string body = toffoli(i % 3, (i + 1) % 3, (i + 2) % 3) + "h q[1];\nh q[1];\n";
+        auto qc = parse_qasm(body, 3);
+        sequential.push_back(manager.run(qc).final_gates);
+        circuits.push_back(std::make_unique<QCircuit>(parse_qasm(body, 3)));
+    }
+    circuits.push_back(nullptr);
+
+    auto reports = manager.run(circuits, 4);
+    ASSERT_EQ(reports.size(), circuits.size());
+    for (std::size_t i = 0; i < sequential.size(); ++i) {
+        ASSERT_TRUE(reports[i].valid);
+        ASSERT_EQ(reports[i].final_gates, sequential[i]);
+        ASSERT_EQ(circuits[i]->getGates().size(), sequential[i]);
+    }
+    // a null entry is reported, not skipped
+    ASSERT_FALSE(reports.back().valid);
+    ASSERT_EQ(reports.back().error, "no circuit");
+    ASSERT_EQ(toJSON(reports.back())["Error"], "no circuit");
+}
+
+TEST(CommutationTest, TableEntries) {
+    // CX pairs sharing a control commute, a control against a target does not
+    static_assert((COMMUTATION_TABLE[GateType::CX][GateType::CX] & 0b0001) != 0, "shared control");
+    static_assert((COMMUTATION_TABLE[GateType::CX][GateType::CX] & 0b0010) == 0, "control vs target");
+    static_assert((COMMUTATION_TABLE[GateType::CX][GateType::CX] & 0b1000) != 0, "shared target");
+    static_assert((COMMUTATION_TABLE[GateType::RZ][GateType::CZ] & 0b1010) == 0b1010, "diagonal gates");
+    static_assert((COMMUTATION_TABLE[GateType::H][GateType::T] & 0b1000) == 0, "H is not diagonal");
+
+    auto qc = parse_qasm("cx q[0],q[1];\ncx q[0],q[2];\nt q[0];\nx q[1];\ncx q[1],q[2];\nh q[0];\nmeasure q[2] -> c[2];\n", 3);
+    auto& g = qc.getGates();
+    ASSERT_TRUE(commute(*g[0], *g[1]));
+    ASSERT_TRUE(commute(*g[0], *g[2]));
+    ASSERT_TRUE(commute(*g[0], *g[3]));
+    ASSERT_FALSE(commute(*g[0], *g[4]));
+    ASSERT_FALSE(commute(*g[2], *g[5]));
+    ASSERT_FALSE(commute(*g[1], *g[6]));
+}
+
+TEST(CommutationTest, ReorderReducesDepth) {
+    auto qc = parse_qasm("h q[1];\nh q[1];\nh q[1];\ncz q[1],q[0];\nt q[0];\ncx q[0],q[2];\nh q[2];\nh q[2];\nh q[2];\n", 3);
+    auto expected = circuit_unitary(qc, 3);
+    ASSERT_EQ(layeredDepth(qc), 9);
+    ASSERT_EQ(reorderCommutingGates(qc), 4);
+    ASSERT_EQ(layeredDepth(qc), 5);
+    ASSERT_EQ(qc.getGates()[0]->getType(), GateType::H);
+    ASSERT_EQ(qc.getGates()[1]->getType(), GateType::T);
+    ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(qc, 3)));
+
+    // without lookahead the T gate stays behind the CZ
+    auto blocked = parse_qasm("h q[1];\nh q[1];\nh q[1];\ncz q[1],q[0];\nt q[0];\ncx q[0],q[2];\nh q[2];\nh q[2];\nh q[2];\n", 3);
+    ASSERT_EQ(reorderCommutingGates(blocked, 0), 0);
+}
+
+TEST(CommutationTest, RandomCircuitsStayEquivalent) {
+    std::mt19937 rng(41);
+    const std::vector<std::string> ones{"h", "t", "x", "rz(0.3)", "rx(0.8)", "s", "sx", "y"};
+    const std::vector<std::string> twos{"cx", "cz", "crz(0.4)", "rzz(1.1)", "rxx(0.6)", "cy", "swap"};
+    for (int trial = 0; trial < 30; ++trial) {
+        std::string body{};
+        for (int i = 0; i < 50; ++i) {
+            if (rng() % 2 == 0) {
+                int a = rng() % 4, b = (a + 1 + rng() % 3) % 4;
+                body += twos[rng() % twos.size()] + " q[" + std::to_string(a) + "],q[" + std::to_string(b) + "];\n";
+            } else {
+                body += ones[rng() % ones.size()] + " q[" + std::to_string(rng() % 4) + "];\n";
+            }
+        }
+        auto qc = parse_qasm(body, 4);
+        auto expected = circuit_unitary(qc, 4);
+        const auto depth = layeredDepth(qc);
+        const auto reduction = reorderCommutingGates(qc, 1 + trial % 4);
+        ASSERT_EQ(layeredDepth(qc) + reduction, depth);
+        ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(qc, 4))) << body;
+    }
+}
+
+TEST(CommutationTest, ClassicalFencesNeverGrowDepth) {
+    std::mt19937 rng(33);
+    const std::vector<std::string> ones{"h", "t", "x", "rz(0.3)", "s"};
+    for (int trial = 0; trial < 2500; ++trial) {
+        std::string body{};
+        for (int i = 0; i < 12; ++i) {
+            const int a = rng() % 4, b = (a + 1 + rng() % 3) % 4;
+            switch (rng() % 5) {
+                case 0:
+                    body += "measure q[" + std::to_string(a) + "] -> c[" + std::to_string(a) + "];\n";
+                    break;
+                case 1:
+                case 2:
+                    body += "cx q[" + std::to_string(a) + "],q[" + std::to_string(b) + "];\n";
+                    break;
+                default:
+                    body += ones[rng() % ones.size()] + " q[" + std::to_string(a) + "];\n";
+            }
+        }
+        auto qc = parse_qasm(body, 4);
+        if (rng() % 2) {
+            auto position = qc.getGates().begin() + static_cast<std::ptrdiff_t>(rng() % qc.getGates().size());
+            qc.getGates().insert(position, std::make_unique<QGate>(GateType::BARRIER, 2, TargetSet{static_cast<Qubit>(rng() % 2), 3}));
+        }
+        const auto depth = layeredDepth(qc);
+        const auto reduction = reorderCommutingGates(qc, 1 + trial % 4);
+        ASSERT_EQ(layeredDepth(qc) + reduction, depth) << body;
+    }
+}
+
+TEST(LinearSynthesisTest, PMHRoundTrip) {
+    std::mt19937 rng(3);
+    for (std::size_t n : {2, 5, 64, 65, 130, 1000}) {
+        GF2Matrix matrix(n);
+        for (std::size_t k = 0; k < 20 * n; ++k) {
+            std::size_t c = rng() % n, t = (c + 1 + rng() % (n - 1)) % n;
+            matrix.addRow(c, t);
+        }
+
+        auto circuit = pmhSynthesis(matrix);
+        GF2Matrix rebuilt(n);
+        for (auto& cx : circuit) {
+            rebuilt.addRow(cx.first, cx.second);
+        }
+        ASSERT_TRUE(rebuilt == matrix) << n;
+    }
+
+    GF2Matrix singular(3);
+    singular.addRow(0, 1);
+    singular.flip(1, 1);
+    singular.flip(1, 0);
+    ASSERT_THROW(pmhSynthesis(singular), QcoreException);
+}
+
+TEST(LinearSynthesisTest, ResynthesizesCNOTRegions) {
+    std::mt19937 rng(17);
+    for (int trial = 0; trial < 20; ++trial) {
+        std::string body{};
+        for (int i = 0; i < 60; ++i) {
+            if (rng() % 10 == 0) {
+                body += std::string(rng() % 2 ? "h" : "t") + " q[" + std::to_string(rng() % 5) + "];\n";
+            } else {
+                int a = rng() % 5, b = (a + 1 + rng() % 4) % 5;
+                body += "cx q[" + std::to_string(a) + "],q[" + std::to_string(b) + "];\n";
+            }
+        }
+        auto qc = parse_qasm(body, 5);
+        auto expected = circuit_unitary(qc, 5);
+        const auto before = qc.getProperties()[GateType::CX];
+        const auto reduction = resynthesizeCNOTRegions(qc);
+        ASSERT_GT(reduction, 0);
+        ASSERT_EQ(qc.getProperties()[GateType::CX], before - reduction);
+        ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(qc, 5))) << body;
+    }
+}
+
+// random Clifford circuit with occasional T gates
+std::string random_clifford_t(std::mt19937& rng, int qubits, int length) {
+    const std::vector<std::string> ones{"h", "s", "sdg", "x", "y", "z"};
+    const std::vector<std::string> twos{"cx", "cz", "swap"};
+    std::string body{};
+    for (int i = 0; i < length; ++i) {
+        if (rng() % 15 == 0) {
+            body += "t q[" + std::to_string(rng() % qubits) + "];\n";
+        } else if (rng() % 2 == 0) {
+            int a = rng() % qubits, b = (a + 1 + rng() % (qubits - 1)) % qubits;
+            body += twos[rng() % twos.size()] + " q[" + std::to_string(a) + "],q[" + std::to_string(b) + "];\n";
+        } else {
+            body += ones[rng() % ones.size()] + " q[" + std::to_string(rng() % qubits) + "];\n";
+        }
+    }
+    return body;
+}
+
+TEST(CliffordSynthesisTest, TableauRoundTrip) {
+    std::mt19937 rng(5);
+    const std::vector<gate_t> ones{GateType::H, GateType::S, GateType::SDG, GateType::X, GateType::Y, GateType::Z};
+    for (std::size_t n : {2, 3, 40, 70}) {
+        CliffordTableau tableau(n);
+        for (std::size_t i = 0; i < 20 * n; ++i) {
+            const Qubit a = rng() % n, b = (a + 1 + rng() % (n - 1)) % n;
+            switch (rng() % 5) {
+                case 0:
+                    tableau.cx(a, b);
+                    break;
+                case 1:
+                    tableau.cz(a, b);
+                    break;
+                case 2:
+                    tableau.swap(a, b);
+                    break;
+                default:
+                    QGate g(ones[rng() % ones.size()], 1, TargetSet{a});
+                    ASSERT_TRUE(tableau.apply(g));
+                    break;
+            }
+        }
+
+        QubitSet identity(n);
+        std::iota(identity.begin(), identity.end(), 0);
+        auto gates = synthesizeClifford(tableau, identity);
+        CliffordTableau rebuilt(n);
+        for (auto& g : gates) {
+            ASSERT_TRUE(rebuilt.apply(*g));
+        }
+        ASSERT_TRUE(rebuilt == tableau) << n;
+    }
+
+    QGate t(GateType::T, 1, TargetSet{0});
+    CliffordTableau tableau(1);
+    ASSERT_FALSE(tableau.apply(t));
+}
+
+gcount_t clifford_cx_count(QCircuit& qc) {
+    gcount_t cx = 0;
+    for (auto& g : qc.getGates()) {
+        cx += cxCost(*g);
+    }
+    return cx;
+}
+
+TEST(CliffordSynthesisTest, ResynthesizesCliffordRegions) {
+    std::mt19937 rng(29);
+    for (int trial = 0; trial < 20; ++trial) {
+        const auto body = random_clifford_t(rng, 4, 120);
+        auto qc = parse_qasm(body, 4);
+        auto expected = circuit_unitary(qc, 4);
+        const auto before = clifford_cx_count(qc);
+        const auto reduction = resynthesizeCliffordRegions(qc);
+        ASSERT_GT(reduction, 0);
+        ASSERT_EQ(clifford_cx_count(qc), before - reduction);
+        ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(qc, 4))) << body;
+    }
+}
+
+TEST(CliffordSynthesisTest, RandomCliffordCircuitsNeverCostMoreCX) {
+    std::mt19937 rng(35);
+    const std::vector<std::string> ones{"h", "s", "sdg", "x", "z"};
+    for (int trial = 0; trial < 300; ++trial) {
+        std::string body{};
+        for (int i = 0; i < 14; ++i) {
+            const auto a = rng() % 4, b = (a + 1 + rng() % 3) % 4;
+            if (rng() % 2) {
+                body += "cx q[" + std::to_string(a) + "],q[" + std::to_string(b) + "];\n";
+            } else {
+                body += ones[rng() % ones.size()] + " q[" + std::to_string(a) + "];\n";
+            }
+        }
+        auto qc = parse_qasm(body, 4);
+        auto expected = circuit_unitary(qc, 4);
+        const auto before = clifford_cx_count(qc);
+        const auto reduction = resynthesizeCliffordRegions(qc);
+        ASSERT_LE(reduction, before) << body;
+        ASSERT_EQ(clifford_cx_count(qc), before - reduction) << body;
+        ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(qc, 4))) << body;
+    }
+}
+
+TEST(ZXTest, FlatHashMapMatchesMap) {
+    std::mt19937 rng(13);
+    FlatHashMap<std::uint32_t, std::uint8_t> flat{};
+    std::map<std::uint32_t, std::uint8_t> reference{};
+    for (int i = 0; i < 20000; ++i) {
+        const std::uint32_t key = rng() % 300;
+        if (rng() % 3 == 0) {
+            ASSERT_EQ(flat.erase(key), reference.erase(key) == 1);
+        } else {
+            const auto value = static_cast<std::uint8_t>(rng());
+            ASSERT_EQ(flat.insert(key, value), reference.count(key) == 0);
+            reference[key] = value;
+        }
+        ASSERT_EQ(flat.size(), reference.size());
+    }
+    std::size_t visited = 0;
+    for (const auto& entry : flat) {
+        ASSERT_EQ(reference.at(entry.key), entry.value);
+        ++visited;
+    }
+    ASSERT_EQ(visited, reference.size());
+}
+
+// random circuit over the gates with a ZX-diagram translation
+std::string random_zx_circuit(std::mt19937& rng, int qubits, int length) {
+    const std::vector<std::string> ones{"h", "s", "sdg", "t", "tdg", "x", "y", "z", "sx", "rz(0.3)", "rx(1.2)", "u1(0.7)"};
+    const std::vector<std::string> twos{"cx", "cz", "swap"};
+    std::string body{};
+    for (int i = 0; i < length; ++i) {
+        if (rng() % 2 == 0) {
+            int a = rng() % qubits, b = (a + 1 + rng() % (qubits - 1)) % qubits;
+            body += twos[rng() % twos.size()] + " q[" + std::to_string(a) + "],q[" + std::to_string(b) + "];\n";
+        } else {
+            body += ones[rng() % ones.size()] + " q[" + std::to_string(rng() % qubits) + "];\n";
+        }
+    }
+    return body;
+}
+
+TEST(ZXTest, RoundTripStaysEquivalent) {
+    std::mt19937 rng(19);
+    for (int trial = 0; trial < 30; ++trial) {
+        const auto body = random_zx_circuit(rng, 4, 40);
+        auto qc = parse_qasm(body, 4);
+        auto expected = circuit_unitary(qc, 4);
+
+        QCircuit extracted(4, 0);
+        extracted.getGates() = extractCircuit(circuitToZX(qc));
+        ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(extracted, 4))) << body;
+
+        auto diagram = circuitToZX(qc);
+        fullReduce(diagram, trial % 2 == 0);
+        QCircuit reduced(4, 0);
+        reduced.getGates() = extractCircuit(std::move(diagram));
+        ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(reduced, 4))) << body;
+    }
+}
+
+TEST(ZXTest, CliffordDiagramsReduceToBoundarySpiders) {
+    std::mt19937 rng(23);
+    auto qc = parse_qasm(random_clifford_t(rng, 4, 200), 4);
+    qc.getGates().erase(std::remove_if(qc.getGates().begin(), qc.getGates().end(), [](const QGatePtr& g) { return g->getType() == GateType::T; }),
+                        qc.getGates().end());
+    auto diagram = circuitToZX(qc);
+    const auto before = diagram.vertexCount();
+    fullReduce(diagram);
+    ASSERT_LT(diagram.vertexCount(), before / 4);
+
+    // only Pauli spiders between spiders next to the boundary survive
+    for (vertex_t v = 0; v < diagram.vertexBound(); ++v) {
+        if (!diagram.isAlive(v) || diagram.isBoundary(v) || !diagram.isInterior(v)) {
+            continue;
+        }
+        std::int64_t multiple = 0;
+        ASSERT_TRUE(isAngleMultiple(diagram.getPhase(v), PI, multiple));
+        for (const auto& entry : diagram.getNeighbours(v)) {
+            ASSERT_FALSE(diagram.isInterior(entry.key));
+        }
+    }
+}
+
+TEST(ZXTest, SimplificationLowersTCount) {
+    auto qc = parse_qasm(toffoli(0, 1, 2) + toffoli(1, 2, 3) + "h q[3];\nt q[2];\ncx q[2],q[3];\ntdg q[3];\n", 4);
+    auto expected = circuit_unitary(qc, 4);
+    const auto before = nonCliffordCount(qc);
+    const auto reduction = simplifyWithZX(qc);
+    ASSERT_GT(reduction, 0u);
+    ASSERT_EQ(nonCliffordCount(qc), before - reduction);
+    ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(qc, 4)));
+
+    // the Toffoli stays and fences the segment after it
+    auto unsupported = parse_qasm("ccx q[0],q[1],q[2];\nt q[0];\ntdg q[0];\n", 3);
+    ASSERT_EQ(simplifyWithZX(unsupported), 2u);
+    ASSERT_EQ(unsupported.getGates().size(), 1u);
+    ASSERT_EQ(unsupported.getGates()[0]->getType(), GateType::CCX);
+}
+
+TEST(ZXTest, SimplificationAroundUnsupportedGates) {
+    const std::string first = toffoli(0, 1, 2) + toffoli(0, 1, 2);
+    const std::string second = toffoli(1, 2, 3) + "h q[3];\nt q[2];\ncx q[2],q[3];\ntdg q[3];\n";
+    auto qc = parse_qasm(first + "measure q[0] -> c[0];\n" + second, 4);
+    const auto before = nonCliffordCount(qc);
+    const auto reduction = simplifyWithZX(qc);
+    ASSERT_GT(reduction, 0u);
+    ASSERT_EQ(nonCliffordCount(qc), before - reduction);
+
+    // both segments keep their unitary on either side of the measurement
+    auto& gates = qc.getGates();
+    auto measure = std::find_if(gates.begin(), gates.end(), [](const QGatePtr& g) { return g->getType() == GateType::MEASURE; });
+    ASSERT_NE(measure, gates.end());
+    QCircuit head(4, 0), tail(4, 0);
+    for (auto g = gates.begin(); g != measure; ++g) {
+        head.getGates().push_back(std::make_unique<QGate>(**g));
+    }
+    for (auto g = measure + 1; g != gates.end(); ++g) {
+        tail.getGates().push_back(std::make_unique<QGate>(**g));
+    }
+    auto expected_head = parse_qasm(first, 4);
+    auto expected_tail = parse_qasm(second, 4);
+    ASSERT_LT(nonCliffordCount(head), nonCliffordCount(expected_head));
+    ASSERT_TRUE(equal_up_to_phase(circuit_unitary(expected_head, 4), circuit_unitary(head, 4)));
+    ASSERT_TRUE(equal_up_to_phase(circuit_unitary(expected_tail, 4), circuit_unitary(tail, 4)));
+}
+
+QCircuit template_circuit(const std::vector<TemplateGate>& gates, regsize_t qubits) {
+    QCircuit qc(qubits, 0);
+    for (auto& g : gates) {
+        const auto size = static_cast<gsize_t>(g.controls.size() + g.targets.size());
+        qc.getGates().push_back(std::make_unique<QGate>(g.type, size, g.controls, g.targets));
+    }
+    return qc;
+}
+
+TEST(TemplateRewritingTest, BuiltinTemplatesAreIdentities) {
+    for (auto& rule : builtinTemplates()) {
+        if (rule.replacement.front().type == GateType::RCCX) {
+            continue;  // no dense matrix for the Margolus gate
+        }
+        auto pattern = template_circuit(rule.pattern, 3);
+        auto replacement = template_circuit(rule.replacement, 3);
+        ASSERT_TRUE(equal_up_to_phase(circuit_unitary(pattern, 3), circuit_unitary(replacement, 3))) << rule.name;
+    }
+
+    const TemplateMatcher matcher(builtinTemplates());
+    ASSERT_EQ(matcher.size(), builtinTemplates().size());
+    ASSERT_LT(matcher.stateCount(), 40u);  // rules starting with H share their first state
+
+    ASSERT_THROW(TemplateMatcher({{"disconnected", {{GateType::H, {}, {0}}, {GateType::H, {}, {1}}}, {}}}), QcoreException);
+    ASSERT_THROW(TemplateMatcher({{"unbound", {{GateType::H, {}, {0}}}, {{GateType::X, {}, {1}}}}}), QcoreException);
+}
+
+TEST(TemplateRewritingTest, RewritesEverywhere) {
+    auto qc = parse_qasm("h q[1];\nh q[3];\ncx q[0],q[1];\ncx q[2],q[3];\nh q[1];\nh q[3];\nh q[0];\nh q[2];\ncz q[2],q[0];\nh q[0];\n" +
+                             toffoli(1, 2, 3) + "x q[0];\n",
+                         4);
+    auto expected = circuit_unitary(qc, 4);
+    ASSERT_EQ(applyTemplates(qc), 4u);
+    ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(qc, 4)));
+
+    std::map<gate_t, std::size_t> types{};
+    for (auto& g : qc.getGates()) {
+        ++types[g->getType()];
+    }
+    ASSERT_EQ(types[GateType::CZ], 2u);
+    ASSERT_EQ(types[GateType::CX], 1u);
+    ASSERT_EQ(types[GateType::CCX], 1u);
+    ASSERT_EQ(qc.getGates().size(), 6u);
+
+    // gates after a match on one wire but before its end on another follow the replacement
+    auto interleaved = parse_qasm("h q[1];\ncx q[0],q[1];\nx q[0];\nh q[1];\n", 2);
+    expected = circuit_unitary(interleaved, 2);
+    ASSERT_EQ(applyTemplates(interleaved), 1u);
+    ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(interleaved, 2)));
+
+    // no position for a match with a gate in between
+    const TemplateMatcher fan_out({{"fan_out", {{GateType::CX, {0}, {1}}, {GateType::CX, {0}, {2}}}, {{GateType::CX, {0}, {2}}, {GateType::CX, {0}, {1}}}}});
+    auto blocked = parse_qasm("cx q[0],q[1];\ncx q[1],q[2];\ncx q[0],q[2];\n", 3);
+    ASSERT_EQ(fan_out.rewrite(blocked, 1), 0u);
+    auto parallel = parse_qasm("cx q[0],q[1];\ncx q[0],q[2];\ncx q[1],q[2];\n", 3);
+    ASSERT_EQ(fan_out.rewrite(parallel, 1), 1u);
+    ASSERT_EQ(parallel.getGates().front()->getTargets().front(), 2u);
+
+    auto margolus = parse_qasm("h q[2];\nt q[2];\ncx q[1],q[2];\ntdg q[2];\ncx q[0],q[2];\nt q[2];\ncx q[1],q[2];\ntdg q[2];\nh q[2];\n", 3);
+    ASSERT_EQ(applyTemplates(margolus), 1u);
+    ASSERT_EQ(margolus.getGates().front()->getType(), GateType::RCCX);
+}
+
+TEST(TemplateRewritingTest, RandomCircuitsStayEquivalent) {
+    std::mt19937 rng(37);
+    const std::vector<std::string> ones{"h", "h", "x", "z", "t"};
+    const std::vector<std::string> twos{"cx", "cz"};
+    for (int trial = 0; trial < 40; ++trial) {
+        std::string body{};
+        for (int i = 0; i < 60; ++i) {
+            if (rng() % 3 == 0) {
+                int a = rng() % 4, b = (a + 1 + rng() % 3) % 4;
+                body += twos[rng() % twos.size()] + " q[" + std::to_string(a) + "],q[" + std::to_string(b) + "];\n";
+            } else {
+                body += ones[rng() % ones.size()] + " q[" + std::to_string(rng() % 4) + "];\n";
+            }
+        }
+        auto qc = parse_qasm(body, 4);
+        auto expected = circuit_unitary(qc, 4);
+        const auto before = qc.getGates().size();
+        applyTemplates(qc);
+        ASSERT_LE(qc.getGates().size(), before);
+        ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(qc, 4))) << body;
+    }
+}
+
+TEST(DecompositionTest, TemplatesRealizeTheirGates) {
+    Qubit a = 2, b = 0, c = 3, d = 1;
+    QCircuit toffoli(4, 0);
+    toffoli.getGates().push_back(std::make_unique<QGate>(GateType::CCX, 3, ControlSet{a, b}, TargetSet{c}));
+    const auto expected = circuit_unitary(toffoli, 4);
+    for (bool inverse : {false, true}) {
+        auto qc = decompose_CCX_Clifford_T(a, b, c, inverse);
+        ASSERT_EQ(qc.getGates().size(), CCX_CLIFFORD_T.size());
+        ASSERT_EQ(tCount(qc), 7);
+        ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(qc, 4)));
+    }
+
+    // every template followed by its inverse is the identity
+    QCircuit empty(4, 0);
+    const auto identity = circuit_unitary(empty, 4);
+    std::vector<std::pair<QCircuit, QCircuit>> pairs{};
+    pairs.emplace_back(decompose_RCCX_Clifford_T(a, b, c), decompose_RCCX_Clifford_T(a, b, c));
+    pairs.emplace_back(decompose_SRCCX_Clifford_T(a, b, c), decompose_SRCCX_Clifford_T(a, b, c, true));
+    pairs.emplace_back(decompose_SSRCCX_Clifford_T(a, b, c), decompose_SSRCCX_Clifford_T(a, b, c, true));
+    pairs.emplace_back(decompose_RC3X_Clifford_T(a, b, d, c), decompose_RC3X_Clifford_T(a, b, d, c, true));
+    pairs.emplace_back(decompose_SRC3X_Clifford_T(a, b, d, c), decompose_SRC3X_Clifford_T(a, b, d, c, true));
+    for (auto& pair : pairs) {
+        pair.first.addQCircuit(pair.second);
+        ASSERT_TRUE(equal_up_to_phase(identity, circuit_unitary(pair.first, 4)));
+    }
+
+    static_assert(inverseTable(inverseTable(SRC3X_CLIFFORD_T))[4].type == GateType::H, "inversion is an involution");
+}
+
+TEST(DecompositionTest, MultiControlToffoliBorrowsAncillas) {
+    auto mct = [](const QubitSet& controls, Qubit target, std::size_t n) {
+        QCircuit qc(n, 0);
+        qc.getGates().push_back(std::make_unique<QGate>(GateType::MCX, controls.size() + 1, ControlSet{controls}, TargetSet{target}));
+        return circuit_unitary(qc, n);
+    };
+
+    // k - 2 dirty ancillas, then a single one
+    for (auto dirty : {QubitSet{5, 6}, QubitSet{6}}) {
+        QubitSet controls{0, 2, 3, 4}, clean{};
+        for (bool inverse : {false, true}) {
+            auto qc = decompose_MCT_Clifford_T(controls, 1, dirty, clean, inverse);
+            ASSERT_EQ(qc.getGates().size(), countMCT(controls, 1, dirty, clean));
+            ASSERT_TRUE(equal_up_to_phase(mct(controls, 1, 7), circuit_unitary(qc, 7)));
+        }
+    }
+
+    // clean ancillas only need to be restored from |0>
+    QubitSet controls{0, 1, 2, 3, 4}, dirty{}, clean{6, 7};
+    auto qc = decompose_MCT_Clifford_T(controls, 5, dirty, clean);
+    ASSERT_EQ(tCount(qc), 2 * (8 + 4) + 7);
+    ASSERT_TRUE(equal_on_columns(mct(controls, 5, 8), circuit_unitary(qc, 8), 64));
+
+    QubitSet none{};
+    ASSERT_THROW(decompose_MCT_Clifford_T(controls, 5, none, none), QcoreException);
+}
+
+TEST(DecompositionTest, EmitsIntoOutputIterators) {
+    Qubit a = 0, b = 1, c = 2, d = 3;
+    for (bool inverse : {false, true}) {
+        auto gates = QGateSet{};
+        auto out = decompose_CCX_Clifford_T(a, b, c, std::back_inserter(gates), inverse);
+        decompose_RC3X_Clifford_T(a, b, d, c, out, inverse);
+        auto qc = decompose_CCX_Clifford_T(a, b, c, inverse);
+        qc.addQCircuit(decompose_RC3X_Clifford_T(a, b, d, c, inverse));
+        ASSERT_EQ(gates.size(), qc.getGates().size());
+        for (std::size_t i = 0; i < gates.size(); ++i) {
+            ASSERT_EQ(gates[i]->toString(FileFormat::OpenQASM), qc.getGates()[i]->toString(FileFormat::OpenQASM));
+        }
+    }
+
+    // every strategy: the mirrored stream is the gate-wise inverse of the forward one
+    const std::vector<std::pair<QubitSet, QubitSet>> ancillas{{{}, {7, 8, 9}}, {{7, 8, 9, 10}, {}}, {{7}, {}}, {{}, {7}}};
+    for (std::size_t k = 3; k <= 6; ++k) {
+        QubitSet controls{};
+        for (Qubit q = 0; q < k; ++q) {
+            controls.push_back(q);
+        }
+        for (auto [dirty, clean] : ancillas) {
+            auto forward = QGateSet{}, mirrored = QGateSet{};
+            decompose_MCT_Clifford_T(controls, 6, dirty, clean, std::back_inserter(forward));
+            decompose_MCT_Clifford_T(controls, 6, dirty, clean, std::back_inserter(mirrored), true);
+            auto qc = decompose_MCT_Clifford_T(controls, 6, dirty, clean);
+
+            ASSERT_EQ(forward.size(), countMCT(controls, 6, dirty, clean));
+            ASSERT_EQ(forward.size(), qc.getGates().size());
+            ASSERT_EQ(mirrored.size(), forward.size());
+            for (std::size_t i = 0; i < forward.size(); ++i) {
+                ASSERT_EQ(forward[i]->toString(FileFormat::OpenQASM), qc.getGates()[i]->toString(FileFormat::OpenQASM));
+                auto& inverted = forward[forward.size() - 1 - i];
+                ASSERT_EQ(mirrored[i]->getType(), inverseGateType(inverted->getType()));
+                ASSERT_EQ(mirrored[i]->getControls(), inverted->getControls());
+                ASSERT_EQ(mirrored[i]->getTargets(), inverted->getTargets());
+            }
+        }
+    }
+}
+
+TEST(DecompositionTest, WholeCircuitLowering) {
+    auto qc = parse_qasm("h q[0];\nccx q[0],q[1],q[2];\ncx q[2],q[3];\nt q[4];\nccx q[4],q[2],q[0];\n", 6);
+    qc.getGates().push_back(std::make_unique<QGate>(GateType::MCX, 5, ControlSet{0, 1, 3, 4}, TargetSet{2}));
+    qc.getGates().push_back(std::make_unique<QGate>(GateType::MCX, 4, ControlSet{5, 3, 1}, TargetSet{0}));
+    const auto expected = circuit_unitary(qc, 6);
+
+    ASSERT_EQ(decompose(qc), 4);
+    for (auto& g : qc.getGates()) {
+        const auto type = g->getType();
+        ASSERT_TRUE(type == GateType::H || type == GateType::T || type == GateType::TDG || type == GateType::CX ||
+                    type == GateType::X || type == GateType::S || type == GateType::SDG)
+            << toString(type);
+    }
+    ASSERT_EQ(qc.getProperties()[GateType::CCX], 0);
+    ASSERT_TRUE(equal_on_columns(expected, circuit_unitary(qc, 6), 32));  // q[5] lends itself clean to the first MCX
+
+    // an MCX spanning the whole register has nothing to borrow and leaves the circuit untouched
+    QCircuit full(4, 0);
+    full.getGates().push_back(std::make_unique<QGate>(GateType::CCX, 3, ControlSet{0, 1}, TargetSet{2}));
+    full.getGates().push_back(std::make_unique<QGate>(GateType::MCX, 4, ControlSet{0, 1, 2}, TargetSet{3}));
+    ASSERT_THROW(decompose(full), QcoreException);
+    ASSERT_EQ(full.getGates().size(), 2);
+    ASSERT_EQ(full.getGates()[1]->getType(), GateType::MCX);
+}
+
+TEST(DecompositionTest, ParallelLoweringMatchesSerial) {
+    std::mt19937 rng(39);
+    const gate_t types[] = {GateType::CCX, GateType::RCCX, GateType::SRCCX, GateType::SSRCCXDG, GateType::RC3X,
+                            GateType::SRC3XDG, GateType::MCX, GateType::H, GateType::CX};
+    auto build = [&]() {
+        QCircuit qc(10, 0);
+        for (std::size_t i = 0; i < 6000; ++i) {
+            QubitSet qubits{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+            std::shuffle(qubits.begin(), qubits.end(), rng);
+            const auto type = types[rng() % 9];
+            const std::size_t controls = (type == GateType::H) ? 0 : (type == GateType::CX) ? 1
+                                         : (type == GateType::RC3X || type == GateType::SRC3XDG) ? 3
+                                         : (type == GateType::MCX) ? 3 + rng() % 4 : 2;
+            qc.getGates().push_back(std::make_unique<QGate>(type, controls + 1, ControlSet(qubits.begin(), qubits.begin() + controls),
+                                                            TargetSet{qubits[controls]}));
+        }
+        return qc;
+    };
+
+    auto serial = build();
+    rng.seed(39);
+    auto parallel = build();
+    const auto lowered = decompose(serial, DecompositionBasis::CLIFFORD_T, 1);
+    ASSERT_EQ(decompose(parallel, DecompositionBasis::CLIFFORD_T, 4), lowered);
+    ASSERT_GT(lowered, 4000);
+
+    ASSERT_EQ(serial.getGates().size(), parallel.getGates().size());
+    for (std::size_t i = 0; i < serial.getGates().size(); ++i) {
+        auto &lhs = *serial.getGates()[i], &rhs = *parallel.getGates()[i];
+        ASSERT_EQ(lhs.getType(), rhs.getType());
+        ASSERT_EQ(lhs.getControls(), rhs.getControls());
+        ASSERT_EQ(lhs.getTargets(), rhs.getTargets());
+    }
+}
+
+TEST(DecompositionTest, LivenessSelectsAncillas) {
+    QubitSet controls{0, 1, 2, 3, 4};
+    auto build = [&](const std::string& prefix) {
+        auto qc = parse_qasm(prefix + "h q[0];\n", 8);
+        qc.getGates().push_back(std::make_unique<QGate>(GateType::MCX, 6, ControlSet{controls}, TargetSet{5}));
+        auto tail = parse_qasm("cx q[6],q[7];\nh q[7];\n", 8);
+        qc.addQCircuit(tail);
+        return qc;
+    };
+
+    // q[6] and q[7] are still |0> at the MCX: ladder of relative phase Toffolis
+    auto fresh = build("");
+    const auto expected = circuit_unitary(fresh, 8);
+    QubitLiveness liveness(fresh);
+    auto mcx = decompose_MCT_Clifford_T(controls, 5, liveness, 1);
+    ASSERT_EQ(tCount(mcx), 31);
+    ASSERT_EQ(decompose(fresh), 1);
+    ASSERT_EQ(tCount(fresh), 31);
+    ASSERT_TRUE(equal_on_columns(expected, circuit_unitary(fresh, 8), 64));
+
+    // used before: borrowed dirty, exact on every input and dearer
+    auto used = build("x q[6];\nx q[7];\n");
+    const auto exact = circuit_unitary(used, 8);
+    ASSERT_EQ(decompose(used), 1);
+    ASSERT_GT(tCount(used), 31);
+    ASSERT_TRUE(equal_up_to_phase(exact, circuit_unitary(used, 8)));
+}
+
+TEST(DecompositionTest, LazyViewMatchesMaterialized) {
+    std::mt19937 rng(43);
+    const gate_t types[] = {GateType::CCX, GateType::RCCX, GateType::SSRCCX, GateType::RC3X, GateType::SRC3X, GateType::MCX, GateType::H};
+    auto qc = parse_qasm("h q[0];\nmeasure q[0] -> c[0];\nif (c==1) ccx q[0],q[1],q[2];\n", 8);
+    for (std::size_t i = 0; i < 200; ++i) {
+        QubitSet qubits{0, 1, 2, 3, 4, 5, 6, 7};
+        std::shuffle(qubits.begin(), qubits.end(), rng);
+        const auto type = types[rng() % 7];
+        const std::size_t controls = (type == GateType::H)                                 ? 0
+                                     : (type == GateType::RC3X || type == GateType::SRC3X) ? 3
+                                     : (type == GateType::MCX)                             ? rng() % 7
+                                                                                           : 2;
+        qc.getGates().push_back(std::make_unique<QGate>(type, controls + 1, ControlSet(qubits.begin(), qubits.begin() + controls),
+                                                        TargetSet{qubits[controls]}));
+    }
+
+    const DecomposedView view(qc);
+    auto materialized = QCircuit(qc);
+    decompose(materialized, DecompositionBasis::CLIFFORD_T, 1);
+    auto& gates = materialized.getGates();
+
+    std::size_t i = 0;
+    for (const auto& gate : view) {
+        ASSERT_LT(i, gates.size());
+        ASSERT_EQ(gate.type, gates[i]->getType());
+        if (gate.lowered) {
+            ASSERT_EQ(gate.target, gates[i]->getTargets()[0]);
+            ASSERT_EQ(gate.controlled, !gates[i]->getControls().empty());
+            if (gate.controlled) {
+                ASSERT_EQ(gate.control, gates[i]->getControls()[0]);
+            }
+        } else {
+            ASSERT_EQ(gate.source->getTargets(), gates[i]->getTargets());
+        }
+        ++i;
+    }
+    ASSERT_EQ(i, gates.size());
+
+    // fast-forward counts agree with the materialized circuit
+    ASSERT_EQ(view.size(), gates.size());
+    const auto counts = view.histogram();
+    for (auto type : {GateType::H, GateType::T, GateType::TDG, GateType::CX, GateType::X, GateType::CCX, GateType::MEASURE}) {
+        ASSERT_EQ(counts[type], materialized.getProperties()[type]) << toString(type);
+    }
+    ASSERT_EQ(view.tCount(), materialized.getProperties()[GateType::T] + materialized.getProperties()[GateType::TDG]);
+
+    std::ostringstream qasm;
+    view.writeQASM(qasm);
+    std::istringstream input(qasm.str());
+    QCircuit streamed;
+    streamed.readQASM(input);
+    ASSERT_EQ(streamed.getGates().size(), gates.size());
+}
+
+TEST(BasisTranslationTest, EveryGateTypeIsTranslated) {
+    std::mt19937 rng(41);
+    std::uniform_real_distribution<fp> uniform(-PI, PI);
+    const Qubit q[] = {2, 0, 3, 1};
+    const RotationType keys[] = {RotationType::THETA, RotationType::PHI, RotationType::LAMBDA, RotationType::GAMMA};
+
+    // reference of the gate types the dense simulation does not cover
+    auto reference = [&](const gate_t& type, QCircuit& qc) {
+        auto add = [&qc](gate_t t, ControlSet controls, Qubit target) {
+            qc.getGates().push_back(std::make_unique<QGate>(t, controls.size() + 1, controls, TargetSet{target}));
+        };
+        switch (type) {
+            case GateType::CSWAP:
+                add(GateType::CX, {q[2]}, q[1]);
+                add(GateType::CCX, {q[0], q[1]}, q[2]);
+                add(GateType::CX, {q[2]}, q[1]);
+                return true;
+            case GateType::PERES:
+                add(GateType::CCX, {q[0], q[1]}, q[2]);
+                add(GateType::CX, {q[0]}, q[1]);
+                return true;
+            case GateType::PERESDG:
+                add(GateType::CX, {q[0]}, q[1]);
+                add(GateType::CCX, {q[0], q[1]}, q[2]);
+                return true;
+            case GateType::LCCX:
+            case GateType::LCCXDG:
+                add(GateType::CCX, {q[0], q[1]}, q[2]);
+                return true;
+            case GateType::RCCX:
+                instantiate(RCCX_CLIFFORD_T, q, qc.getGates());
+                return true;
+            case GateType::SRCCX:
+                instantiate(SRCCX_CLIFFORD_T, q, qc.getGates());
+                return true;
+            case GateType::SRCCXDG:
+                instantiate(SRCCXDG_CLIFFORD_T, q, qc.getGates());
+                return true;
+            case GateType::SSRCCX:
+                instantiate(SSRCCX_CLIFFORD_T, q, qc.getGates());
+                return true;
+            case GateType::SSRCCXDG:
+                instantiate(SSRCCXDG_CLIFFORD_T, q, qc.getGates());
+                return true;
+            case GateType::RC3X:
+                instantiate(RC3X_CLIFFORD_T, q, qc.getGates());
+                return true;
+            case GateType::SRC3X:
+                instantiate(SRC3X_CLIFFORD_T, q, qc.getGates());
+                return true;
+            case GateType::SRC3XDG:
+                instantiate(SRC3XDG_CLIFFORD_T, q, qc.getGates());
+                return true;
+            default:
+                return false;
+        }
+    };
+
+    for (auto basis : {DecompositionBasis::CLIFFORD_T, DecompositionBasis::RZ_SX_X_CX, DecompositionBasis::U3_CX}) {
+        const auto& translator = basisTranslator(basis);
+        ASSERT_EQ(&translator, &basisTranslator(basis));
+        for (std::size_t t = 1; t < GateType::TYPECOUNT; ++t) {
+            const auto type = static_cast<gate_t>(t);
+            const std::size_t n = operandCount(type);
+            if (n == 0 || type == GateType::RESET || type == GateType::MEASURE) {
+                continue;
+            }
+            ASSERT_TRUE(translator.supports(type)) << toString(type);
+
+            RotationMap angles{};
+            for (std::size_t k = 0; k < angleCount(type); ++k) {
+                angles[keys[k]] = angleString((basis == DecompositionBasis::CLIFFORD_T) ? static_cast<fp>(rng() % 4) * PI / 2 : uniform(rng));
+            }
+            std::size_t split = n - 1;
+            if (type == GateType::SWAP || type == GateType::ISWAP || type == GateType::RXX || type == GateType::RZZ) {
+                split = 0;
+            } else if (type == GateType::CSWAP) {
+                split = 1;
+            }
+
+            QCircuit qc(4, 0), expected(4, 0);
+            qc.getGates().push_back(std::make_unique<QGate>(type, n, CbitSet{}, angles, ControlSet(q, q + split), TargetSet(q + split, q + n)));
+            if (!reference(type, expected)) {
+                expected.getGates().push_back(std::make_unique<QGate>(*qc.getGates().front()));
+            }
+
+            if (basis == DecompositionBasis::CLIFFORD_T && (type == GateType::CT || type == GateType::CTDG)) {
+                ASSERT_THROW(translate(qc, basis), QcoreException);
+                ASSERT_EQ(qc.getGates().front()->getType(), type);
+                continue;
+            }
+            translate(qc, basis);
+            for (auto& g : qc.getGates()) {
+                ASSERT_TRUE(inBasis(g->getType(), basis) && !(basis == DecompositionBasis::CLIFFORD_T && g->getType() == GateType::RZ))
+                    << toString(type) << " -> " << toString(g->getType());
+            }
+            ASSERT_TRUE(equal_up_to_phase(circuit_unitary(expected, 4), circuit_unitary(qc, 4))) << toString(type);
+        }
+    }
+}
+
+TEST(BasisTranslationTest, CircuitsTranslateInOnePass) {
+    auto qc = parse_qasm("h q[0];\ncu3(0.3,0.2,0.1) q[0],q[1];\nrxx(0.7) q[1],q[2];\nmeasure q[2] -> c[2];\nif (c==1) x q[3];\n"
+                         "cswap q[0],q[1],q[2];\nrz(0.0) q[3];\n", 5);
+    qc.getGates().push_back(std::make_unique<QGate>(GateType::MCX, 4, ControlSet{0, 1, 2}, TargetSet{3}));
+    auto u3 = QCircuit(qc);
+
+    const auto gates = qc.getGates().size();
+    ASSERT_EQ(translate(qc, DecompositionBasis::RZ_SX_X_CX), gates - 3);  // measure, x and rz are native
+    ASSERT_EQ(qc.getProperties().count(GateType::MEASURE), 1);
+    ASSERT_EQ(qc.getProperties().count(GateType::U3), 0);
+    for (auto& g : qc.getGates()) {
+        if (g->getIsClassical()) {
+            ASSERT_EQ(g->getType(), GateType::X);
+        }
+    }
+
+    ASSERT_EQ(translate(u3, DecompositionBasis::U3_CX), gates - 1);
+    std::size_t conditioned = 0;
+    for (auto& g : u3.getGates()) {
+        ASSERT_TRUE(g->getType() == GateType::U3 || g->getType() == GateType::CX || g->getType() == GateType::MEASURE);
+        conditioned += g->getIsClassical() ? 1 : 0;
+    }
+    ASSERT_EQ(conditioned, 1);
+}
+
+// operator norm distance of a single-qubit circuit to RZ(angle) up to a global phase
+fp rz_distance(const CliffordTWord& word, fp angle) {
+    QCircuit qc;
+    for (auto type : word) {
+        qc.getGates().push_back(std::make_unique<QGate>(type, 1, TargetSet{0}));
+    }
+    auto u = circuit_unitary(qc, 1);
+    const Complex trace = std::conj(u[0]) * std::polar(1.0, -angle / 2) + std::conj(u[3]) * std::polar(1.0, angle / 2);
+    return std::sqrt(std::max(0.0, 2 - std::abs(trace)));
+}
+
+TEST(RotationSynthesisTest, ApproximatesWithinEpsilon) {
+    for (fp epsilon : {1e-2, 1e-4, 1e-6}) {
+        for (fp angle : {0.3, 1.0, 2.5, -0.7}) {
+            const auto word = synthesizeRZ(angle, epsilon);
+            ASSERT_LE(rz_distance(word, angle), epsilon) << angle << " " << epsilon;
+
+            std::size_t t_count = 0;
+            for (auto type : word) {
+                ASSERT_TRUE(type == GateType::H || type == GateType::S || type == GateType::SDG || type == GateType::T ||
+                            type == GateType::TDG || type == GateType::X);
+                t_count += (type == GateType::T || type == GateType::TDG) ? 1 : 0;
+            }
+            // close to the optimal 3 log2(1/epsilon) + O(1)
+            ASSERT_LE(t_count, 3 * std::log2(1 / epsilon) + 12) << angle << " " << epsilon;
+        }
+    }
+    ASSERT_EQ(synthesizeRZ(PI / 4, 1e-6), CliffordTWord{GateType::T});
+    ASSERT_EQ(synthesizeRZ(-PI / 2, 1e-6), CliffordTWord{GateType::SDG});
+    ASSERT_TRUE(synthesizeRZ(1e-3, 1e-2).empty());
+    ASSERT_THROW(synthesizeRZ(0.3, 1e-9), QcoreException);
+    ASSERT_THROW(synthesizeRZ(0.3, 1), QcoreException);
+}
+
+TEST(RotationSynthesisTest, CacheIsKeyedAndPersisted) {
+    const std::string file = "rz_synthesis_cache_test.txt";
+    std::remove(file.c_str());
+    {
+        RZSynthesisCache cache(file);
+        ASSERT_EQ(cache.prefetch({0.3, 1.1, 0.3, 2.0, 1.1}, 1e-4, 4), 3);
+        ASSERT_EQ(cache.size(), 3);
+        ASSERT_EQ(cache.prefetch({1.1, 2.0}, 1e-4), 0);
+
+        ASSERT_FALSE(cache.contains(1.1, 1e-2));
+        const auto& word = cache.lookup(1.1, 1e-2);
+        ASSERT_EQ(cache.size(), 4);
+        ASSERT_EQ(&word, &cache.lookup(1.1, 1e-2));
+        ASSERT_LE(rz_distance(word, 1.1), 1e-2);
+    }
+
+    RZSynthesisCache warm(file);
+    ASSERT_EQ(warm.size(), 4);
+    ASSERT_TRUE(warm.contains(0.3, 1e-4));
+    ASSERT_TRUE(warm.contains(1.1, 1e-2));
+    ASSERT_EQ(warm.lookup(2.0, 1e-4), synthesizeRZ(2.0, 1e-4));
+    std::remove(file.c_str());
+}
+
+TEST(RotationSynthesisTest, CircuitRotationsAreReplaced) {
+    auto qc = parse_qasm("h q[0];\nrz(0.3) q[0];\np(pi/4) q[1];\nmeasure q[1] -> c[1];\nif (c==2) u1(1.2) q[0];\nrz(0.3) q[1];\n", 2);
+    RZSynthesisCache cache;
+    ASSERT_EQ(synthesizeRotations(qc, 1e-4, cache, 2), 4);
+    ASSERT_EQ(cache.size(), 2);
+    std::size_t conditioned = 0;
+    for (auto& g : qc.getGates()) {
+        const gate_t type = g->getType();
+        ASSERT_TRUE(type == GateType::H || type == GateType::S || type == GateType::SDG || type == GateType::T ||
+                    type == GateType::TDG || type == GateType::X || type == GateType::MEASURE);
+        conditioned += g->getIsClassical() ? 1 : 0;
+    }
+    ASSERT_EQ(conditioned, cache.lookup(1.2, 1e-4).size());
+
+    // translation into Clifford+T approximates the rotations it leaves behind
+    auto rotations = parse_qasm("cu3(0.3,0.2,0.1) q[0],q[1];\nrx(0.7) q[1];\n", 2);
+    auto expected = circuit_unitary(rotations, 2);
+    ASSERT_THROW(translate(rotations, DecompositionBasis::CLIFFORD_T), QcoreException);
+    ASSERT_GT(translate(rotations, DecompositionBasis::CLIFFORD_T, 1e-6), 0);
+    for (auto& g : rotations.getGates()) {
+        ASSERT_TRUE(inBasis(g->getType(), DecompositionBasis::CLIFFORD_T) && g->getType() != GateType::RZ);
+    }
+    ASSERT_TRUE(equal_up_to_phase(expected, circuit_unitary(rotations, 2), 1e-4));
+}
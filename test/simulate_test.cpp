@@ -0,0 +1,776 @@
+/*
+ * This file is part of the core quantum library package.
+ *
+ * Developed for the Deutsches Forschungszentrum für Künstliche
+ * Intelligenz GmbH (DFKI), Cyber-Physical Systems Dept.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program. If not, see
+ * <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   simulate_test.cpp
+ *  @brief  Unit Test for Circuit Simulation
+ *  @author Abhoy Kole
+ *  @date   18.10.2026
+ ***********************************************************/
+
+#include <atomic>
+#include <random>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "QCircuit.hpp"
+#include "Unitary.hpp"
+#include "decompose/Clifford_T.hpp"
+#include "simulate/DecisionDiagram.hpp"
+#include "simulate/GateFusion.hpp"
+#include "simulate/Reversible.hpp"
+#include "simulate/Stabilizer.hpp"
+#include "simulate/StateVector.hpp"
+
+using namespace qcore;
+
+QCircuit parse_qasm(const std::string& body, regsize_t qreg) {
+    auto qasm = std::istringstream("OPENQASM 2.0;\ninclude \"qelib1.inc\";\nqreg q[" + std::to_string(qreg) +
+                                   "];\ncreg c[" + std::to_string(qreg) + "];\n" + body);
+    QCircuit qc;
+    qc.readQASM(qasm);
+    return qc;
+}
+
+std::vector<SimdLevel> available_levels() {
+    std::vector<SimdLevel> levels{SimdLevel::SCALAR};
+    if (detectSimdLevel() >= SimdLevel::AVX2) {
+        levels.push_back(SimdLevel::AVX2);
+    }
+    if (detectSimdLevel() >= SimdLevel::AVX512) {
+        levels.push_back(SimdLevel::AVX512);
+    }
+    return levels;
+}
+
+// naive state evolution, one basis state at a time
+void reference_apply(std::vector<Complex>& state, QGate& g) {
+    const std::size_t dim = state.size();
+    std::size_t control_mask = 0;
+    for (auto c : g.getControls()) {
+        control_mask |= std::size_t{1} << c;
+    }
+    auto single = [&](Qubit target, const Matrix2& m, std::size_t controls) {
+        const std::size_t bit = std::size_t{1} << target;
+        for (std::size_t i = 0; i < dim; ++i) {
+            if ((i & bit) == 0 && (i & controls) == controls) {
+                const Complex a0 = state[i], a1 = state[i | bit];
+                state[i] = m[0] * a0 + m[1] * a1;
+                state[i | bit] = m[2] * a0 + m[3] * a1;
+            }
+        }
+    };
+
+    Matrix2 m{};
+    Matrix4 m4{};
+    if (tryTargetMatrix(g, m)) {
+        single(g.getTargets()[0], m, control_mask);
+    } else if (g.getType() == GateType::CSWAP) {
+        const Qubit a = g.getTargets()[0], b = g.getTargets()[1];
+        const Matrix2 x = fixedMatrix(GateType::X);
+        single(a, x, std::size_t{1} << b);
+        single(b, x, control_mask | (std::size_t{1} << a));
+        single(a, x, std::size_t{1} << b);
+    } else if (g.getControls().empty() && g.getTargets().size() == 2 && tryTwoQubitMatrix(g, g.getTargets()[0], g.getTargets()[1], m4)) {
+        const Qubit low = g.getTargets()[0], high = g.getTargets()[1];
+        for (std::size_t i = 0; i < dim; ++i) {
+            if (((i >> low) & 1) == 0 && ((i >> high) & 1) == 0) {
+                const std::array<std::size_t, 4> index{i, i | (std::size_t{1} << low), i | (std::size_t{1} << high),
+                                                       i | (std::size_t{1} << low) | (std::size_t{1} << high)};
+                std::array<Complex, 4> amplitudes{};
+                for (std::size_t r = 0; r < 4; ++r) {
+                    for (std::size_t c = 0; c < 4; ++c) {
+                        amplitudes[r] += m4[4 * r + c] * state[index[c]];
+                    }
+                }
+                for (std::size_t r = 0; r < 4; ++r) {
+                    state[index[r]] = amplitudes[r];
+                }
+            }
+        }
+    } else {
+        const DecompositionTemplate table = cliffordTTemplate(g.getType());
+        ASSERT_NE(table.steps, nullptr) << "unsupported gate " << toString(g.getType());
+        QubitSet qubits(g.getControls());
+        qubits.push_back(g.getTargets()[0]);
+        for (const DecompositionStep* step = table.steps; step != table.steps + table.count; ++step) {
+            single(qubits[step->target], fixedMatrix(step->type), (step->control == NO_SLOT) ? 0 : std::size_t{1} << qubits[step->control]);
+        }
+    }
+}
+
+TEST(StateVectorTest, KernelsMatchReference) {
+    std::mt19937 rng(45);
+    const std::vector<std::string> single{"h", "t", "sdg", "x", "y", "z", "sx", "rx(0.3)", "ry(1.1)", "rz(0.7)", "u3(0.4,1.2,2.3)", "p(0.9)"};
+    const std::vector<std::string> pair{"cx", "cz", "cy", "ch", "crz(0.5)", "cu3(0.1,0.2,0.3)", "swap", "rzz(0.6)", "rxx(1.3)", "iswap"};
+    const std::vector<std::string> triple{"ccx", "cswap", "rccx"};
+    const std::size_t n = 7;
+
+    for (int trial = 0; trial < 10; ++trial) {
+        std::string body{};
+        for (std::size_t q = 0; q < n; ++q) {
+            body += "u3(" + std::to_string(0.3 + q) + ",0.2,0.1) q[" + std::to_string(q) + "];\n";
+        }
+        for (int i = 0; i < 60; ++i) {
+            std::vector<int> qubits{0, 1, 2, 3, 4, 5, 6};
+            std::shuffle(qubits.begin(), qubits.end(), rng);
+            auto q = [&qubits](int k) { return "q[" + std::to_string(qubits[k]) + "]"; };
+            switch (rng() % 3) {
+                case 0:
+                    body += pair[rng() % pair.size()] + " " + q(0) + "," + q(1) + ";\n";
+                    break;
+                case 1:
+                    body += triple[rng() % triple.size()] + " " + q(0) + "," + q(1) + "," + q(2) + ";\n";
+                    break;
+                default:
+                    body += single[rng() % single.size()] + " " + q(0) + ";\n";
+            }
+        }
+        auto qc = parse_qasm(body, n);
+        // rc3x has no QASM 2.0 form the reader accepts
+        for (int i = 0; i < 6; ++i) {
+            QubitSet qubits{0, 1, 2, 3, 4, 5, 6};
+            std::shuffle(qubits.begin(), qubits.end(), rng);
+            auto position = qc.getGates().begin() + static_cast<std::ptrdiff_t>(rng() % qc.getGates().size());
+            qc.getGates().insert(position, std::make_unique<QGate>(GateType::RC3X, 4, ControlSet(qubits.begin(), qubits.begin() + 3), TargetSet{qubits[3]}));
+        }
+
+        std::vector<Complex> expected(std::size_t{1} << n, 0);
+        expected[0] = 1;
+        for (auto& g : qc.getGates()) {
+            reference_apply(expected, *g);
+        }
+
+        for (auto level : available_levels()) {
+            StateVector state(n, 1, level);
+            state.run(qc);
+            for (std::size_t i = 0; i < expected.size(); ++i) {
+                ASSERT_NEAR(std::abs(state.amplitude(i) - expected[i]), 0, 1e-12) << toString(level) << " amplitude " << i;
+            }
+        }
+    }
+}
+
+TEST(StateVectorTest, MeasurementCollapsesAndConditions) {
+    auto qc = parse_qasm("h q[0];\ncx q[0],q[1];\nmeasure q[0] -> c[0];\nmeasure q[1] -> c[1];\nif (c==3) x q[2];\n", 3);
+    int ones = 0;
+    for (std::uint64_t seed = 0; seed < 32; ++seed) {
+        StateVector state(3, 1, detectSimdLevel(), seed);
+        state.run(qc);
+        ASSERT_EQ(state.getCbits()[0], state.getCbits()[1]);
+        ASSERT_NEAR(state.probability(2), state.getCbits()[0], 1e-12);
+        ones += state.getCbits()[0];
+    }
+    ASSERT_GT(ones, 0);
+    ASSERT_LT(ones, 32);
+
+    StateVector state(2);
+    auto prepared = parse_qasm("x q[0];\nh q[1];\nreset q[0];\nreset q[1];\n", 2);
+    state.run(prepared);
+    ASSERT_NEAR(std::abs(state.amplitude(0)), 1, 1e-12);
+
+    auto wide = parse_qasm("h q[0];\n", 3);
+    ASSERT_THROW(state.run(wide), QcoreException);
+
+    // conditioned two-target gates apply the matrix of the bare gate
+    const std::string prefix = "x q[0];\nh q[1];\nh q[2];\nmeasure q[0] -> c[0];\n";
+    const std::string gates = "rzz(0.7) q[1],q[2];\nrxx(0.4) q[2],q[1];\niswap q[1],q[2];\n";
+    StateVector expected(3);
+    auto bare = parse_qasm(prefix + gates, 3);
+    expected.run(bare);
+    StateVector conditioned(3);
+    auto taken = parse_qasm(prefix + "if (c==1) rzz(0.7) q[1],q[2];\nif (c==1) rxx(0.4) q[2],q[1];\nif (c==1) iswap q[1],q[2];\n", 3);
+    conditioned.run(taken);
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_NEAR(std::abs(conditioned.amplitude(i) - expected.amplitude(i)), 0, 1e-12) << i;
+    }
+    StateVector skipped(3);
+    auto untaken = parse_qasm(prefix + "if (c==0) rzz(0.7) q[1],q[2];\n", 3);
+    skipped.run(untaken);
+    ASSERT_NEAR(std::abs(skipped.amplitude(7) - Complex{0.5, 0}), 0, 1e-12);
+}
+
+TEST(StateVectorTest, ParallelMatchesSerial) {
+    const std::size_t n = 16;
+    QCircuit qc(n, 0);
+    auto& gates = qc.getGates();
+    for (Qubit q = 0; q < n; ++q) {
+        gates.push_back(std::make_unique<QGate>(GateType::H, 1, TargetSet{q}));
+        gates.push_back(std::make_unique<QGate>((q % 2) ? GateType::T : GateType::SX, 1, TargetSet{(q * 7) % n}));
+    }
+    for (Qubit q = 0; q + 2 < n; ++q) {
+        gates.push_back(std::make_unique<QGate>(GateType::CX, 2, ControlSet{q}, TargetSet{q + 1}));
+        gates.push_back(std::make_unique<QGate>(GateType::CCX, 3, ControlSet{q + 2, q}, TargetSet{q + 1}));
+        gates.push_back(std::make_unique<QGate>(GateType::SWAP, 2, TargetSet{q, n - 1 - q}));
+        gates.push_back(std::make_unique<QGate>(GateType::CY, 2, ControlSet{n - 1 - q}, TargetSet{0}));
+    }
+
+    StateVector serial(n, 1), parallel(n, 4);
+    serial.run(qc);
+    parallel.run(qc);
+    fp norm = 0;
+    for (std::size_t i = 0; i < serial.size(); ++i) {
+        ASSERT_EQ(serial.amplitude(i), parallel.amplitude(i));
+        norm += std::norm(serial.amplitude(i));
+    }
+    ASSERT_NEAR(norm, 1, 1e-9);
+}
+
+TEST(GateFusionTest, FusedMatchesUnfused) {
+    std::mt19937 rng(46);
+    const std::vector<std::string> single{"h", "t", "sdg", "x", "sx", "rx(0.3)", "ry(1.1)", "u3(0.4,1.2,2.3)"};
+    const std::vector<std::string> pair{"cx", "cz", "cy", "crz(0.5)", "swap", "rzz(0.6)", "iswap"};
+    const std::size_t n = 8;
+
+    std::string body{};
+    for (int i = 0; i < 120; ++i) {
+        std::vector<int> qubits{0, 1, 2, 3, 4, 5, 6, 7};
+        std::shuffle(qubits.begin(), qubits.end(), rng);
+        auto q = [&qubits](int k) { return "q[" + std::to_string(qubits[k]) + "]"; };
+        switch (rng() % 4) {
+            case 0:
+                body += "ccx " + q(0) + "," + q(1) + "," + q(2) + ";\n";
+                break;
+            case 1:
+                body += pair[rng() % pair.size()] + " " + q(0) + "," + q(1) + ";\n";
+                break;
+            default:
+                body += single[rng() % single.size()] + " " + q(0) + ";\n";
+        }
+        if (i == 60) {
+            body += "measure q[3] -> c[0];\nif (c==1) x q[5];\n";
+        }
+    }
+    auto qc = parse_qasm(body, n);
+    qc.getGates().insert(qc.getGates().begin() + 30, std::make_unique<QGate>(GateType::BARRIER, n, TargetSet{0, 1, 2, 3, 4, 5, 6, 7}));
+
+    for (auto level : available_levels()) {
+        StateVector expected(n, 1, level, 7);
+        expected.run(qc);
+        for (std::size_t k = 2; k <= 5; ++k) {
+            const auto steps = fuseGates(qc, k, level);
+            std::size_t fused = 0;
+            for (const auto& step : steps) {
+                if (step.isFused()) {
+                    ++fused;
+                    ASSERT_LE(step.block.qubits.size(), k);
+                }
+            }
+            ASSERT_GT(fused, 0u);
+            ASSERT_LT(steps.size(), qc.getGates().size());
+
+            StateVector state(n, 1, level, 7);
+            state.run(steps);
+            ASSERT_EQ(state.getCbits()[0], expected.getCbits()[0]);
+            for (std::size_t i = 0; i < state.size(); ++i) {
+                ASSERT_NEAR(std::abs(state.amplitude(i) - expected.amplitude(i)), 0, 1e-12) << toString(level) << " k = " << k << " amplitude " << i;
+            }
+        }
+    }
+}
+
+TEST(GateFusionTest, CostModelDecides) {
+    auto qc = parse_qasm("t q[1];\nt q[2];\nt q[3];\nt q[4];\n", 5);
+    // four cheap diagonal kernels beat a 4-qubit dense matrix when passes are free
+    auto steps = fuseGates(qc, 4, SimdLevel::SCALAR, 0);
+    ASSERT_EQ(steps.size(), 4u);
+    for (const auto& step : steps) {
+        ASSERT_FALSE(step.isFused());
+    }
+
+    steps = fuseGates(qc, 4, SimdLevel::SCALAR, 100);
+    ASSERT_EQ(steps.size(), 1u);
+    ASSERT_TRUE(steps[0].isFused());
+    ASSERT_EQ(steps[0].block.gates, 4u);
+    ASSERT_EQ(steps[0].block.qubits, (QubitSet{1, 2, 3, 4}));
+    ASSERT_LT(blockCost(steps[0].block.qubits, SimdLevel::SCALAR, 100), 4 * gateCost(*qc.getGates()[0], SimdLevel::SCALAR, 100));
+
+    ASSERT_THROW(fuseGates(qc, 0), QcoreException);
+    ASSERT_THROW(fuseGates(qc, MAX_DENSE_QUBITS + 1), QcoreException);
+}
+
+TEST(BlockedExecutionTest, BlockedMatchesUnblocked) {
+    std::mt19937 rng(47);
+    const std::vector<std::string> single{"h", "t", "x", "sx", "ry(1.1)", "u3(0.4,1.2,2.3)"};
+    const std::vector<std::string> pair{"cx", "cy", "crz(0.5)", "swap", "rzz(0.6)"};
+    const std::size_t n = 10;
+
+    // QASM only reaches the qubits 0 to 9
+    std::string body{};
+    for (int i = 0; i < 150; ++i) {
+        std::vector<int> qubits{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        std::shuffle(qubits.begin(), qubits.end(), rng);
+        auto q = [&qubits](int k) { return "q[" + std::to_string(qubits[k]) + "]"; };
+        switch (rng() % 4) {
+            case 0:
+                body += "ccx " + q(0) + "," + q(1) + "," + q(2) + ";\n";
+                break;
+            case 1:
+                body += pair[rng() % pair.size()] + " " + q(0) + "," + q(1) + ";\n";
+                break;
+            default:
+                body += single[rng() % single.size()] + " " + q(0) + ";\n";
+        }
+        if (i == 90) {
+            body += "measure q[8] -> c[0];\nif (c==1) x q[1];\n";
+        }
+    }
+    auto qc = parse_qasm(body, n);
+
+    for (std::size_t threads : {1, 3}) {
+        StateVector expected(n, threads, detectSimdLevel(), 5);
+        expected.run(qc);
+
+        for (std::size_t block : {3, 5, 10, 16}) {
+            StateVector state(n, threads, detectSimdLevel(), 5);
+            const std::size_t passes = state.runBlocked(qc, block);
+            ASSERT_LT(passes, qc.getGates().size());
+            ASSERT_EQ(state.getCbits()[0], expected.getCbits()[0]);
+            for (std::size_t i = 0; i < state.size(); ++i) {
+                ASSERT_NEAR(std::abs(state.amplitude(i) - expected.amplitude(i)), 0, 1e-12) << "block " << block << " amplitude " << i;
+            }
+
+            StateVector fused(n, threads, detectSimdLevel(), 5);
+            fused.runBlocked(fuseGates(qc, 3, fused.getSimdLevel()), block);
+            for (std::size_t i = 0; i < fused.size(); ++i) {
+                ASSERT_NEAR(std::abs(fused.amplitude(i) - expected.amplitude(i)), 0, 1e-12) << "fused block " << block << " amplitude " << i;
+            }
+        }
+    }
+}
+
+TEST(BlockedExecutionTest, LocalRunsTakeOnePass) {
+    auto local = parse_qasm("h q[0];\nh q[1];\ncx q[0],q[2];\nt q[2];\nccx q[0],q[1],q[2];\nh q[1];\n", 8);
+    StateVector state(8);
+    ASSERT_EQ(state.runBlocked(local, 3), 1u);
+
+    StateVector expected(8);
+    expected.run(local);
+    for (std::size_t i = 0; i < state.size(); ++i) {
+        ASSERT_NEAR(std::abs(state.amplitude(i) - expected.amplitude(i)), 0, 1e-12);
+    }
+
+    // a high qubit is swapped in and out again: two swaps around one sweep
+    auto remote = parse_qasm("h q[7];\nt q[7];\nh q[7];\n", 8);
+    ASSERT_EQ(state.runBlocked(remote, 3), 3u);
+    expected.run(remote);
+    for (std::size_t i = 0; i < state.size(); ++i) {
+        ASSERT_NEAR(std::abs(state.amplitude(i) - expected.amplitude(i)), 0, 1e-12);
+    }
+
+    ASSERT_THROW(state.runBlocked(local, 0), QcoreException);
+}
+
+// collapse a state vector onto the outcome drawn by the stabilizer simulator
+void project(StateVector& state, Qubit qubit, bool outcome) {
+    const fp p = outcome ? state.probability(qubit) : 1 - state.probability(qubit);
+    ASSERT_GT(p, 1e-9);
+    const AmplitudeSpan amplitudes = state.span();
+    for (std::size_t i = 0; i < amplitudes.size(); ++i) {
+        amplitudes.data[i] = (((i >> qubit) & 1) == outcome) ? amplitudes.data[i] / std::sqrt(p) : Complex{0};
+    }
+}
+
+TEST(StabilizerTest, MatchesStateVector) {
+    std::mt19937 rng(48);
+    const std::vector<std::string> single{"h", "s", "sdg", "sx", "sxdg", "x", "y", "z", "id"};
+    const std::vector<std::string> pair{"cx", "cy", "cz", "swap"};
+    const std::size_t n = 6;
+
+    for (int trial = 0; trial < 20; ++trial) {
+        std::string body{};
+        for (int i = 0; i < 80; ++i) {
+            const int a = rng() % n, b = (a + 1 + rng() % (n - 1)) % n;
+            switch (rng() % 8) {
+                case 0:
+                    body += "measure q[" + std::to_string(a) + "] -> c[" + std::to_string(a) + "];\n";
+                    break;
+                case 1:
+                case 2:
+                case 3:
+                    body += pair[rng() % pair.size()] + " q[" + std::to_string(a) + "],q[" + std::to_string(b) + "];\n";
+                    break;
+                default:
+                    body += single[rng() % single.size()] + " q[" + std::to_string(a) + "];\n";
+            }
+        }
+        auto qc = parse_qasm(body, n);
+        ASSERT_TRUE(isStabilizerCircuit(qc));
+
+        StabilizerSimulator stabilizer(n, trial);
+        StateVector state(n);
+        for (auto& gate : qc.getGates()) {
+            if (gate->getType() != GateType::MEASURE) {
+                stabilizer.apply(*gate);
+                state.apply(*gate);
+                continue;
+            }
+            const Qubit q = gate->getTargets()[0];
+            const bool deterministic = stabilizer.isDeterministic(q);
+            stabilizer.apply(*gate);
+            const bool outcome = stabilizer.getCbits()[q] != 0;
+            ASSERT_NEAR(state.probability(q), deterministic ? (outcome ? 1 : 0) : 0.5, 1e-9);
+            project(state, q, outcome);
+        }
+
+        // after the last gate: deterministic exactly where the state vector is, with equal outcomes
+        for (Qubit q = 0; q < n; ++q) {
+            const fp p = state.probability(q);
+            if (stabilizer.isDeterministic(q)) {
+                ASSERT_NEAR(p, stabilizer.measure(q) ? 1 : 0, 1e-9) << "trial " << trial << " qubit " << q;
+            } else {
+                ASSERT_NEAR(p, 0.5, 1e-9) << "trial " << trial << " qubit " << q;
+                project(state, q, stabilizer.measure(q));
+            }
+        }
+    }
+}
+
+TEST(StabilizerTest, WideCircuitsAndConditions) {
+    const std::size_t n = 1000;
+    QCircuit ghz(n, 0);
+    auto& gates = ghz.getGates();
+    gates.push_back(std::make_unique<QGate>(GateType::H, 1, TargetSet{0}));
+    for (Qubit q = 0; q + 1 < n; ++q) {
+        gates.push_back(std::make_unique<QGate>(GateType::CX, 2, ControlSet{q}, TargetSet{q + 1}));
+    }
+
+    for (std::uint64_t seed = 0; seed < 2; ++seed) {
+        StabilizerSimulator stabilizer(n, seed);
+        stabilizer.run(ghz);
+        ASSERT_FALSE(stabilizer.isDeterministic(n - 1));
+        const bool outcome = stabilizer.measure(n - 1);
+        for (Qubit q = 0; q < n; ++q) {
+            ASSERT_TRUE(stabilizer.isDeterministic(q));
+            ASSERT_EQ(stabilizer.measure(q), outcome);
+        }
+        stabilizer.reset(n - 1);
+        ASSERT_FALSE(stabilizer.measure(n - 1));
+    }
+
+    // a measured qubit flipped back under a condition ends in |0>, its partner in |1>
+    auto feedback = parse_qasm("h q[0];\nmeasure q[0] -> c[0];\nif (c==1) x q[0];\nx q[1];\nreset q[2];\n", 3);
+    for (std::uint64_t seed = 0; seed < 8; ++seed) {
+        StabilizerSimulator stabilizer(3, seed);
+        stabilizer.run(feedback);
+        ASSERT_FALSE(stabilizer.measure(0));
+        ASSERT_TRUE(stabilizer.measure(1));
+        ASSERT_FALSE(stabilizer.measure(2));
+    }
+
+    StabilizerSimulator stabilizer(3);
+    auto t = parse_qasm("t q[0];\n", 3);
+    ASSERT_FALSE(isStabilizerCircuit(t));
+    ASSERT_THROW(stabilizer.run(t), QcoreException);
+    auto wide = parse_qasm("h q[0];\n", 4);
+    ASSERT_THROW(stabilizer.run(wide), QcoreException);
+}
+
+// basis state after a reversible gate, one state at a time
+std::uint64_t reference_permute(std::uint64_t state, QGate& g) {
+    auto bit = [&state](Qubit q) { return (state >> q) & 1; };
+    auto& controls = g.getControls();
+    auto& targets = g.getTargets();
+    const bool active = std::all_of(controls.begin(), controls.end(), [&bit](Qubit c) { return bit(c) != 0; });
+    switch (g.getType()) {
+        case GateType::SWAP:
+        case GateType::CSWAP:
+            if (active && bit(targets[0]) != bit(targets[1])) {
+                state ^= (std::uint64_t{1} << targets[0]) | (std::uint64_t{1} << targets[1]);
+            }
+            return state;
+        case GateType::PERES:
+            state ^= static_cast<std::uint64_t>(active) << targets[0];
+            return state ^ (bit(controls[0]) << controls[1]);
+        case GateType::PERESDG:
+            state ^= bit(controls[0]) << controls[1];
+            return state ^ (static_cast<std::uint64_t>(bit(controls[0]) && bit(controls[1])) << targets[0]);
+        default:
+            return state ^ (static_cast<std::uint64_t>(active) << targets[0]);
+    }
+}
+
+TEST(ReversibleTest, MatchesReference) {
+    std::mt19937 rng(49);
+    const std::size_t n = 9;
+    for (int trial = 0; trial < 10; ++trial) {
+        QCircuit qc(n, 0);
+        auto& gates = qc.getGates();
+        for (int i = 0; i < 120; ++i) {
+            std::vector<Qubit> q{0, 1, 2, 3, 4, 5, 6, 7, 8};
+            std::shuffle(q.begin(), q.end(), rng);
+            switch (rng() % 8) {
+                case 0:
+                    gates.push_back(std::make_unique<QGate>(GateType::X, 1, TargetSet{q[0]}));
+                    break;
+                case 1:
+                    gates.push_back(std::make_unique<QGate>(GateType::CX, 2, ControlSet{q[0]}, TargetSet{q[1]}));
+                    break;
+                case 2:
+                    gates.push_back(std::make_unique<QGate>(GateType::CCX, 3, ControlSet{q[0], q[1]}, TargetSet{q[2]}));
+                    break;
+                case 3:
+                    gates.push_back(std::make_unique<QGate>(GateType::MCX, 5, ControlSet{q[0], q[1], q[2], q[3]}, TargetSet{q[4]}));
+                    break;
+                case 4:
+                    gates.push_back(std::make_unique<QGate>(GateType::SWAP, 2, TargetSet{q[0], q[1]}));
+                    break;
+                case 5:
+                    gates.push_back(std::make_unique<QGate>(GateType::CSWAP, 3, ControlSet{q[0]}, TargetSet{q[1], q[2]}));
+                    break;
+                case 6:
+                    gates.push_back(std::make_unique<QGate>(GateType::PERES, 3, ControlSet{q[0], q[1]}, TargetSet{q[2]}));
+                    break;
+                default:
+                    gates.push_back(std::make_unique<QGate>(GateType::PERESDG, 3, ControlSet{q[0], q[1]}, TargetSet{q[2]}));
+            }
+        }
+        ASSERT_TRUE(isReversibleCircuit(qc));
+
+        std::vector<std::uint64_t> states(std::size_t{1} << n), expected(states.size());
+        for (std::uint64_t s = 0; s < states.size(); ++s) {
+            states[s] = s;
+            expected[s] = s;
+            for (auto& gate : gates) {
+                expected[s] = reference_permute(expected[s], *gate);
+            }
+        }
+        for (auto level : available_levels()) {
+            ReversibleSimulator simulator(qc, level);
+            ASSERT_EQ(simulator.run(states), expected) << toString(level);
+
+            // inputs in a shuffled order, the remaining qubit starting at 0
+            QubitSet inputs{3, 0, 7, 5, 1, 8, 2, 6};
+            const TruthTable table = simulator.truthTable(inputs, 1 + trial % 3);
+            for (std::uint64_t a = 0; a < (std::uint64_t{1} << inputs.size()); ++a) {
+                std::uint64_t s = 0;
+                for (std::size_t i = 0; i < inputs.size(); ++i) {
+                    s |= ((a >> i) & 1) << inputs[i];
+                }
+                ASSERT_EQ(table.output(a), expected[s]) << toString(level) << " assignment " << a;
+            }
+        }
+
+        // PERES ordering agrees with the state-vector simulator
+        const std::uint64_t s = rng() % states.size();
+        StateVector state(n);
+        for (Qubit q = 0; q < n; ++q) {
+            if ((s >> q) & 1) {
+                QGate x(GateType::X, 1, TargetSet{q});
+                state.apply(x);
+            }
+        }
+        state.run(qc);
+        ASSERT_NEAR(std::abs(state.amplitude(expected[s])), 1, 1e-9);
+    }
+}
+
+TEST(ReversibleTest, VerifiesAdder) {
+    // Cuccaro ripple-carry adder: b := a + b, carry into z
+    const std::size_t bits = 10;
+    const Qubit c = 0, z = 2 * bits + 1;
+    auto a = [](std::size_t i) { return Qubit(1 + i); };
+    auto b = [](std::size_t i) { return Qubit(1 + bits + i); };
+    QCircuit qc(2 * bits + 2, 0);
+    auto& gates = qc.getGates();
+    auto cx = [&gates](Qubit x, Qubit y) { gates.push_back(std::make_unique<QGate>(GateType::CX, 2, ControlSet{x}, TargetSet{y})); };
+    auto ccx = [&gates](Qubit x, Qubit y, Qubit t) { gates.push_back(std::make_unique<QGate>(GateType::CCX, 3, ControlSet{x, y}, TargetSet{t})); };
+    for (std::size_t i = 0; i < bits; ++i) {
+        const Qubit carry = (i == 0) ? c : a(i - 1);
+        cx(a(i), b(i));
+        cx(a(i), carry);
+        ccx(carry, b(i), a(i));
+    }
+    cx(a(bits - 1), z);
+    for (std::size_t i = bits; i-- > 0;) {
+        const Qubit carry = (i == 0) ? c : a(i - 1);
+        ccx(carry, b(i), a(i));
+        cx(a(i), carry);
+        cx(carry, b(i));
+    }
+
+    QubitSet inputs{};
+    for (std::size_t i = 0; i < bits; ++i) {
+        inputs.push_back(a(i));
+    }
+    for (std::size_t i = 0; i < bits; ++i) {
+        inputs.push_back(b(i));
+    }
+
+    ReversibleSimulator simulator(qc);
+    std::atomic<std::uint64_t> checked{0}, failed{0};
+    simulator.enumerate(
+        inputs,
+        [&](const SliceBatch& batch) {
+            std::uint64_t errors = 0;
+            for (std::uint64_t x = batch.first; x < batch.first + batch.count; ++x) {
+                const std::uint64_t sum = (x & ((1u << bits) - 1)) + (x >> bits);
+                std::uint64_t output = static_cast<std::uint64_t>(batch.value(z, x)) << bits;
+                for (std::size_t i = 0; i < bits; ++i) {
+                    output |= static_cast<std::uint64_t>(batch.value(b(i), x)) << i;
+                    errors += batch.value(a(i), x) != (((x >> i) & 1) != 0);
+                }
+                errors += batch.value(c, x) || output != sum;
+            }
+            checked += batch.count;
+            failed += errors;
+        },
+        2);
+    ASSERT_EQ(checked.load(), std::uint64_t{1} << (2 * bits));
+    ASSERT_EQ(failed.load(), 0u);
+
+    auto t = parse_qasm("t q[0];\n", 3);
+    ASSERT_FALSE(isReversibleCircuit(t));
+    ASSERT_THROW(ReversibleSimulator{t}, QcoreException);
+    auto conditioned = parse_qasm("measure q[0] -> c[0];\nif (c==1) x q[1];\n", 3);
+    ASSERT_THROW(ReversibleSimulator{conditioned}, QcoreException);
+    ASSERT_THROW(simulator.enumerate(QubitSet{1, 1}, [](const SliceBatch&) {}), QcoreException);
+}
+
+TEST(DecisionDiagramTest, MatchesStateVector) {
+    std::mt19937 rng(50);
+    const std::vector<std::string> single{"h", "t", "sdg", "x", "y", "sx", "rx(0.3)", "ry(1.1)", "rz(0.7)", "u3(0.4,1.2,2.3)", "p(0.9)"};
+    const std::vector<std::string> pair{"cx", "cz", "cy", "ch", "crz(0.5)", "cu3(0.1,0.2,0.3)", "swap", "rzz(0.6)", "rxx(1.3)", "iswap"};
+    const std::vector<std::string> triple{"ccx", "cswap", "rccx"};
+    const std::size_t n = 7;
+
+    for (int trial = 0; trial < 6; ++trial) {
+        std::string body{};
+        for (int i = 0; i < 80; ++i) {
+            std::vector<int> qubits{0, 1, 2, 3, 4, 5, 6};
+            std::shuffle(qubits.begin(), qubits.end(), rng);
+            auto q = [&qubits](int k) { return "q[" + std::to_string(qubits[k]) + "]"; };
+            switch (rng() % 12) {
+                case 0:
+                    body += "measure " + q(0) + " -> c[" + std::to_string(qubits[0]) + "];\n";
+                    break;
+                case 1:
+                    body += "if (c==1) x " + q(0) + ";\n";
+                    break;
+                case 2:
+                case 3:
+                case 4:
+                    body += pair[rng() % pair.size()] + " " + q(0) + "," + q(1) + ";\n";
+                    break;
+                case 5:
+                    body += triple[rng() % triple.size()] + " " + q(0) + "," + q(1) + "," + q(2) + ";\n";
+                    break;
+                default:
+                    body += single[rng() % single.size()] + " " + q(0) + ";\n";
+            }
+        }
+        auto qc = parse_qasm(body, n);
+        qc.getGates().push_back(std::make_unique<QGate>(GateType::PERES, 3, ControlSet{2, 5}, TargetSet{0}));
+        qc.getGates().push_back(std::make_unique<QGate>(GateType::RC3X, 4, ControlSet{6, 1, 3}, TargetSet{4}));
+
+        // equal seeds draw equal outcomes from equal probabilities
+        StateVector expected(n, 1, SimdLevel::SCALAR, trial);
+        expected.run(qc);
+        DDSimulator dd(n, trial, 64);
+        dd.run(qc);
+        ASSERT_EQ(dd.getCbits(), expected.getCbits());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_NEAR(std::abs(dd.amplitude(i) - expected.amplitude(i)), 0, 1e-9) << "trial " << trial << " amplitude " << i;
+        }
+        for (Qubit q = 0; q < n; ++q) {
+            ASSERT_NEAR(dd.probability(q), expected.probability(q), 1e-9);
+        }
+    }
+
+    auto conditioned = parse_qasm("x q[0];\nh q[1];\nh q[2];\nmeasure q[0] -> c[0];\nif (c==1) rzz(0.7) q[1],q[2];\nif (c==1) iswap q[2],q[1];\n", 3);
+    StateVector expected(3);
+    expected.run(conditioned);
+    DDSimulator dd(3);
+    dd.run(conditioned);
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_NEAR(std::abs(dd.amplitude(i) - expected.amplitude(i)), 0, 1e-9) << "conditioned amplitude " << i;
+    }
+}
+
+TEST(DecisionDiagramTest, BuildsUnitary) {
+    auto qc = parse_qasm("h q[0];\ncx q[0],q[2];\nt q[1];\nrzz(0.4) q[3],q[1];\nccx q[3],q[0],q[1];\nu3(0.2,0.5,1.1) q[2];\niswap q[0],q[3];\n", 4);
+    DDPackage package(4);
+    const MatrixEdge unitary = buildUnitary(package, qc);
+    for (std::uint64_t column = 0; column < 16; ++column) {
+        StateVector state(4);
+        for (Qubit q = 0; q < 4; ++q) {
+            if ((column >> q) & 1) {
+                QGate x(GateType::X, 1, TargetSet{q});
+                state.apply(x);
+            }
+        }
+        state.run(qc);
+        for (std::uint64_t row = 0; row < 16; ++row) {
+            ASSERT_NEAR(std::abs(package.entry(unitary, row, column) - state.amplitude(row)), 0, 1e-9) << row << "," << column;
+        }
+    }
+
+    // released diagrams are freed by a forced collection
+    package.decRef(unitary);
+    package.garbageCollect(true);
+    ASSERT_EQ(package.getStatistics().matrix_nodes, 0u);
+
+    auto measured = parse_qasm("h q[0];\nmeasure q[0] -> c[0];\n", 2);
+    ASSERT_THROW(buildUnitary(package, measured), QcoreException);
+}
+
+TEST(DecisionDiagramTest, WideStatesStaySmall) {
+    // a 64-qubit GHZ state has one node per level and a branch per outcome
+    const std::size_t n = 64;
+    QCircuit ghz(n, 0);
+    auto& gates = ghz.getGates();
+    gates.push_back(std::make_unique<QGate>(GateType::H, 1, TargetSet{0}));
+    for (Qubit q = 0; q + 1 < n; ++q) {
+        gates.push_back(std::make_unique<QGate>(GateType::CX, 2, ControlSet{q}, TargetSet{q + 1}));
+    }
+    DDSimulator dd(n, 7, 256);
+    dd.run(ghz);
+    ASSERT_LE(dd.getPackage().nodeCount(dd.getState()), 2 * n);
+    ASSERT_NEAR(std::abs(dd.amplitude(0)), SQRT1_2, 1e-9);
+    ASSERT_NEAR(std::abs(dd.amplitude(~std::uint64_t{0})), SQRT1_2, 1e-9);
+    const bool outcome = dd.measure(n - 1);
+    for (Qubit q = 0; q < n; ++q) {
+        ASSERT_NEAR(dd.probability(q), outcome ? 1 : 0, 1e-9);
+    }
+
+    // a long run with a small limit: garbage is collected and the tables stay bounded
+    std::mt19937 rng(5);
+    QCircuit layers(n, 0);
+    for (int i = 0; i < 1500; ++i) {
+        const Qubit q = rng() % (n - 1);
+        layers.getGates().push_back(std::make_unique<QGate>(GateType::H, 1, TargetSet{q}));
+        layers.getGates().push_back(std::make_unique<QGate>(GateType::T, 1, TargetSet{q}));
+        layers.getGates().push_back(std::make_unique<QGate>(GateType::CX, 2, ControlSet{q}, TargetSet{q + 1}));
+        layers.getGates().push_back(std::make_unique<QGate>(GateType::CX, 2, ControlSet{q}, TargetSet{q + 1}));
+        layers.getGates().push_back(std::make_unique<QGate>(GateType::TDG, 1, TargetSet{q}));
+        layers.getGates().push_back(std::make_unique<QGate>(GateType::H, 1, TargetSet{q}));
+    }
+    dd.run(layers);
+    const DDStatistics& statistics = dd.getPackage().getStatistics();
+    ASSERT_GT(statistics.collections, 0u);
+    ASSERT_LT(statistics.peak_nodes, 8 * 256u);
+    ASSERT_NEAR(dd.probability(n - 1), outcome ? 1 : 0, 1e-9);
+
+    auto t = parse_qasm("t q[0];\n", 3);
+    DDSimulator small(2);
+    ASSERT_THROW(small.run(t), QcoreException);
+}